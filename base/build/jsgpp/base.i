@@ -267,6 +267,7 @@ const bool UMFPACK_ENABLED;
 %include "base/src/sgpp/base/tools/sle/system/CloneableSLE.hpp"
 %include "base/src/sgpp/base/tools/sle/system/FullSLE.hpp"
 %include "base/src/sgpp/base/tools/sle/system/HierarchisationSLE.hpp"
+%include "base/src/sgpp/base/tools/sle/system/SparseSLE.hpp"
 
 %include "base/src/sgpp/base/tools/sle/solver/SLESolver.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/Armadillo.hpp"
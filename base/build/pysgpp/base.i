@@ -77,6 +77,8 @@ namespace std {
 %ignore sgpp::base::DataMatrixSP::operator[];
 %ignore sgpp::base::DataMatrixSP::toString(std::string& text) const;
 %include "base/src/sgpp/base/datatypes/DataMatrixSP.hpp"
+%ignore sgpp::base::SymmetricPackedMatrix::getPointer;
+%include "base/src/sgpp/base/datatypes/SymmetricPackedMatrix.hpp"
 
 // The Good, i.e. without any modifications
 %ignore sgpp::base::BoundingBox::toString(std::string& text) const;
@@ -89,6 +91,10 @@ namespace std {
 %ignore sgpp::base::HashGridStorage::operator[];
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridIterator.hpp"
+%ignore sgpp::base::FlatGridStorage::operator[];
+%include "base/src/sgpp/base/grid/storage/hashmap/FlatGridStorage.hpp"
+%ignore sgpp::base::MappedGridStorage::Header;
+%include "base/src/sgpp/base/grid/storage/hashmap/MappedGridStorage.hpp"
 %include "base/src/sgpp/base/grid/GridStorage.hpp"
 
 %include "base/src/sgpp/base/grid/generation/functors/RefinementFunctor.hpp"
@@ -252,16 +258,21 @@ const bool UMFPACK_ENABLED;
 %include "base/src/sgpp/base/tools/sle/system/CloneableSLE.hpp"
 %include "base/src/sgpp/base/tools/sle/system/FullSLE.hpp"
 %include "base/src/sgpp/base/tools/sle/system/HierarchisationSLE.hpp"
+%include "base/src/sgpp/base/tools/sle/system/SparseSLE.hpp"
 
 %include "base/src/sgpp/base/tools/sle/solver/SLESolver.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/Armadillo.hpp"
 %rename(AutoSLESolver) sgpp::base::sle_solver::Auto;
 %include "base/src/sgpp/base/tools/sle/solver/Auto.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/BiCGStab.hpp"
+%ignore sgpp::base::sle_solver::CombinationTechnique::hierarchise;
+%include "base/src/sgpp/base/tools/sle/solver/CombinationTechnique.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/Eigen.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/GaussianElimination.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/Gmmpp.hpp"
 %include "base/src/sgpp/base/tools/sle/solver/UMFPACK.hpp"
+%ignore sgpp::base::LUFactorization::solve;
+%include "base/src/sgpp/base/tools/sle/LUFactorization.hpp"
 
 %include "base/src/sgpp/base/tools/MutexType.hpp"
 %include "base/src/sgpp/base/tools/Printer.hpp"
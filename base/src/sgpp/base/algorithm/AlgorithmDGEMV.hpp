@@ -157,6 +157,58 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+  /**
+   * Performs the DGEMV Operation on the grid having a transposed matrix for multiple
+   * coefficient vectors at once, i.e., the affected basis functions of each data point are
+   * determined and evaluated only once for all coefficient vectors.
+   *
+   * This operation can be executed in parallel by setting the USEOMP define
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points (each column is a coefficient vector)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (entry (i, k) is the value at data point i for the
+   * coefficient vector k), has to be sized correctly
+   */
+  void mult(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+            DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      const size_t result_size = result.getNrows();
+      const size_t m = source.getNcols();
+
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule (static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        double* resultRow = result.getPointer() + i * m;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          const double* sourceRow = source.getPointer() + iter->first * m;
+
+          for (size_t k = 0; k < m; k++) {
+            resultRow[k] += iter->second * sourceRow[k];
+          }
+        }
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -0,0 +1,581 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMEVALUATIONDERIVATIVESPRUNED_HPP
+#define ALGORITHMEVALUATIONDERIVATIVESPRUNED_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluates the 1D factors (value, first and second derivative) of a tensor product basis
+ * whose 1D basis provides eval(), evalDx() and evalDxDx(), including the inner derivative of
+ * the bounding box transformation.
+ * Instances are passed as EVAL_1D to the methods of AlgorithmEvaluationDerivativesPruned.
+ */
+template <class BASIS>
+class BasisDerivativeEvaluation {
+ public:
+  /**
+   * @param basis             1D basis
+   * @param innerDerivative   inner derivatives (inverse interval widths of the bounding box)
+   */
+  BasisDerivativeEvaluation(BASIS& basis, const DataVector& innerDerivative)
+      : basis(basis), innerDerivative(innerDerivative) {}
+
+  /**
+   * @param       t           dimension
+   * @param       order       highest derivative to evaluate (0, 1 or 2)
+   * @param       l           level of the basis function
+   * @param       i           index of the basis function
+   * @param       x           coordinate of the point in the unit cube
+   * @param[out]  derivatives value, first and second derivative (up to order)
+   */
+  inline void operator()(size_t t, size_t order, uint32_t l, uint32_t i, double x,
+                         double* derivatives) {
+    derivatives[0] = basis.eval(l, i, x);
+
+    if (order >= 1) {
+      derivatives[1] = basis.evalDx(l, i, x) * innerDerivative[t];
+    }
+
+    if (order >= 2) {
+      derivatives[2] = basis.evalDxDx(l, i, x) * innerDerivative[t] * innerDerivative[t];
+    }
+  }
+
+ protected:
+  /// 1D basis
+  BASIS& basis;
+  /// inner derivatives
+  const DataVector& innerDerivative;
+};
+
+/**
+ * Evaluation of linear combinations of tensor product basis functions together with their
+ * gradients, Hessians or partial derivatives, which only visits the grid points whose
+ * basis functions (or the required derivatives) do not vanish at the evaluation point.
+ * It is used by the "Naive" derivative operations of spline and wavelet grids.
+ *
+ * During prepare(), the grid points are sorted lexicographically by their (level, index) pairs,
+ * dimension by dimension, i.e., the sorted grid points form a trie in which the grid points
+ * sharing the same (level, index) pairs in the first t dimensions are neighbors (regardless of
+ * their levels in the other dimensions). The evaluation traverses this trie, reuses the 1D
+ * factors and the partial products of the common prefix and, if all required 1D derivatives
+ * in a dimension vanish, skips all following grid points that share the same prefix.
+ * Therefore, the 1D factors are evaluated once for every distinct (level, index) pair in the
+ * first dimension and, in the following dimensions, once for every distinct pair among the
+ * grid points whose prefix does not vanish at the evaluation point. For local bases, this is
+ * much less than the grid size.
+ *
+ * The products of the 1D factors in the gradient and Hessian entries are assembled from
+ * prefix and suffix products of the 1D values, i.e., the gradient of one basis function costs
+ * O(d) instead of O(d^2) operations. Dividing the product of all 1D values by the value in
+ * the respective dimension (e.g., via sums of logarithms) would be equally cheap, but fails
+ * at zeros of the 1D values (e.g., at the other grid points for fundamental splines).
+ *
+ * The sorted grid points are kept until the grid is modified (see
+ * HashGridStorage::getModificationCount()), the evaluation methods are const and can be called
+ * concurrently (with a separate EVAL_1D object per thread).
+ */
+class AlgorithmEvaluationDerivativesPruned {
+ public:
+  AlgorithmEvaluationDerivativesPruned()
+      : dimension(0),
+        gridSize(0),
+        prepared(false),
+        preparedStorage(nullptr),
+        preparedModificationCount(0) {}
+
+  /**
+   * Sorts the grid. Has to be called again if the grid changes.
+   *
+   * @param storage   storage of the sparse grid
+   */
+  void prepare(GridStorage& storage) {
+    dimension = storage.getDimension();
+    gridSize = storage.getSize();
+    sortGrid(storage);
+    preparedStorage = &storage;
+    preparedModificationCount = storage.getModificationCount();
+    prepared = true;
+  }
+
+  /**
+   * @param storage   storage of the sparse grid
+   * @return          whether prepare() has been called for this storage and the grid has not
+   *                  been modified since then
+   */
+  bool isPrepared(GridStorage& storage) const {
+    return prepared && (&storage == preparedStorage) &&
+           (storage.getModificationCount() == preparedModificationCount);
+  }
+
+  /**
+   * @tparam          EVAL_1D   functor evaluating the 1D factors
+   *                            (see BasisDerivativeEvaluation::operator())
+   * @param           eval1D    1D evaluation functor
+   * @param           alpha     coefficient vector
+   * @param           x         evaluation point in the unit cube
+   * @param[out]      gradient  gradient of the linear combination
+   * @return                    value of the linear combination
+   */
+  template <class EVAL_1D>
+  double evalGradient(EVAL_1D& eval1D, const DataVector& alpha, const double* x,
+                      DataVector& gradient) const {
+    const size_t d = dimension;
+    Workspace workspace(d, 1);
+    double result = 0.0;
+
+    gradient.resize(d);
+    gradient.setAll(0.0);
+
+    traverse(eval1D, x, workspace, [&](size_t i) {
+      const double curAlpha = alpha[i];
+      result += curAlpha * workspace.partialProducts[d];
+      computeGradientTerms(workspace);
+
+      for (size_t t = 0; t < d; t++) {
+        gradient[t] += curAlpha * workspace.gradient[t];
+      }
+    });
+
+    return result;
+  }
+
+  /**
+   * @tparam          EVAL_1D   functor evaluating the 1D factors
+   * @param           eval1D    1D evaluation functor
+   * @param           alpha     coefficient matrix (each column is a coefficient vector)
+   * @param           x         evaluation point in the unit cube
+   * @param[out]      value     values of the linear combinations
+   * @param[out]      gradient  Jacobian of the linear combinations (each row is a gradient)
+   */
+  template <class EVAL_1D>
+  void evalGradient(EVAL_1D& eval1D, const DataMatrix& alpha, const double* x, DataVector& value,
+                    DataMatrix& gradient) const {
+    const size_t d = dimension;
+    const size_t m = alpha.getNcols();
+    Workspace workspace(d, 1);
+
+    value.resize(m);
+    value.setAll(0.0);
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+
+    traverse(eval1D, x, workspace, [&](size_t i) {
+      computeGradientTerms(workspace);
+
+      for (size_t j = 0; j < m; j++) {
+        const double curAlpha = alpha(i, j);
+        value[j] += curAlpha * workspace.partialProducts[d];
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += curAlpha * workspace.gradient[t];
+        }
+      }
+    });
+  }
+
+  /**
+   * @tparam          EVAL_1D   functor evaluating the 1D factors
+   * @param           eval1D    1D evaluation functor
+   * @param           alpha     coefficient vector
+   * @param           x         evaluation point in the unit cube
+   * @param[out]      gradient  gradient of the linear combination
+   * @param[out]      hessian   Hessian of the linear combination
+   * @return                    value of the linear combination
+   */
+  template <class EVAL_1D>
+  double evalHessian(EVAL_1D& eval1D, const DataVector& alpha, const double* x,
+                     DataVector& gradient, DataMatrix& hessian) const {
+    const size_t d = dimension;
+    Workspace workspace(d, 2);
+    double result = 0.0;
+
+    gradient.resize(d);
+    gradient.setAll(0.0);
+    hessian.resize(d, d);
+    hessian.setAll(0.0);
+
+    traverse(eval1D, x, workspace, [&](size_t i) {
+      const double curAlpha = alpha[i];
+      result += curAlpha * workspace.partialProducts[d];
+      computeGradientTerms(workspace);
+      computeHessianTerms(workspace);
+
+      for (size_t t = 0; t < d; t++) {
+        gradient[t] += curAlpha * workspace.gradient[t];
+      }
+
+      for (size_t k = 0; k < d * d; k++) {
+        hessian[k] += curAlpha * workspace.hessian[k];
+      }
+    });
+
+    return result;
+  }
+
+  /**
+   * @tparam          EVAL_1D   functor evaluating the 1D factors
+   * @param           eval1D    1D evaluation functor
+   * @param           alpha     coefficient matrix (each column is a coefficient vector)
+   * @param           x         evaluation point in the unit cube
+   * @param[out]      value     values of the linear combinations
+   * @param[out]      gradient  Jacobian of the linear combinations (each row is a gradient)
+   * @param[out]      hessian   Hessians of the linear combinations
+   */
+  template <class EVAL_1D>
+  void evalHessian(EVAL_1D& eval1D, const DataMatrix& alpha, const double* x, DataVector& value,
+                   DataMatrix& gradient, std::vector<DataMatrix>& hessian) const {
+    const size_t d = dimension;
+    const size_t m = alpha.getNcols();
+    Workspace workspace(d, 2);
+
+    value.resize(m);
+    value.setAll(0.0);
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+    hessian.resize(m);
+
+    for (size_t j = 0; j < m; j++) {
+      hessian[j].resize(d, d);
+      hessian[j].setAll(0.0);
+    }
+
+    traverse(eval1D, x, workspace, [&](size_t i) {
+      computeGradientTerms(workspace);
+      computeHessianTerms(workspace);
+
+      for (size_t j = 0; j < m; j++) {
+        const double curAlpha = alpha(i, j);
+        value[j] += curAlpha * workspace.partialProducts[d];
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += curAlpha * workspace.gradient[t];
+        }
+
+        for (size_t k = 0; k < d * d; k++) {
+          hessian[j][k] += curAlpha * workspace.hessian[k];
+        }
+      }
+    });
+  }
+
+  /**
+   * @tparam          EVAL_1D           functor evaluating the 1D factors
+   * @param           eval1D            1D evaluation functor
+   * @param           alpha             coefficient vector
+   * @param           x                 evaluation point in the unit cube
+   * @param           derivDim          dimension in which the partial derivative is taken
+   * @param[out]      partialDerivative partial derivative of the linear combination
+   * @return                            value of the linear combination
+   */
+  template <class EVAL_1D>
+  double evalPartialDerivative(EVAL_1D& eval1D, const DataVector& alpha, const double* x,
+                               size_t derivDim, double& partialDerivative) const {
+    const size_t d = dimension;
+    Workspace workspace(d, 0);
+    workspace.orders[derivDim] = 1;
+    double result = 0.0;
+
+    partialDerivative = 0.0;
+
+    traverse(eval1D, x, workspace, [&](size_t i) {
+      const double curAlpha = alpha[i];
+      result += curAlpha * workspace.partialProducts[d];
+      partialDerivative += curAlpha * computePartialDerivativeTerm(workspace, derivDim);
+    });
+
+    return result;
+  }
+
+  /**
+   * @tparam          EVAL_1D           functor evaluating the 1D factors
+   * @param           eval1D            1D evaluation functor
+   * @param           alpha             coefficient matrix (each column is a coefficient vector)
+   * @param           x                 evaluation point in the unit cube
+   * @param           derivDim          dimension in which the partial derivative is taken
+   * @param[out]      value             values of the linear combinations
+   * @param[out]      partialDerivative partial derivatives of the linear combinations
+   */
+  template <class EVAL_1D>
+  void evalPartialDerivative(EVAL_1D& eval1D, const DataMatrix& alpha, const double* x,
+                             size_t derivDim, DataVector& value,
+                             DataVector& partialDerivative) const {
+    const size_t d = dimension;
+    const size_t m = alpha.getNcols();
+    Workspace workspace(d, 0);
+    workspace.orders[derivDim] = 1;
+
+    value.resize(m);
+    value.setAll(0.0);
+    partialDerivative.resize(m);
+    partialDerivative.setAll(0.0);
+
+    traverse(eval1D, x, workspace, [&](size_t i) {
+      const double curPartialDerivative = computePartialDerivativeTerm(workspace, derivDim);
+
+      for (size_t j = 0; j < m; j++) {
+        const double curAlpha = alpha(i, j);
+        value[j] += curAlpha * workspace.partialProducts[d];
+        partialDerivative[j] += curAlpha * curPartialDerivative;
+      }
+    });
+  }
+
+ private:
+  /**
+   * Temporary data of one evaluation.
+   */
+  struct Workspace {
+    Workspace(size_t dimension, size_t order)
+        : orders(dimension, order),
+          factors(3 * dimension, 0.0),
+          partialProducts(dimension + 1, 1.0),
+          suffixProducts(dimension + 1, 1.0),
+          gradient(dimension, 0.0),
+          hessian((order >= 2) ? dimension * dimension : 0, 0.0) {}
+
+    /// highest derivative that is required in each dimension
+    std::vector<size_t> orders;
+    /// 1D value, first and second derivative of the current grid point in each dimension
+    std::vector<double> factors;
+    /// partialProducts[t] is the product of the 1D values in the dimensions 0, ..., t - 1
+    std::vector<double> partialProducts;
+    /// suffixProducts[t] is the product of the 1D values in the dimensions t, ..., d - 1
+    std::vector<double> suffixProducts;
+    /// gradient of the current basis function
+    std::vector<double> gradient;
+    /// Hessian of the current basis function (row-major)
+    std::vector<double> hessian;
+  };
+
+  /// dimensionality
+  size_t dimension;
+  /// number of grid points
+  size_t gridSize;
+  /// whether prepare() was called
+  bool prepared;
+  /// storage of the sorted grid
+  const GridStorage* preparedStorage;
+  /// modification count of the storage when the grid was sorted
+  size_t preparedModificationCount;
+  /// sequence numbers of the sorted grid points
+  std::vector<size_t> order;
+  /// levels of the sorted grid points (row-wise)
+  std::vector<uint32_t> levels;
+  /// indices of the sorted grid points (row-wise)
+  std::vector<uint32_t> indices;
+  /// number of leading dimensions in which a sorted grid point equals its predecessor
+  std::vector<uint32_t> commonPrefix;
+  /**
+   * skip[k * dimension + t] is the first sorted position after k that differs from
+   * position k in one of the dimensions 0, ..., t
+   */
+  std::vector<uint32_t> skip;
+
+  void sortGrid(GridStorage& storage) {
+    if (gridSize >= static_cast<size_t>(UINT32_MAX)) {
+      throw operation_exception("AlgorithmEvaluationDerivativesPruned: grid too large");
+    }
+
+    order.resize(gridSize);
+    std::iota(order.begin(), order.end(), 0);
+
+    const size_t d = dimension;
+
+    std::sort(order.begin(), order.end(), [&storage, d](size_t a, size_t b) {
+      const GridPoint& gpA = storage[a];
+      const GridPoint& gpB = storage[b];
+
+      // (level, index) pairs dimension by dimension, such that every prefix is contiguous
+      for (size_t t = 0; t < d; t++) {
+        if (gpA.getLevel(t) != gpB.getLevel(t)) {
+          return gpA.getLevel(t) < gpB.getLevel(t);
+        }
+
+        if (gpA.getIndex(t) != gpB.getIndex(t)) {
+          return gpA.getIndex(t) < gpB.getIndex(t);
+        }
+      }
+
+      return false;
+    });
+
+    levels.resize(gridSize * d);
+    indices.resize(gridSize * d);
+
+    for (size_t k = 0; k < gridSize; k++) {
+      const GridPoint& gp = storage[order[k]];
+
+      for (size_t t = 0; t < d; t++) {
+        levels[k * d + t] = gp.getLevel(t);
+        indices[k * d + t] = gp.getIndex(t);
+      }
+    }
+
+    commonPrefix.assign(gridSize, 0);
+
+    for (size_t k = 1; k < gridSize; k++) {
+      uint32_t t = 0;
+
+      while ((t < d) && (levels[k * d + t] == levels[(k - 1) * d + t]) &&
+             (indices[k * d + t] == indices[(k - 1) * d + t])) {
+        t++;
+      }
+
+      commonPrefix[k] = t;
+    }
+
+    skip.resize(gridSize * d);
+
+    for (size_t k = gridSize; k-- > 0;) {
+      for (size_t t = 0; t < d; t++) {
+        if ((k + 1 == gridSize) || (commonPrefix[k + 1] <= t)) {
+          skip[k * d + t] = static_cast<uint32_t>(k + 1);
+        } else {
+          skip[k * d + t] = skip[(k + 1) * d + t];
+        }
+      }
+    }
+  }
+
+  /**
+   * Calls callback(seq) for every grid point for which at least one of the required
+   * derivatives does not vanish at x in any dimension. When the callback is called,
+   * workspace.factors contains the 1D factors of the grid point and
+   * workspace.partialProducts[d] its value.
+   */
+  template <class EVAL_1D, class CALLBACK>
+  inline void traverse(EVAL_1D& eval1D, const double* x, Workspace& workspace,
+                       CALLBACK callback) const {
+    if (!prepared) {
+      throw operation_exception(
+          "AlgorithmEvaluationDerivativesPruned: prepare() has to be called first");
+    }
+
+    const size_t d = dimension;
+    double* factors = workspace.factors.data();
+    double* partialProducts = workspace.partialProducts.data();
+    const size_t* orders = workspace.orders.data();
+    size_t k = 0;
+    size_t validPrefix = 0;
+
+    partialProducts[0] = 1.0;
+
+    while (k < gridSize) {
+      size_t t = std::min<size_t>(commonPrefix[k], validPrefix);
+      const uint32_t* curLevels = &levels[k * d];
+      const uint32_t* curIndices = &indices[k * d];
+
+      while (t < d) {
+        double* curFactors = &factors[3 * t];
+        eval1D(t, orders[t], curLevels[t], curIndices[t], x[t], curFactors);
+
+        bool vanishes = (curFactors[0] == 0.0);
+
+        for (size_t o = 1; vanishes && (o <= orders[t]); o++) {
+          vanishes = (curFactors[o] == 0.0);
+        }
+
+        if (vanishes) {
+          break;
+        }
+
+        partialProducts[t + 1] = partialProducts[t] * curFactors[0];
+        t++;
+      }
+
+      if (t < d) {
+        // all following grid points sharing dimensions 0, ..., t vanish, too
+        validPrefix = t;
+        k = skip[k * d + t];
+      } else {
+        callback(order[k]);
+        validPrefix = d;
+        k++;
+      }
+    }
+  }
+
+  /**
+   * Computes the gradient of the current basis function via prefix and suffix products.
+   */
+  inline void computeGradientTerms(Workspace& workspace) const {
+    const size_t d = dimension;
+    const double* factors = workspace.factors.data();
+    const double* partialProducts = workspace.partialProducts.data();
+    double* suffixProducts = workspace.suffixProducts.data();
+
+    suffixProducts[d] = 1.0;
+
+    for (size_t t = d; t-- > 0;) {
+      suffixProducts[t] = suffixProducts[t + 1] * factors[3 * t];
+    }
+
+    for (size_t t = 0; t < d; t++) {
+      workspace.gradient[t] = partialProducts[t] * factors[3 * t + 1] * suffixProducts[t + 1];
+    }
+  }
+
+  /**
+   * Computes the Hessian of the current basis function
+   * (computeGradientTerms() has to be called first).
+   */
+  inline void computeHessianTerms(Workspace& workspace) const {
+    const size_t d = dimension;
+    const double* factors = workspace.factors.data();
+    const double* partialProducts = workspace.partialProducts.data();
+    const double* suffixProducts = workspace.suffixProducts.data();
+    double* hessian = workspace.hessian.data();
+
+    for (size_t t = 0; t < d; t++) {
+      hessian[t * d + t] = partialProducts[t] * factors[3 * t + 2] * suffixProducts[t + 1];
+
+      // product of the factors in the dimensions 0, ..., t2 - 1 with dx in dimension t
+      double product = partialProducts[t] * factors[3 * t + 1];
+
+      for (size_t t2 = t + 1; t2 < d; t2++) {
+        const double entry = product * factors[3 * t2 + 1] * suffixProducts[t2 + 1];
+        hessian[t * d + t2] = entry;
+        hessian[t2 * d + t] = entry;
+        product *= factors[3 * t2];
+      }
+    }
+  }
+
+  /**
+   * @return partial derivative of the current basis function in dimension derivDim
+   */
+  inline double computePartialDerivativeTerm(const Workspace& workspace, size_t derivDim) const {
+    const double* factors = workspace.factors.data();
+    double result = workspace.partialProducts[derivDim] * factors[3 * derivDim + 1];
+
+    for (size_t t = derivDim + 1; t < dimension; t++) {
+      result *= factors[3 * t];
+    }
+
+    return result;
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMEVALUATIONDERIVATIVESPRUNED_HPP */
@@ -0,0 +1,392 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMMULTIPLEEVALUATIONBLOCKED_HPP
+#define ALGORITHMMULTIPLEEVALUATIONBLOCKED_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Multi-threaded, cache-blocked implementation of the mass evaluation (B^T alpha) and
+ * the transposed mass evaluation (B source) for arbitrary tensor product bases.
+ * It is used by the "Naive" multiple evaluation operations of grids with non-hierarchical
+ * evaluation (B-splines, polynomials).
+ *
+ * During prepare(), the grid points are sorted lexicographically by their levels and indices,
+ * dimension by dimension, such that all grid points of a subspace are stored contiguously
+ * and grid points sharing the same (level, index) pairs in the first dimensions are
+ * neighbors. The evaluation of a data point traverses this sorted list, reuses the partial
+ * products of the 1D factors of the common prefix and, if a 1D factor vanishes,
+ * skips all following grid points that share the same prefix (e.g., the remainder of the
+ * whole subspace if the factor in the first dimension vanishes).
+ *
+ * The sorted grid is kept until the grid is modified, while the data points are transformed
+ * into the unit cube in every call of prepare(). The work is tiled into blocks of data points
+ * and blocks of (sorted) grid points that are distributed among the OpenMP threads.
+ *
+ * mult() and multTranspose() also accept specialized bases with the same values as BASIS,
+ * e.g., the fixed-degree B-spline bases (FixedDegreeBsplineBasis), such that the compiler
+ * can inline the 1D evaluation into the traversal.
+ */
+template <class BASIS>
+class AlgorithmMultipleEvaluationBlocked {
+ public:
+  /// number of data points per block
+  static const size_t DATA_BLOCK_SIZE = 64;
+  /// maximal number of grid points per block
+  static const size_t GRID_BLOCK_SIZE = 2048;
+
+  AlgorithmMultipleEvaluationBlocked()
+      : dimension(0),
+        gridSize(0),
+        dataSize(0),
+        gridBlockSize(GRID_BLOCK_SIZE),
+        prepared(false),
+        preparedStorage(nullptr),
+        preparedModificationCount(0) {}
+
+  /**
+   * Sorts the grid if it has been modified since the last call (see
+   * HashGridStorage::getModificationCount()) and transforms the data points into the unit cube.
+   * The data points are transformed in every call (which is cheap compared to the evaluation),
+   * as the data set or the bounding box may have been changed in place.
+   * Has to be called before every call of mult() or multTranspose().
+   *
+   * @param storage   storage of the sparse grid
+   * @param dataset   data points (row-wise)
+   */
+  void prepare(GridStorage& storage, const DataMatrix& dataset) {
+    if (!prepared || (&storage != preparedStorage) ||
+        (storage.getModificationCount() != preparedModificationCount)) {
+      dimension = storage.getDimension();
+      gridSize = storage.getSize();
+      sortGrid(storage);
+
+#ifdef _OPENMP
+      const size_t numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+      const size_t numberOfThreads = 1;
+#endif
+      // make sure that there are enough grid blocks for all threads in multTranspose
+      gridBlockSize = std::max(static_cast<size_t>(64),
+                               std::min(GRID_BLOCK_SIZE, gridSize / (4 * numberOfThreads) + 1));
+
+      preparedStorage = &storage;
+      preparedModificationCount = storage.getModificationCount();
+      prepared = true;
+    }
+
+    dataSize = dataset.getNrows();
+    pointsInUnitCube = dataset;
+    storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+  }
+
+  /**
+   * Functor calling mult() with a given basis (see visitFixedDegreeBsplineBasis()).
+   */
+  struct MultVisitor {
+    typedef void result_type;
+    /// algorithm
+    AlgorithmMultipleEvaluationBlocked& algorithm;
+    /// coefficients of the grid points
+    const DataVector& alpha;
+    /// values at the data points
+    DataVector& result;
+
+    template <class EVAL_BASIS>
+    void operator()(EVAL_BASIS& basis) const {
+      algorithm.mult(basis, alpha, result);
+    }
+  };
+
+  /**
+   * Functor calling multTranspose() with a given basis (see visitFixedDegreeBsplineBasis()).
+   */
+  struct MultTransposeVisitor {
+    typedef void result_type;
+    /// algorithm
+    AlgorithmMultipleEvaluationBlocked& algorithm;
+    /// values at the data points
+    const DataVector& source;
+    /// coefficients of the grid points
+    DataVector& result;
+
+    template <class EVAL_BASIS>
+    void operator()(EVAL_BASIS& basis) const {
+      algorithm.multTranspose(basis, source, result);
+    }
+  };
+
+  /**
+   * Performs a mass evaluation.
+   *
+   * @tparam EVAL_BASIS   type of the 1D basis (BASIS or a specialization with identical values)
+   * @param basis         1D basis
+   * @param alpha         coefficients of the grid points
+   * @param result        values at the data points
+   */
+  template <class EVAL_BASIS>
+  void mult(EVAL_BASIS& basis, const DataVector& alpha, DataVector& result) {
+    checkPrepared();
+    result.resize(dataSize);
+    result.setAll(0.0);
+
+    const size_t numberOfDataBlocks = (dataSize + DATA_BLOCK_SIZE - 1) / DATA_BLOCK_SIZE;
+
+#pragma omp parallel
+    {
+      // some bases (e.g., Clenshaw-Curtis B-splines) use internal buffers during evaluation
+      EVAL_BASIS threadBasis(basis.getDegree());
+      std::vector<double> partialProducts(dimension + 1);
+
+#pragma omp for schedule(dynamic)
+      for (size_t dataBlock = 0; dataBlock < numberOfDataBlocks; dataBlock++) {
+        const size_t dataStart = dataBlock * DATA_BLOCK_SIZE;
+        const size_t dataEnd = std::min(dataStart + DATA_BLOCK_SIZE, dataSize);
+
+        for (size_t gridStart = 0; gridStart < gridSize; gridStart += gridBlockSize) {
+          const size_t gridEnd = std::min(gridStart + gridBlockSize, gridSize);
+
+          for (size_t j = dataStart; j < dataEnd; j++) {
+            const double* x = pointsInUnitCube.getPointer() + j * dimension;
+            double value = 0.0;
+
+            traverse(threadBasis, x, gridStart, gridEnd, partialProducts,
+                     [&value, &alpha](size_t i, double basisValue) {
+                       value += alpha[i] * basisValue;
+                     });
+
+            result[j] += value;
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Performs a transposed mass evaluation.
+   *
+   * @tparam EVAL_BASIS   type of the 1D basis (BASIS or a specialization with identical values)
+   * @param basis         1D basis
+   * @param source        values at the data points
+   * @param result        coefficients of the grid points
+   */
+  template <class EVAL_BASIS>
+  void multTranspose(EVAL_BASIS& basis, const DataVector& source, DataVector& result) {
+    checkPrepared();
+    result.resize(gridSize);
+    result.setAll(0.0);
+
+    const size_t numberOfGridBlocks = (gridSize + gridBlockSize - 1) / gridBlockSize;
+
+#pragma omp parallel
+    {
+      EVAL_BASIS threadBasis(basis.getDegree());
+      std::vector<double> partialProducts(dimension + 1);
+
+      // every grid block writes to a disjoint set of result entries, no reduction needed
+#pragma omp for schedule(dynamic)
+      for (size_t gridBlock = 0; gridBlock < numberOfGridBlocks; gridBlock++) {
+        const size_t gridStart = gridBlock * gridBlockSize;
+        const size_t gridEnd = std::min(gridStart + gridBlockSize, gridSize);
+
+        for (size_t dataStart = 0; dataStart < dataSize; dataStart += DATA_BLOCK_SIZE) {
+          const size_t dataEnd = std::min(dataStart + DATA_BLOCK_SIZE, dataSize);
+
+          for (size_t j = dataStart; j < dataEnd; j++) {
+            const double* x = pointsInUnitCube.getPointer() + j * dimension;
+            const double sourceValue = source[j];
+
+            if (sourceValue == 0.0) {
+              continue;
+            }
+
+            traverse(threadBasis, x, gridStart, gridEnd, partialProducts,
+                     [&result, sourceValue](size_t i, double basisValue) {
+                       result[i] += sourceValue * basisValue;
+                     });
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  /// dimensionality
+  size_t dimension;
+  /// number of grid points
+  size_t gridSize;
+  /// number of data points
+  size_t dataSize;
+  /// number of grid points per block
+  size_t gridBlockSize;
+  /// whether prepare() was called
+  bool prepared;
+  /// storage of the sorted grid
+  const GridStorage* preparedStorage;
+  /// modification count of the storage when the grid was sorted
+  size_t preparedModificationCount;
+  /// data points transformed into the unit cube (row-wise)
+  DataMatrix pointsInUnitCube;
+  /// sequence numbers of the sorted grid points
+  std::vector<size_t> order;
+  /// levels of the sorted grid points (row-wise)
+  std::vector<uint32_t> levels;
+  /// indices of the sorted grid points (row-wise)
+  std::vector<uint32_t> indices;
+  /// number of leading dimensions in which a sorted grid point equals its predecessor
+  std::vector<uint32_t> commonPrefix;
+  /**
+   * skip[k * dimension + t] is the first sorted position after k that differs from
+   * position k in one of the dimensions 0, ..., t
+   */
+  std::vector<uint32_t> skip;
+
+  void checkPrepared() const {
+    if (!prepared) {
+      throw operation_exception(
+          "AlgorithmMultipleEvaluationBlocked: prepare() has to be called first");
+    }
+  }
+
+  void sortGrid(GridStorage& storage) {
+    if (gridSize >= static_cast<size_t>(UINT32_MAX)) {
+      throw operation_exception("AlgorithmMultipleEvaluationBlocked: grid too large");
+    }
+
+    order.resize(gridSize);
+    std::iota(order.begin(), order.end(), 0);
+
+    const size_t d = dimension;
+
+    std::sort(order.begin(), order.end(), [&storage, d](size_t a, size_t b) {
+      const GridPoint& gpA = storage[a];
+      const GridPoint& gpB = storage[b];
+
+      // subspaces first, then indices within the subspace
+      for (size_t t = 0; t < d; t++) {
+        if (gpA.getLevel(t) != gpB.getLevel(t)) {
+          return gpA.getLevel(t) < gpB.getLevel(t);
+        }
+      }
+
+      for (size_t t = 0; t < d; t++) {
+        if (gpA.getIndex(t) != gpB.getIndex(t)) {
+          return gpA.getIndex(t) < gpB.getIndex(t);
+        }
+      }
+
+      return false;
+    });
+
+    levels.resize(gridSize * d);
+    indices.resize(gridSize * d);
+
+    for (size_t k = 0; k < gridSize; k++) {
+      const GridPoint& gp = storage[order[k]];
+
+      for (size_t t = 0; t < d; t++) {
+        levels[k * d + t] = gp.getLevel(t);
+        indices[k * d + t] = gp.getIndex(t);
+      }
+    }
+
+    // the traversal compares (level, index) pairs dimension by dimension,
+    // which is consistent with the sorting within each subspace
+    commonPrefix.assign(gridSize, 0);
+
+    for (size_t k = 1; k < gridSize; k++) {
+      uint32_t t = 0;
+
+      while ((t < d) && (levels[k * d + t] == levels[(k - 1) * d + t]) &&
+             (indices[k * d + t] == indices[(k - 1) * d + t])) {
+        t++;
+      }
+
+      commonPrefix[k] = t;
+    }
+
+    skip.resize(gridSize * d);
+
+    for (size_t k = gridSize; k-- > 0;) {
+      for (size_t t = 0; t < d; t++) {
+        if ((k + 1 == gridSize) || (commonPrefix[k + 1] <= t)) {
+          skip[k * d + t] = static_cast<uint32_t>(k + 1);
+        } else {
+          skip[k * d + t] = skip[(k + 1) * d + t];
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluates all basis functions of the sorted grid points gridStart, ..., gridEnd - 1
+   * at x and calls callback(seq, value) for every non-zero value.
+   */
+  template <class EVAL_BASIS, class CALLBACK>
+  inline void traverse(EVAL_BASIS& threadBasis, const double* x, size_t gridStart, size_t gridEnd,
+                       std::vector<double>& partialProducts, CALLBACK callback) {
+    const size_t d = dimension;
+    partialProducts[0] = 1.0;
+    size_t k = gridStart;
+    // the partial products are invalid at the beginning of a block
+    size_t validPrefix = 0;
+
+    while (k < gridEnd) {
+      size_t t = std::min<size_t>(commonPrefix[k], validPrefix);
+      const uint32_t* curLevels = &levels[k * d];
+      const uint32_t* curIndices = &indices[k * d];
+
+      while (t < d) {
+        const double val1d = threadBasis.eval(curLevels[t], curIndices[t], x[t]);
+
+        if (val1d == 0.0) {
+          break;
+        }
+
+        partialProducts[t + 1] = partialProducts[t] * val1d;
+        t++;
+      }
+
+      if (t < d) {
+        // all following grid points sharing dimensions 0, ..., t vanish, too
+        validPrefix = t;
+        k = skip[k * d + t];
+      } else {
+        callback(order[k], partialProducts[d]);
+        validPrefix = d;
+        k++;
+      }
+    }
+  }
+};
+
+template <class BASIS>
+const size_t AlgorithmMultipleEvaluationBlocked<BASIS>::DATA_BLOCK_SIZE;
+template <class BASIS>
+const size_t AlgorithmMultipleEvaluationBlocked<BASIS>::GRID_BLOCK_SIZE;
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMMULTIPLEEVALUATIONBLOCKED_HPP */
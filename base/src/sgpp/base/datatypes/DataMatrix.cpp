@@ -452,14 +452,22 @@ void DataMatrix::mult(const DataVector& x, DataVector& y) const {
     throw sgpp::base::data_exception("DataMatrix::mult : Dimensions do not match (y)");
   }
 
+  const double* matrixData = this->data();
+  const double* xData = x.getPointer();
+  double* yData = y.getPointer();
+  const size_t n = ncols;
+
+#pragma omp parallel for schedule(static)
   for (size_t i = 0; i < nrows; ++i) {
+    const double* row = matrixData + i * n;
     double entry = 0.0;
 
-    for (size_t j = 0; j < ncols; ++j) {
-      entry += (*this)[(i * ncols) + j] * x[j];
+#pragma omp simd reduction(+ : entry)
+    for (size_t j = 0; j < n; ++j) {
+      entry += row[j] * xData[j];
     }
 
-    y[i] = entry;
+    yData[i] = entry;
   }
 }
 
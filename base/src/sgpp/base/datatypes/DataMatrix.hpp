@@ -411,7 +411,7 @@ class DataMatrix : public std::vector<double> {
 
   /**
    * Multiplies the matrix with a vector x and stores the result
-   * in another vector y.
+   * in another vector y. The rows are processed in parallel with OpenMP.
    *
    * @param[in] x vector to be multiplied
    * @param[out] y vector in which the result should be stored
@@ -0,0 +1,125 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/SymmetricPackedMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+SymmetricPackedMatrix::SymmetricPackedMatrix(size_t size) : size(0) { resize(size); }
+
+SymmetricPackedMatrix::SymmetricPackedMatrix(const DataMatrix& matrix) : size(0) {
+  if (matrix.getNrows() != matrix.getNcols()) {
+    throw data_exception("SymmetricPackedMatrix::SymmetricPackedMatrix : Matrix is not square");
+  }
+
+  resize(matrix.getNrows());
+
+  for (size_t i = 0; i < size; i++) {
+    std::copy(matrix.data() + i * size + i, matrix.data() + (i + 1) * size,
+              data.begin() + getRowOffset(i) + i);
+  }
+}
+
+void SymmetricPackedMatrix::resize(size_t size) {
+  this->size = size;
+  data.assign(size * (size + 1) / 2, 0.0);
+}
+
+void SymmetricPackedMatrix::setAll(double value) { std::fill(data.begin(), data.end(), value); }
+
+void SymmetricPackedMatrix::mult(const DataVector& x, DataVector& y) const {
+  if (size != x.getSize()) {
+    throw data_exception("SymmetricPackedMatrix::mult : Dimensions do not match (x)");
+  }
+
+  if (size != y.getSize()) {
+    throw data_exception("SymmetricPackedMatrix::mult : Dimensions do not match (y)");
+  }
+
+  const double* xData = x.getPointer();
+  double* yData = y.getPointer();
+  const double* matrixData = data.data();
+  const size_t n = size;
+
+  // Every stored entry (i, j) with j > i contributes to y_i and y_j, so each row is read only
+  // once. The contributions to y_j of other rows are accumulated in thread-local parts of
+  // partialResults, which are summed up in a fixed order afterwards to keep the
+  // result deterministic.
+#ifdef _OPENMP
+  const size_t maxNumberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t maxNumberOfThreads = 1;
+#endif
+
+  // the scratch space is kept between calls and only grows
+  if (partialResults.size() < maxNumberOfThreads * n) {
+    partialResults.resize(maxNumberOfThreads * n);
+  }
+
+#pragma omp parallel
+  {
+#ifdef _OPENMP
+    const size_t threadNumber = static_cast<size_t>(omp_get_thread_num());
+    const size_t numberOfThreads = static_cast<size_t>(omp_get_num_threads());
+#else
+    const size_t threadNumber = 0;
+    const size_t numberOfThreads = 1;
+#endif
+    double* partialResult = partialResults.data() + threadNumber * n;
+    std::fill(partialResult, partialResult + n, 0.0);
+
+    // rows get shorter with increasing i, therefore the schedule is dynamic
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < n; i++) {
+      const double* row = matrixData + getRowOffset(i);
+      const double xi = xData[i];
+      double sum = 0.0;
+
+#pragma omp simd reduction(+ : sum)
+      for (size_t j = i + 1; j < n; j++) {
+        sum += row[j] * xData[j];
+        partialResult[j] += row[j] * xi;
+      }
+
+      partialResult[i] += row[i] * xi + sum;
+    }
+
+#pragma omp for schedule(static)
+    for (size_t j = 0; j < n; j++) {
+      double sum = 0.0;
+
+      for (size_t t = 0; t < numberOfThreads; t++) {
+        sum += partialResults[t * n + j];
+      }
+
+      yData[j] = sum;
+    }
+  }
+}
+
+void SymmetricPackedMatrix::toDataMatrix(DataMatrix& matrix) const {
+  matrix.resizeRowsCols(size, size);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = i; j < size; j++) {
+      matrix.set(i, j, data[getRowOffset(i) + j]);
+      matrix.set(j, i, data[getRowOffset(i) + j]);
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,136 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SYMMETRICPACKEDMATRIX_HPP
+#define SYMMETRICPACKEDMATRIX_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Symmetric square matrix of which only the upper triangle is stored
+ * (row by row, i.e., row \f$i\f$ contains the entries \f$(i, i), (i, i+1), \dotsc, (i, n-1)\f$).
+ * This needs roughly half of the memory of a DataMatrix of the same size,
+ * which also halves the memory traffic of matrix-vector products.
+ */
+class SymmetricPackedMatrix {
+ public:
+  /**
+   * Constructor, creates a zero matrix.
+   *
+   * @param size  number of rows (and columns)
+   */
+  explicit SymmetricPackedMatrix(size_t size = 0);
+
+  /**
+   * Constructor, copies the upper triangle of a square DataMatrix.
+   * The lower triangle is ignored.
+   *
+   * @param matrix  square matrix
+   */
+  explicit SymmetricPackedMatrix(const DataMatrix& matrix);
+
+  /**
+   * Resizes the matrix and sets all entries to zero.
+   *
+   * @param size  new number of rows (and columns)
+   */
+  void resize(size_t size);
+
+  /**
+   * @return number of rows (and columns)
+   */
+  inline size_t getSize() const { return size; }
+
+  /**
+   * @return number of stored entries, i.e., \f$n (n+1) / 2\f$
+   */
+  inline size_t getNumberOfEntries() const { return data.size(); }
+
+  /**
+   * @param i row
+   * @param j column
+   * @return entry \f$(i, j)\f$ (which is equal to entry \f$(j, i)\f$)
+   */
+  inline double get(size_t i, size_t j) const {
+    return (i <= j) ? data[getRowOffset(i) + j] : data[getRowOffset(j) + i];
+  }
+
+  /**
+   * Sets both entries \f$(i, j)\f$ and \f$(j, i)\f$.
+   *
+   * @param i     row
+   * @param j     column
+   * @param value new value
+   */
+  inline void set(size_t i, size_t j, double value) {
+    if (i <= j) {
+      data[getRowOffset(i) + j] = value;
+    } else {
+      data[getRowOffset(j) + i] = value;
+    }
+  }
+
+  /**
+   * Sets all entries to a value.
+   *
+   * @param value new value
+   */
+  void setAll(double value);
+
+  /**
+   * @return pointer to the packed entries
+   */
+  inline double* getPointer() { return data.data(); }
+
+  /**
+   * @return pointer to the packed entries
+   */
+  inline const double* getPointer() const { return data.data(); }
+
+  /**
+   * Multiplies the matrix with a vector x and stores the result in another vector y.
+   * The product is computed in parallel with OpenMP. The scratch space for the threads is
+   * kept between calls, therefore mult() must not be called concurrently for the same matrix.
+   *
+   * @param[in] x   vector to be multiplied
+   * @param[out] y  vector in which the result should be stored
+   */
+  void mult(const DataVector& x, DataVector& y) const;
+
+  /**
+   * Copies the matrix into a (full) DataMatrix.
+   *
+   * @param[out] matrix  full matrix (will be resized)
+   */
+  void toDataMatrix(DataMatrix& matrix) const;
+
+ private:
+  /// number of rows (and columns)
+  size_t size;
+  /// packed upper triangle
+  std::vector<double> data;
+  /// thread-local parts of the result of mult() (scratch space)
+  mutable std::vector<double> partialResults;
+
+  /**
+   * @param i row
+   * @return offset such that entry \f$(i, j)\f$ for \f$j \ge i\f$ is stored
+   *         at data[getRowOffset(i) + j]
+   */
+  inline size_t getRowOffset(size_t i) const { return i * size - i * (i + 1) / 2; }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* SYMMETRICPACKEDMATRIX_HPP */
@@ -7,11 +7,14 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
 #include <cstring>
 #include <limits>
@@ -70,6 +73,53 @@ class InterpolantScalarFunction : public ScalarFunction {
     return opEval->eval(alpha, x);
   }
 
+  /**
+   * Evaluation of the function at multiple points at once.
+   * The points inside the domain are evaluated with an OperationMultipleEval (in parallel),
+   * if the grid type does not support it, the points are evaluated in parallel one by one.
+   *
+   * @param      x      matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                    of evaluation points (row-wise)
+   * @param[out] value  \f$(f(\vec{x}_k))_k\f$
+   *                    where \f$\vec{x}_k\f$ is the \f$k\f$-th row of \f$x\f$
+   */
+  void eval(const DataMatrix& x, DataVector& value) override {
+    evalInDomain(x, value, [this](const DataMatrix& xInDomain, DataVector& valueInDomain) {
+      // the operation requires a mutable dataset
+      DataMatrix points(xInDomain);
+      std::unique_ptr<OperationMultipleEval> opMultipleEval;
+
+      try {
+        opMultipleEval.reset(op_factory::createOperationMultipleEvalNaive(grid, points));
+      } catch (factory_exception&) {
+      }
+
+      if (opMultipleEval) {
+        opMultipleEval->eval(alpha, valueInDomain);
+        return;
+      }
+
+      const size_t N = xInDomain.getNrows();
+
+#pragma omp parallel
+      {
+        std::unique_ptr<OperationEval> curOpEval(op_factory::createOperationEvalNaive(grid));
+        DataVector xk(d);
+
+#pragma omp for schedule(dynamic)
+        for (size_t k = 0; k < N; k++) {
+          xInDomain.getRow(k, xk);
+          valueInDomain[k] = curOpEval->eval(alpha, xk);
+        }
+      }
+    });
+  }
+
+  /**
+   * @return true, the points are evaluated in parallel
+   */
+  bool isBatchEvalParallel() const override { return true; }
+
   /**
    * @param[out] clone pointer to cloned object
    */
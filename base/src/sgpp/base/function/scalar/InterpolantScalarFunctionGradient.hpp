@@ -7,6 +7,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/function/scalar/ScalarFunctionGradient.hpp>
 #include <sgpp/base/grid/Grid.hpp>
@@ -14,6 +15,7 @@
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 
 #include <limits>
+#include <memory>
 
 namespace sgpp {
 namespace base {
@@ -62,6 +64,50 @@ class InterpolantScalarFunctionGradient : public ScalarFunctionGradient {
     return opEvalGradient->evalGradient(alpha, x, gradient);
   }
 
+  /**
+   * Evaluation of the function and its gradient at multiple points at once.
+   * The points are evaluated in parallel, every thread uses its own evaluation operation.
+   *
+   * @param      x        matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                      of evaluation points (row-wise)
+   * @param[out] value    vector of size \f$N\f$, where the \f$k\f$-th
+   *                      entry is \f$f(\vec{x}_k)\f$
+   * @param[out] gradient matrix of size \f$N \times d\f$
+   *                      where the \f$k\f$-th row is
+   *                      \f$\nabla f(\vec{x}_k)\f$
+   */
+  void eval(const DataMatrix& x, DataVector& value, DataMatrix& gradient) override {
+    const size_t N = x.getNrows();
+    value.resize(N);
+    gradient.resize(N, d);
+
+#pragma omp parallel
+    {
+      std::unique_ptr<OperationEvalGradient> curOpEvalGradient(
+          op_factory::createOperationEvalGradientNaive(grid));
+      DataVector xk(d);
+      DataVector gradientk(d);
+
+#pragma omp for schedule(dynamic)
+      for (size_t k = 0; k < N; k++) {
+        x.getRow(k, xk);
+        gradientk.setAll(0.0);
+        bool inDomain = true;
+
+        for (size_t t = 0; t < d; t++) {
+          if ((xk[t] < 0.0) || (xk[t] > 1.0)) {
+            inDomain = false;
+            break;
+          }
+        }
+
+        value[k] = (inDomain ? curOpEvalGradient->evalGradient(alpha, xk, gradientk)
+                             : std::numeric_limits<double>::infinity());
+        gradient.setRow(k, gradientk);
+      }
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
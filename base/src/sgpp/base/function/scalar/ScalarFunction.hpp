@@ -9,8 +9,11 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -61,6 +64,59 @@ class ScalarFunction {
     }
   }
 
+  /**
+   * @return whether eval(const DataMatrix&, DataVector&) evaluates the points in parallel
+   *         (if not, callers may evaluate parts of the points in parallel with clones)
+   */
+  virtual bool isBatchEvalParallel() const { return false; }
+
+  /**
+   * Evaluates multiple points at once, where only the points inside of \f$[0, 1]^d\f$
+   * are passed to the given evaluation function.
+   * The function values of the other points are set to infinity.
+   *
+   * @param      x          evaluation points (row-wise)
+   * @param[out] value      function values at the evaluation points
+   * @param      evalPoints functor with signature
+   *                        void(const DataMatrix& x, DataVector& value)
+   *                        that evaluates points in the domain
+   */
+  template <class EVAL_POINTS>
+  static void evalInDomain(const DataMatrix& x, DataVector& value, EVAL_POINTS evalPoints) {
+    const size_t N = x.getNrows();
+    const size_t d = x.getNcols();
+    std::vector<size_t> inDomain;
+    value.resize(N);
+
+    for (size_t k = 0; k < N; k++) {
+      const double* xk = x.data() + k * d;
+
+      if (std::all_of(xk, xk + d, [](double xt) { return (xt >= 0.0) && (xt <= 1.0); })) {
+        inDomain.push_back(k);
+      } else {
+        value[k] = std::numeric_limits<double>::infinity();
+      }
+    }
+
+    if (inDomain.size() == N) {
+      evalPoints(x, value);
+    } else if (!inDomain.empty()) {
+      DataMatrix xInDomain(inDomain.size(), d);
+      DataVector valueInDomain(inDomain.size());
+
+      for (size_t i = 0; i < inDomain.size(); i++) {
+        std::copy(x.data() + inDomain[i] * d, x.data() + (inDomain[i] + 1) * d,
+                  xInDomain.data() + i * d);
+      }
+
+      evalPoints(xInDomain, valueInDomain);
+
+      for (size_t i = 0; i < inDomain.size(); i++) {
+        value[inDomain[i]] = valueInDomain[i];
+      }
+    }
+  }
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
@@ -0,0 +1,279 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/FlatGridStorage.hpp>
+
+#include <sgpp/base/exception/generation_exception.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+bool FlatGridPointView::isInnerPoint() const {
+  for (size_t d = 0; d < storage->getDimension(); d++) {
+    if (storage->getLevel(seq, d) == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+FlatGridPointView::level_type FlatGridPointView::getLevelSum() const {
+  level_type levelSum = 0;
+
+  for (size_t d = 0; d < storage->getDimension(); d++) {
+    levelSum += storage->getLevel(seq, d);
+  }
+
+  return levelSum;
+}
+
+FlatGridPointView::level_type FlatGridPointView::getLevelMax() const {
+  level_type levelMax = 0;
+
+  for (size_t d = 0; d < storage->getDimension(); d++) {
+    levelMax = std::max(levelMax, storage->getLevel(seq, d));
+  }
+
+  return levelMax;
+}
+
+void FlatGridPointView::toHashGridPoint(HashGridPoint& point) const {
+  const size_t dimension = storage->getDimension();
+
+  if (point.getDimension() != dimension) {
+    point = HashGridPoint(dimension);
+  }
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.push(d, storage->getLevel(seq, d), storage->getIndex(seq, d));
+  }
+
+  point.setLeaf(storage->isLeaf(seq));
+  point.rehash();
+}
+
+std::string FlatGridPointView::toString() const {
+  std::ostringstream stream;
+  stream << "[";
+
+  for (size_t d = 0; d < storage->getDimension(); d++) {
+    if (d != 0) {
+      stream << ",";
+    }
+
+    stream << " " << storage->getLevel(seq, d);
+    stream << ", " << storage->getIndex(seq, d);
+  }
+
+  stream << " ]";
+  return stream.str();
+}
+
+FlatGridStorage::FlatGridStorage(size_t dimension)
+    : dimension(dimension),
+      numberOfPoints(0),
+      capacity(0),
+      level(),
+      index(),
+      leaf(),
+      hashes(),
+      table() {
+  rebuildTable(4);
+}
+
+FlatGridStorage::FlatGridStorage(const HashGridStorage& storage)
+    : FlatGridStorage(storage.getDimension()) {
+  const size_t numberOfGridPoints = storage.getSize();
+  reserve(numberOfGridPoints);
+
+  // size the hash table once instead of growing it step by step
+  rebuildTable(GridPointHashTable::getRequiredTableBits(numberOfGridPoints));
+
+  for (size_t i = 0; i < numberOfGridPoints; i++) {
+    insert(storage[i]);
+  }
+}
+
+void FlatGridStorage::clear() {
+  numberOfPoints = 0;
+  capacity = 0;
+  level.clear();
+  index.clear();
+  leaf.clear();
+  hashes.clear();
+  rebuildTable(4);
+}
+
+void FlatGridStorage::reserve(size_t newCapacity) {
+  if (newCapacity <= capacity) {
+    return;
+  }
+
+  // the arrays are dimension-major, so every dimension's block has to be moved
+  std::vector<level_type> newLevel(dimension * newCapacity);
+  std::vector<index_type> newIndex(dimension * newCapacity);
+
+  for (size_t d = 0; d < dimension; d++) {
+    std::copy(level.begin() + d * capacity, level.begin() + d * capacity + numberOfPoints,
+              newLevel.begin() + d * newCapacity);
+    std::copy(index.begin() + d * capacity, index.begin() + d * capacity + numberOfPoints,
+              newIndex.begin() + d * newCapacity);
+  }
+
+  level.swap(newLevel);
+  index.swap(newIndex);
+  leaf.resize(newCapacity);
+  hashes.resize(newCapacity);
+  capacity = newCapacity;
+}
+
+size_t FlatGridStorage::insert(const HashGridPoint& point) {
+  std::vector<level_type> pointLevel(dimension);
+  std::vector<index_type> pointIndex(dimension);
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, pointLevel[d], pointIndex[d]);
+  }
+
+  return insert(pointLevel.data(), pointIndex.data(), point.isLeaf());
+}
+
+size_t FlatGridStorage::insert(const level_type* level, const index_type* index, bool isLeaf) {
+  if (numberOfPoints >= static_cast<size_t>(GridPointHashTable::emptySlot)) {
+    throw generation_exception("FlatGridStorage::insert: too many grid points");
+  }
+
+  // keep the load factor of the hash table below 1/2
+  if (2 * (numberOfPoints + 1) > table.getNumberOfSlots()) {
+    rebuildTable(table.getTableBits() + 1);
+  }
+
+  const size_t hash = GridPointHashTable::computeHash(dimension, level, index);
+  const size_t slot = findSlot(hash, level, index);
+
+  if (table[slot] != GridPointHashTable::emptySlot) {
+    return table[slot];
+  }
+
+  if (numberOfPoints == capacity) {
+    reserve(std::max(static_cast<size_t>(16), 2 * capacity));
+  }
+
+  const size_t seq = numberOfPoints;
+
+  for (size_t d = 0; d < dimension; d++) {
+    this->level[d * capacity + seq] = level[d];
+    this->index[d * capacity + seq] = index[d];
+  }
+
+  leaf[seq] = isLeaf ? 1 : 0;
+  hashes[seq] = hash;
+  table.setSlot(slot, seq);
+  numberOfPoints++;
+
+  return seq;
+}
+
+bool FlatGridStorage::isContaining(const HashGridPoint& point) const {
+  return getSequenceNumber(point) < numberOfPoints;
+}
+
+size_t FlatGridStorage::getSequenceNumber(const HashGridPoint& point) const {
+  std::vector<level_type> pointLevel(dimension);
+  std::vector<index_type> pointIndex(dimension);
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, pointLevel[d], pointIndex[d]);
+  }
+
+  return getSequenceNumber(pointLevel.data(), pointIndex.data());
+}
+
+size_t FlatGridStorage::getSequenceNumber(const level_type* level,
+                                          const index_type* index) const {
+  const size_t slot =
+      findSlot(GridPointHashTable::computeHash(dimension, level, index), level, index);
+
+  if (table[slot] == GridPointHashTable::emptySlot) {
+    return numberOfPoints + 1;
+  } else {
+    return table[slot];
+  }
+}
+
+void FlatGridStorage::toHashGridStorage(HashGridStorage& storage) const {
+  if (storage.getDimension() != dimension) {
+    throw generation_exception("FlatGridStorage::toHashGridStorage: dimension mismatch");
+  }
+
+  storage.reserve(storage.getSize() + numberOfPoints);
+
+  HashGridPoint point(dimension);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    getPoint(i).toHashGridPoint(point);
+    storage.insert(point);
+  }
+}
+
+void FlatGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) const {
+  level.resize(numberOfPoints, dimension);
+  index.resize(numberOfPoints, dimension);
+
+  for (size_t d = 0; d < dimension; d++) {
+    const level_type* curLevel = getLevelArray(d);
+    const index_type* curIndex = getIndexArray(d);
+
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      level.set(i, d, static_cast<double>(static_cast<index_type>(1) << curLevel[i]));
+      index.set(i, d, static_cast<double>(curIndex[i]));
+    }
+  }
+}
+
+size_t FlatGridStorage::getMaxLevel() const {
+  level_type maxLevel = 0;
+
+  for (size_t d = 0; d < dimension; d++) {
+    const level_type* curLevel = getLevelArray(d);
+
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      maxLevel = std::max(maxLevel, curLevel[i]);
+    }
+  }
+
+  return static_cast<size_t>(maxLevel);
+}
+
+size_t FlatGridStorage::findSlot(size_t hash, const level_type* level,
+                                 const index_type* index) const {
+  return table.findSlot(hash, [this, hash, level, index](size_t seq) {
+    if (hashes[seq] != hash) {
+      return false;
+    }
+
+    for (size_t d = 0; d < dimension; d++) {
+      if ((this->level[d * capacity + seq] != level[d]) ||
+          (this->index[d * capacity + seq] != index[d])) {
+        return false;
+      }
+    }
+
+    return true;
+  });
+}
+
+void FlatGridStorage::rebuildTable(size_t newTableBits) {
+  table.rebuild(newTableBits, numberOfPoints, [this](size_t seq) { return hashes[seq]; });
+}
+
+}  // namespace base
+}  // namespace sgpp
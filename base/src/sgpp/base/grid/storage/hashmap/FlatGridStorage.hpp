@@ -0,0 +1,388 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef FLATGRIDSTORAGE_HPP
+#define FLATGRIDSTORAGE_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/storage/hashmap/GridPointHashTable.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+class FlatGridStorage;
+
+/**
+ * Lightweight, non-owning view of a single grid point stored in a FlatGridStorage.
+ * It offers the read-only part of the HashGridPoint interface, but does not hold any
+ * level/index data itself. Views are invalidated if the underlying storage grows.
+ */
+class FlatGridPointView {
+ public:
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+
+  /**
+   * Constructor
+   *
+   * @param storage storage that contains the grid point
+   * @param seq     sequence number of the grid point
+   */
+  FlatGridPointView(const FlatGridStorage& storage, size_t seq) : storage(&storage), seq(seq) {}
+
+  /**
+   * @return the dimension of the grid point
+   */
+  inline size_t getDimension() const;
+
+  /**
+   * @return the sequence number of the grid point in its storage
+   */
+  inline size_t getSequenceNumber() const { return seq; }
+
+  /**
+   * gets level <i>l</i> and index <i>i</i> in dimension <i>d</i> by reference parameters
+   *
+   * @param d the dimension in which the ansatz function should be read
+   * @param l reference parameter for the level of the ansatz function
+   * @param i reference parameter for the index of the ansatz function
+   */
+  inline void get(size_t d, level_type& l, index_type& i) const;
+
+  /**
+   * @param d dimension
+   * @return level in dimension <i>d</i>
+   */
+  inline level_type getLevel(size_t d) const;
+
+  /**
+   * @param d dimension
+   * @return index in dimension <i>d</i>
+   */
+  inline index_type getIndex(size_t d) const;
+
+  /**
+   * determines the coordinate in a given dimension without bounding box and stretching
+   *
+   * @param d the dimension in which the coordinate should be calculated
+   * @return the coordinate in the given dimension
+   */
+  inline double getStandardCoordinate(size_t d) const;
+
+  /**
+   * @return true if the grid point has no children
+   */
+  inline bool isLeaf() const;
+
+  /**
+   * @return the hash value of the grid point (identical to HashGridPoint::getHash)
+   */
+  inline size_t getHash() const;
+
+  /**
+   * @return true if the grid point is an inner grid point
+   */
+  bool isInnerPoint() const;
+
+  /**
+   * @return the sum of the one-dimensional levels
+   */
+  level_type getLevelSum() const;
+
+  /**
+   * @return the maximum of the one-dimensional levels
+   */
+  level_type getLevelMax() const;
+
+  /**
+   * Copies level, index and leaf property into a HashGridPoint.
+   *
+   * @param[out] point grid point that is resized and overwritten
+   */
+  void toHashGridPoint(HashGridPoint& point) const;
+
+  /**
+   * Generates a string with level and index of the gridpoint.
+   * The format is <tt>[l1, i1, l2, i2, ..., ld, id]</tt>.
+   *
+   * @return string into which the gridpoint is written
+   */
+  std::string toString() const;
+
+ private:
+  /// storage that contains the grid point
+  const FlatGridStorage* storage;
+  /// sequence number of the grid point
+  size_t seq;
+};
+
+/**
+ * Hash table based storage of grid points with a structure of arrays layout.
+ *
+ * In contrast to HashGridStorage, which stores one heap-allocated HashGridPoint per grid point
+ * and indexes them in an std::unordered_map, this storage keeps levels and indices in two
+ * contiguous dimension-major arrays (all levels of dimension 0, then all levels of
+ * dimension 1, ...) and looks up grid points with a compact open addressing hash table
+ * (GridPointHashTable). Grid points are accessed through FlatGridPointView objects.
+ *
+ * The storage can be constructed from a HashGridStorage and converted back into one.
+ * Evaluation kernels can take a snapshot of a grid in this layout to stream over the levels
+ * and indices of one dimension at a time (e.g., OperationMultipleEvalLinearNaive and
+ * OperationMultipleEvalLinearBoundaryNaive); grids and the other operations still use
+ * HashGridStorage.
+ */
+class FlatGridStorage {
+ public:
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+  /// type of grid point views
+  typedef FlatGridPointView point_view;
+
+  /**
+   * Constructor
+   *
+   * @param dimension the dimension of the sparse grid
+   */
+  explicit FlatGridStorage(size_t dimension);
+
+  /**
+   * Constructor that copies all grid points (in the same order) of a HashGridStorage
+   *
+   * @param storage storage to copy
+   */
+  explicit FlatGridStorage(const HashGridStorage& storage);
+
+  /**
+   * deletes all grid points in the storage
+   */
+  void clear();
+
+  /**
+   * Reserves memory for a given number of grid points.
+   *
+   * @param newCapacity number of grid points for which memory is reserved
+   */
+  void reserve(size_t newCapacity);
+
+  /**
+   * Inserts a new grid point. If the point is already contained in the storage,
+   * nothing is inserted.
+   *
+   * @param point grid point that should be inserted
+   * @return sequence number of the grid point
+   */
+  size_t insert(const HashGridPoint& point);
+
+  /**
+   * Inserts a new grid point given by its levels and indices. If the point is already contained
+   * in the storage, nothing is inserted.
+   *
+   * @param level  array of levels (length: dimension)
+   * @param index  array of indices (length: dimension)
+   * @param isLeaf leaf property of the new grid point
+   * @return sequence number of the grid point
+   */
+  size_t insert(const level_type* level, const index_type* index, bool isLeaf = false);
+
+  /**
+   * @return the number of grid points
+   */
+  inline size_t getSize() const { return numberOfPoints; }
+
+  /**
+   * @return the dimension of the grid
+   */
+  inline size_t getDimension() const { return dimension; }
+
+  /**
+   * @return the number of grid points for which memory is allocated
+   */
+  inline size_t getCapacity() const { return capacity; }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return view of the grid point
+   */
+  inline FlatGridPointView operator[](size_t seq) const { return FlatGridPointView(*this, seq); }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return view of the grid point
+   */
+  inline FlatGridPointView getPoint(size_t seq) const { return FlatGridPointView(*this, seq); }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return level of the grid point in dimension <i>d</i>
+   */
+  inline level_type getLevel(size_t seq, size_t d) const { return level[d * capacity + seq]; }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return index of the grid point in dimension <i>d</i>
+   */
+  inline index_type getIndex(size_t seq, size_t d) const { return index[d * capacity + seq]; }
+
+  /**
+   * @param d dimension
+   * @return pointer to the contiguous levels of all grid points in dimension <i>d</i>
+   */
+  inline const level_type* getLevelArray(size_t d) const { return level.data() + d * capacity; }
+
+  /**
+   * @param d dimension
+   * @return pointer to the contiguous indices of all grid points in dimension <i>d</i>
+   */
+  inline const index_type* getIndexArray(size_t d) const { return index.data() + d * capacity; }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return leaf property of the grid point
+   */
+  inline bool isLeaf(size_t seq) const { return leaf[seq] != 0; }
+
+  /**
+   * @param seq    sequence number of the grid point
+   * @param isLeaf new leaf property of the grid point
+   */
+  inline void setLeaf(size_t seq, bool isLeaf) { leaf[seq] = isLeaf ? 1 : 0; }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return hash value of the grid point
+   */
+  inline size_t getHash(size_t seq) const { return hashes[seq]; }
+
+  /**
+   * Tests if a grid point is contained in the storage
+   *
+   * @param point grid point
+   * @return true if the grid point is contained in the storage
+   */
+  bool isContaining(const HashGridPoint& point) const;
+
+  /**
+   * Gets the sequence number of a grid point.
+   *
+   * @param point grid point
+   * @return sequence number, or getSize() + 1 if the point is not contained
+   *         (same convention as HashGridStorage::getSequenceNumber)
+   */
+  size_t getSequenceNumber(const HashGridPoint& point) const;
+
+  /**
+   * Gets the sequence number of a grid point given by its levels and indices.
+   *
+   * @param level array of levels (length: dimension)
+   * @param index array of indices (length: dimension)
+   * @return sequence number, or getSize() + 1 if the point is not contained
+   */
+  size_t getSequenceNumber(const level_type* level, const index_type* index) const;
+
+  /**
+   * @param s sequence number that should be tested
+   * @return true if the sequence number does not point to a valid grid point
+   */
+  inline bool isInvalidSequenceNumber(size_t s) const { return s > numberOfPoints; }
+
+  /**
+   * Appends all grid points (in the same order) to a HashGridStorage.
+   *
+   * @param[out] storage storage to which the grid points are appended
+   */
+  void toHashGridStorage(HashGridStorage& storage) const;
+
+  /**
+   * Converts the storage to the format used by the SOA evaluation kernels,
+   * see HashGridStorage::getLevelIndexArraysForEval.
+   *
+   * @param[out] level DataMatrix to store the grid's level to the power of two
+   * @param[out] index DataMatrix to store the grid's indices
+   */
+  void getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) const;
+
+  /**
+   * @return the maximal level of the grid in all dimensions
+   */
+  size_t getMaxLevel() const;
+
+ private:
+  /// the dimension of the grid
+  size_t dimension;
+  /// the number of grid points
+  size_t numberOfPoints;
+  /// the number of grid points for which memory is allocated (stride of level and index)
+  size_t capacity;
+  /// levels, dimension-major (level[d * capacity + seq])
+  std::vector<level_type> level;
+  /// indices, dimension-major (index[d * capacity + seq])
+  std::vector<index_type> index;
+  /// leaf properties
+  std::vector<uint8_t> leaf;
+  /// hash values of the grid points
+  std::vector<size_t> hashes;
+  /// open addressing hash table containing the sequence numbers
+  GridPointHashTable table;
+
+  /**
+   * Searches the hash table for a grid point.
+   *
+   * @return slot containing the grid point or the empty slot where it would be inserted
+   */
+  size_t findSlot(size_t hash, const level_type* level, const index_type* index) const;
+
+  /**
+   * Resizes the hash table and reinserts all grid points.
+   *
+   * @param newTableBits number of bits used for hash table slots
+   */
+  void rebuildTable(size_t newTableBits);
+
+  friend class FlatGridPointView;
+};
+
+size_t FlatGridPointView::getDimension() const { return storage->getDimension(); }
+
+void FlatGridPointView::get(size_t d, level_type& l, index_type& i) const {
+  l = storage->getLevel(seq, d);
+  i = storage->getIndex(seq, d);
+}
+
+FlatGridPointView::level_type FlatGridPointView::getLevel(size_t d) const {
+  return storage->getLevel(seq, d);
+}
+
+FlatGridPointView::index_type FlatGridPointView::getIndex(size_t d) const {
+  return storage->getIndex(seq, d);
+}
+
+double FlatGridPointView::getStandardCoordinate(size_t d) const {
+  return static_cast<double>(storage->getIndex(seq, d)) /
+         static_cast<double>(static_cast<index_type>(1) << storage->getLevel(seq, d));
+}
+
+bool FlatGridPointView::isLeaf() const { return storage->isLeaf(seq); }
+
+size_t FlatGridPointView::getHash() const { return storage->getHash(seq); }
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* FLATGRIDSTORAGE_HPP */
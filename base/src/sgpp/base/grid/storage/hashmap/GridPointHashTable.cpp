@@ -0,0 +1,14 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/GridPointHashTable.hpp>
+
+namespace sgpp {
+namespace base {
+
+const uint32_t GridPointHashTable::emptySlot;
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,161 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef GRIDPOINTHASHTABLE_HPP
+#define GRIDPOINTHASHTABLE_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Compact open addressing hash table (linear probing, 32 bit slots) that maps grid points
+ * to their sequence numbers. The table only stores sequence numbers, the levels and indices
+ * are kept by the storage that uses it (FlatGridStorage, MappedGridStorage), which passes
+ * hash values and comparison functors.
+ */
+class GridPointHashTable {
+ public:
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+
+  /// marker of empty slots
+  static const uint32_t emptySlot = 0xFFFFFFFFu;
+
+  GridPointHashTable() : table(), tableBits(0) {}
+
+  /**
+   * Computes the hash value of a grid point, identical to HashGridPoint::rehash.
+   *
+   * @param dimension dimension of the grid point
+   * @param level     pointer to the level in dimension 0
+   * @param index     pointer to the index in dimension 0
+   * @param stride    distance between the levels (indices) of consecutive dimensions
+   *                  (1 for contiguous arrays, the number of grid points for dimension-major
+   *                  arrays)
+   * @return          hash value
+   */
+  static inline size_t computeHash(size_t dimension, const level_type* level,
+                                   const index_type* index, size_t stride = 1) {
+    size_t hash = 0xdeadbeef;
+
+    for (size_t d = 0; d < dimension; d++) {
+      hash = (static_cast<index_type>(1) << level[d * stride]) + index[d * stride] + hash * 65599;
+    }
+
+    return hash;
+  }
+
+  /**
+   * @return number of bits used for the slots (the table has 2^getTableBits() slots)
+   */
+  inline size_t getTableBits() const { return tableBits; }
+
+  /**
+   * @return number of slots
+   */
+  inline size_t getNumberOfSlots() const { return table.size(); }
+
+  /**
+   * @param slot  slot
+   * @return      sequence number stored in the slot (or emptySlot)
+   */
+  inline uint32_t operator[](size_t slot) const { return table[slot]; }
+
+  /**
+   * @param slot  empty slot returned by findSlot()
+   * @param seq   sequence number to store in the slot
+   */
+  inline void setSlot(size_t slot, size_t seq) { table[slot] = static_cast<uint32_t>(seq); }
+
+  /**
+   * @param numberOfPoints  number of grid points
+   * @return                smallest number of bits for a load factor of at most 1/2
+   *                        (and at least 16 slots)
+   */
+  static inline size_t getRequiredTableBits(size_t numberOfPoints) {
+    size_t bits = 4;
+
+    while ((static_cast<size_t>(1) << bits) < 2 * numberOfPoints) {
+      bits++;
+    }
+
+    return bits;
+  }
+
+  /**
+   * Resizes the table and reinserts all grid points.
+   *
+   * @param newTableBits    number of bits used for the slots
+   * @param numberOfPoints  number of grid points (with sequence numbers 0, 1, ...)
+   * @param hashOf          functor returning the hash value of a grid point for its sequence number
+   */
+  template <class HASH_OF>
+  void rebuild(size_t newTableBits, size_t numberOfPoints, HASH_OF hashOf) {
+    tableBits = newTableBits;
+    table.assign(static_cast<size_t>(1) << tableBits, emptySlot);
+    const size_t mask = table.size() - 1;
+
+    for (size_t seq = 0; seq < numberOfPoints; seq++) {
+      size_t slot = getHomeSlot(hashOf(seq));
+
+      while (table[slot] != emptySlot) {
+        slot = (slot + 1) & mask;
+      }
+
+      table[slot] = static_cast<uint32_t>(seq);
+    }
+  }
+
+  /**
+   * Searches the table for a grid point.
+   *
+   * @param hash      hash value of the grid point
+   * @param isEqual   functor returning whether the grid point with a given sequence number
+   *                  is the searched one
+   * @return          slot containing the grid point or the empty slot where it would be inserted
+   */
+  template <class IS_EQUAL>
+  size_t findSlot(size_t hash, IS_EQUAL isEqual) const {
+    const size_t mask = table.size() - 1;
+    size_t slot = getHomeSlot(hash);
+
+    while ((table[slot] != emptySlot) && !isEqual(table[slot])) {
+      slot = (slot + 1) & mask;
+    }
+
+    return slot;
+  }
+
+ private:
+  /// sequence numbers (or emptySlot)
+  std::vector<uint32_t> table;
+  /// number of bits used for the slots (table.size() == 1 << tableBits)
+  size_t tableBits;
+
+  /**
+   * @return first slot of the probe sequence for a given hash value
+   */
+  inline size_t getHomeSlot(size_t hash) const {
+    // Fibonacci hashing spreads the polynomial hash over the high bits
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >>
+                               (64 - tableBits));
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* GRIDPOINTHASHTABLE_HPP */
@@ -22,9 +22,7 @@ namespace base {
 
 HashGridPoint::HashGridPoint(size_t dimension)
     : dimension(dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+  allocate();
   leaf = false;
 }
 
@@ -35,9 +33,7 @@ HashGridPoint::HashGridPoint()
 
 HashGridPoint::HashGridPoint(const HashGridPoint& o)
     : dimension(o.dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+  allocate();
   leaf = false;
 
   for (size_t d = 0; d < dimension; d++) {
@@ -55,9 +51,7 @@ HashGridPoint::HashGridPoint(std::istream& istream, int version)
 
   istream >> dimension;
 
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+  allocate();
   leaf = false;
 
   for (size_t d = 0; d < dimension; d++) {
@@ -91,18 +85,34 @@ HashGridPoint::HashGridPoint(std::istream& istream, int version)
 /**
  * Destructor
  */
-HashGridPoint::~HashGridPoint() {
-  if (level) {
-    delete[] level;
+HashGridPoint::~HashGridPoint() { deallocate(); }
+
+void HashGridPoint::allocate() {
+  // level, index and hInv share a single block to keep the number of heap allocations per grid
+  // point at one and to keep the point's data contiguous in memory
+  static_assert(sizeof(level_type) == sizeof(index_type),
+                "level_type and index_type have to be of the same size");
+
+  if (dimension == 0) {
+    level = nullptr;
+    index = nullptr;
+    hInv = nullptr;
+    return;
   }
 
-  if (index) {
-    delete[] index;
-  }
+  level = new level_type[3 * dimension];
+  index = reinterpret_cast<index_type*>(level + dimension);
+  hInv = reinterpret_cast<index_type*>(level + 2 * dimension);
+}
 
-  if (hInv) {
-    delete[] hInv;
+void HashGridPoint::deallocate() {
+  if (level) {
+    delete[] level;
   }
+
+  level = nullptr;
+  index = nullptr;
+  hInv = nullptr;
 }
 
 void HashGridPoint::serialize(std::ostream& ostream, int version) {
@@ -128,7 +138,7 @@ size_t HashGridPoint::getDimension() const { return dimension; }
 
 void HashGridPoint::setLeaf(bool isLeaf) { leaf = isLeaf; }
 
-bool HashGridPoint::isLeaf() { return leaf; }
+bool HashGridPoint::isLeaf() const { return leaf; }
 
 void HashGridPoint::getStandardCoordinates(DataVector& coordinates) const {
   coordinates.resize(dimension);
@@ -185,23 +195,9 @@ HashGridPoint& HashGridPoint::operator=(const HashGridPoint& rhs) {
   }
 
   if (dimension != rhs.dimension) {
-    if (level) {
-      delete[] level;
-    }
-
-    if (index) {
-      delete[] index;
-    }
-
-    if (hInv) {
-      delete[] hInv;
-    }
-
+    deallocate();
     dimension = rhs.dimension;
-
-    level = new level_type[dimension];
-    index = new index_type[dimension];
-    hInv = new index_type[dimension];
+    allocate();
   }
 
   for (size_t d = 0; d < dimension; d++) {
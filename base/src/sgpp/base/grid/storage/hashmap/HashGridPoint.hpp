@@ -182,7 +182,7 @@ class HashGridPoint {
    *
    * @return Returns true if this grid point has <b>no</b> children, otherwise false
    */
-  bool isLeaf();
+  bool isLeaf() const;
 
   /**
    * determines the coordinate in a given dimension
@@ -451,6 +451,7 @@ class HashGridPoint {
   /// the dimension of the gridpoint
   size_t dimension;
   /// pointer to array that stores the ansatzfunctions' level
+  /// (owns the memory block that is shared with index and hInv)
   level_type* level;
   /// pointer to array that stores the ansatzfunctions' indices
   index_type* index;
@@ -465,6 +466,16 @@ class HashGridPoint {
   /// -> needed for finding the grid point at the boundary of the support
   static std::vector<level_type> multiplyDeBruijnBitPosition;
 
+  /**
+   * allocates one memory block holding level, index and hInv for the current dimension
+   */
+  void allocate();
+
+  /**
+   * frees the memory block holding level, index and hInv
+   */
+  void deallocate();
+
   friend struct HashGridPointPointerHashFunctor;
   friend struct HashGridPointPointerEqualityFunctor;
   friend struct HashGridPointHashFunctor;
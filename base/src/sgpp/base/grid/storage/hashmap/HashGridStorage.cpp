@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/MappedGridStorage.hpp>
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
@@ -26,7 +27,8 @@ HashGridStorage::HashGridStorage(size_t dimension)
       algoDims(),
       boundingBox(new BoundingBox(dimension)),
       stretching(nullptr),
-      bUseStretching(false) {
+      bUseStretching(false),
+      modificationCount(0) {
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
   }
@@ -40,7 +42,8 @@ HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
       algoDims(),
       boundingBox(new BoundingBox(creationBoundingBox)),
       stretching(nullptr),
-      bUseStretching(false) {
+      bUseStretching(false),
+      modificationCount(0) {
   // this look like a bug, creationBoundingBox not used
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
@@ -55,7 +58,8 @@ HashGridStorage::HashGridStorage(Stretching& creationStretching)
       algoDims(),
       boundingBox(nullptr),
       stretching(new Stretching(creationStretching)),
-      bUseStretching(true) {
+      bUseStretching(true),
+      modificationCount(0) {
   // this look like a bug, creationBoundingBox not used
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
@@ -67,7 +71,8 @@ HashGridStorage::HashGridStorage(std::string& istr)
       dimension(0lu),
       list(),
       map(),
-      algoDims() {
+      algoDims(),
+      modificationCount(0) {
   std::istringstream istream;
   istream.str(istr);
 
@@ -83,7 +88,8 @@ HashGridStorage::HashGridStorage(std::istream& istream)
       dimension(0lu),
       list(),
       map(),
-      algoDims() {
+      algoDims(),
+      modificationCount(0) {
   parseGridDescription(istream);
 
   for (size_t i = 0; i < dimension; i++) {
@@ -99,7 +105,8 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
       algoDims(copyFrom.algoDims),
       boundingBox(copyFrom.bUseStretching ? nullptr : new BoundingBox(*copyFrom.boundingBox)),
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
-      bUseStretching(copyFrom.bUseStretching) {
+      bUseStretching(copyFrom.bUseStretching),
+      modificationCount(0) {
   // copy gridpoints
   for (size_t i = 0; i < copyFrom.getSize(); i++) {
     this->insert(copyFrom[i]);
@@ -153,6 +160,12 @@ void HashGridStorage::clear() {
   map.clear();
   // remove all list entries
   list.clear();
+  modificationCount++;
+}
+
+void HashGridStorage::reserve(size_t numberOfPoints) {
+  list.reserve(numberOfPoints);
+  map.reserve(numberOfPoints);
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
@@ -194,6 +207,8 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
     map[curPoint] = i;
   }
 
+  modificationCount++;
+
   // reset the whole grid's leaf property in order
   // to guarantee a consistent grid
   recalcLeafProperty();
@@ -226,6 +241,15 @@ void HashGridStorage::serialize(std::ostream& ostream, int version) const {
   ostream << dimension << " ";
   ostream << list.size() << std::endl;
 
+  serializeGeometry(ostream, version);
+
+  // print the coordinates of the grid points
+  for (grid_list_const_iterator iter = list.begin(); iter != list.end(); iter++) {
+    (*iter)->serialize(ostream, version);
+  }
+}
+
+void HashGridStorage::serializeGeometry(std::ostream& ostream, int version) const {
   // If BoundingBox used, write zero
   if (!bUseStretching) {
     ostream << std::scientific << 0 << std::endl;
@@ -241,11 +265,10 @@ void HashGridStorage::serialize(std::ostream& ostream, int version) const {
 
     stretching->serialize(ostream, version);
   }
+}
 
-  // print the coordinates of the grid points
-  for (grid_list_const_iterator iter = list.begin(); iter != list.end(); iter++) {
-    (*iter)->serialize(ostream, version);
-  }
+void HashGridStorage::serializeBinary(std::ostream& ostream, const DataVector* coefficients) const {
+  MappedGridStorage::write(ostream, *this, coefficients);
 }
 
 std::string HashGridStorage::toString() const {
@@ -288,6 +311,7 @@ size_t HashGridStorage::getDimension() const { return dimension; }
 size_t HashGridStorage::insert(const point_type& index) {
   point_pointer insert = new HashGridPoint(index);
   list.push_back(insert);
+  modificationCount++;
   return (map[insert] = list.size() - 1);
 }
 
@@ -332,6 +356,7 @@ void HashGridStorage::update(point_type& index, size_t pos) {
     point_pointer insert = new HashGridPoint(index);
     list[pos] = insert;
     map[insert] = pos;
+    modificationCount++;
   }
 }
 
@@ -340,6 +365,7 @@ void HashGridStorage::deleteLast() {
   map.erase(del);
   list.pop_back();
   delete del;
+  modificationCount++;
 }
 
 void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims) {
@@ -417,6 +443,7 @@ void HashGridStorage::setBoundingBox(BoundingBox& boundingBox) {
 
   bUseStretching = false;
   this->boundingBox = new BoundingBox(boundingBox);
+  modificationCount++;
 }
 
 void HashGridStorage::setStretching(Stretching& stretching) {
@@ -428,6 +455,7 @@ void HashGridStorage::setStretching(Stretching& stretching) {
 
   bUseStretching = true;
   this->stretching = new Stretching(stretching);
+  modificationCount++;
 }
 
 void HashGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) {
@@ -676,6 +704,8 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     map[index] = i;
   }
 
+  modificationCount++;
+
   // set's the grid point's leaf information which is not saved in version 1
   if (version == 1 || version == 4) {
     recalcLeafProperty();
@@ -15,6 +15,7 @@
 #include <sgpp/base/grid/common/Stretching.hpp>
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrixSP.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -127,6 +128,14 @@ class HashGridStorage {
    */
   void clear();
 
+  /**
+   * reserves memory for a given number of grid points, such that inserting them does not
+   * rehash the hashmap
+   *
+   * @param numberOfPoints number of grid points
+   */
+  void reserve(size_t numberOfPoints);
+
   /**
    * Remove several point from HashGridStorage. The points to removed
    * are stored in a list. This function returns a vector of remaining points
@@ -161,6 +170,26 @@ class HashGridStorage {
    */
   void serialize(std::ostream& ostream, int version = SERIALIZATION_VERSION) const;
 
+  /**
+   * serialize the bounding box or stretching of the gridstorage into a stream
+   * (part of the output of serialize)
+   *
+   * @param ostream reference to a stream into that the geometry information is written
+   * @param version the serialization version of the file
+   */
+  void serializeGeometry(std::ostream& ostream, int version = SERIALIZATION_VERSION) const;
+
+  /**
+   * serialize the gridstorage and optionally the coefficients into a stream using the
+   * binary format (SERIALIZATION_VERSION_BINARY), which can be loaded without parsing
+   * by MappedGridStorage
+   *
+   * @param ostream       reference to a stream (opened in binary mode) into that all
+   *                      gridstorage information is written
+   * @param coefficients  coefficients of the grid points (optional)
+   */
+  void serializeBinary(std::ostream& ostream, const DataVector* coefficients = nullptr) const;
+
   /**
    * serialize the gridstorage's gridpoints into a stream
    *
@@ -196,6 +225,16 @@ class HashGridStorage {
    */
   size_t getDimension() const;
 
+  /**
+   * gets the number of modifications of the grid, which is increased whenever grid points
+   * are inserted, updated or deleted or the bounding box or stretching is replaced;
+   * data structures derived from the grid can compare it to detect changes
+   * (changes of grid points via operator[] or getPoint() are not counted)
+   *
+   * @return number of modifications of the grid since its construction
+   */
+  size_t getModificationCount() const;
+
   /**
    * gets the index number for given gridpoint by its sequence number
    *
@@ -534,6 +573,9 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// number of modifications of the grid (see getModificationCount())
+  size_t modificationCount;
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
@@ -551,6 +593,7 @@ void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
   list.push_back(index);
+  modificationCount++;
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
 
@@ -580,6 +623,8 @@ bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > map.
 
 std::vector<size_t> inline HashGridStorage::getAlgorithmicDimensions() { return algoDims; }
 
+size_t inline HashGridStorage::getModificationCount() const { return modificationCount; }
+
 }  // namespace base
 }  // namespace sgpp
 
@@ -0,0 +1,395 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/MappedGridStorage.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+const char BINARY_MAGIC[8] = {'S', 'G', 'P', 'P', 'G', 'R', 'I', 'D'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+/// rounds up to the next multiple of 8 bytes
+inline uint64_t alignOffset(uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); }
+
+/// pads the stream with zeros until position (relative to the beginning of the file)
+void writePadding(std::ostream& ostream, uint64_t& position, uint64_t targetPosition) {
+  const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  ostream.write(zeros, static_cast<std::streamsize>(targetPosition - position));
+  position = targetPosition;
+}
+
+}  // namespace
+
+void MappedGridStorage::write(std::ostream& ostream, const HashGridStorage& storage,
+                              const DataVector* coefficients) {
+  const size_t dimension = storage.getDimension();
+  const size_t numberOfPoints = storage.getSize();
+
+  if ((coefficients != nullptr) && (coefficients->getSize() != numberOfPoints)) {
+    throw file_exception("MappedGridStorage::write: number of coefficients does not match");
+  }
+
+  // geometry in the same format as in the text serialization, but without loss of precision
+  std::ostringstream geometryStream;
+  geometryStream.precision(std::numeric_limits<double>::max_digits10);
+  storage.serializeGeometry(geometryStream, SERIALIZATION_VERSION);
+
+  const std::string geometry = geometryStream.str();
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+  header.version = SERIALIZATION_VERSION_BINARY;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.dimension = dimension;
+  header.numberOfPoints = numberOfPoints;
+  header.hasCoefficients = (coefficients != nullptr) ? 1 : 0;
+  header.geometryOffset = alignOffset(sizeof(Header));
+  header.geometrySize = geometry.size();
+  header.levelOffset = alignOffset(header.geometryOffset + header.geometrySize);
+  header.indexOffset =
+      alignOffset(header.levelOffset + dimension * numberOfPoints * sizeof(level_type));
+  header.leafOffset =
+      alignOffset(header.indexOffset + dimension * numberOfPoints * sizeof(index_type));
+  header.coefficientOffset = alignOffset(header.leafOffset + numberOfPoints);
+  header.fileSize = (coefficients != nullptr)
+                        ? header.coefficientOffset + numberOfPoints * sizeof(double)
+                        : header.leafOffset + numberOfPoints;
+
+  uint64_t position = 0;
+  ostream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  position += sizeof(header);
+
+  writePadding(ostream, position, header.geometryOffset);
+  ostream.write(geometry.data(), static_cast<std::streamsize>(geometry.size()));
+  position += geometry.size();
+
+  // levels and indices, dimension by dimension
+  std::vector<level_type> levels(numberOfPoints);
+  std::vector<index_type> indices(numberOfPoints);
+
+  writePadding(ostream, position, header.levelOffset);
+
+  for (size_t d = 0; d < dimension; d++) {
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      levels[i] = storage[i].getLevel(d);
+    }
+
+    ostream.write(reinterpret_cast<const char*>(levels.data()),
+                  static_cast<std::streamsize>(numberOfPoints * sizeof(level_type)));
+    position += numberOfPoints * sizeof(level_type);
+  }
+
+  writePadding(ostream, position, header.indexOffset);
+
+  for (size_t d = 0; d < dimension; d++) {
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      indices[i] = storage[i].getIndex(d);
+    }
+
+    ostream.write(reinterpret_cast<const char*>(indices.data()),
+                  static_cast<std::streamsize>(numberOfPoints * sizeof(index_type)));
+    position += numberOfPoints * sizeof(index_type);
+  }
+
+  writePadding(ostream, position, header.leafOffset);
+  std::vector<uint8_t> leaves(numberOfPoints);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    leaves[i] = storage[i].isLeaf() ? 1 : 0;
+  }
+
+  ostream.write(reinterpret_cast<const char*>(leaves.data()),
+                static_cast<std::streamsize>(numberOfPoints));
+  position += numberOfPoints;
+
+  if (coefficients != nullptr) {
+    writePadding(ostream, position, header.coefficientOffset);
+    ostream.write(reinterpret_cast<const char*>(coefficients->getPointer()),
+                  static_cast<std::streamsize>(numberOfPoints * sizeof(double)));
+    position += numberOfPoints * sizeof(double);
+  }
+
+  if (!ostream) {
+    throw file_exception("MappedGridStorage::write: could not write grid");
+  }
+}
+
+MappedGridStorage::MappedGridStorage(const std::string& filename)
+    : data(nullptr),
+      dataSize(0),
+      isMapped(false),
+      buffer(),
+      header(nullptr),
+      level(nullptr),
+      index(nullptr),
+      leaf(nullptr),
+      coefficients(nullptr),
+      bUseStretching(false) {
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception(("MappedGridStorage: could not open " + filename).c_str());
+  }
+
+  struct stat fileStat;
+
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw file_exception(("MappedGridStorage: could not stat " + filename).c_str());
+  }
+
+  dataSize = static_cast<size_t>(fileStat.st_size);
+
+  if (dataSize > 0) {
+    void* mapped = mmap(nullptr, dataSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapped == MAP_FAILED) {
+      throw file_exception(("MappedGridStorage: could not map " + filename).c_str());
+    }
+
+    data = static_cast<const char*>(mapped);
+    isMapped = true;
+  } else {
+    close(fd);
+  }
+#else
+  std::ifstream file(filename.c_str(), std::ios::binary);
+
+  if (!file) {
+    throw file_exception(("MappedGridStorage: could not open " + filename).c_str());
+  }
+
+  buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  data = buffer.data();
+  dataSize = buffer.size();
+#endif
+
+  try {
+    initialize();
+  } catch (...) {
+#ifndef _WIN32
+    if (isMapped) {
+      munmap(const_cast<char*>(data), dataSize);
+    }
+#endif
+    throw;
+  }
+}
+
+MappedGridStorage::MappedGridStorage(std::istream& istream)
+    : data(nullptr),
+      dataSize(0),
+      isMapped(false),
+      buffer(),
+      header(nullptr),
+      level(nullptr),
+      index(nullptr),
+      leaf(nullptr),
+      coefficients(nullptr),
+      bUseStretching(false) {
+  // read the header first to know how many bytes belong to the grid
+  Header fileHeader;
+
+  if (!istream.read(reinterpret_cast<char*>(&fileHeader), sizeof(Header)) ||
+      (std::memcmp(fileHeader.magic, BINARY_MAGIC, sizeof(fileHeader.magic)) != 0)) {
+    throw file_exception("MappedGridStorage: stream does not contain a binary grid");
+  }
+
+  if (fileHeader.fileSize < sizeof(Header)) {
+    throw file_exception("MappedGridStorage: invalid binary grid header");
+  }
+
+  // the buffer is allocated with operator new and thus aligned for doubles
+  buffer.resize(static_cast<size_t>(fileHeader.fileSize));
+  std::memcpy(buffer.data(), &fileHeader, sizeof(Header));
+  istream.read(buffer.data() + sizeof(Header),
+               static_cast<std::streamsize>(fileHeader.fileSize - sizeof(Header)));
+
+  if (!istream) {
+    throw file_exception("MappedGridStorage: unexpected end of stream");
+  }
+
+  data = buffer.data();
+  dataSize = buffer.size();
+  initialize();
+}
+
+MappedGridStorage::~MappedGridStorage() {
+#ifndef _WIN32
+  if (isMapped) {
+    munmap(const_cast<char*>(data), dataSize);
+  }
+#endif
+}
+
+void MappedGridStorage::initialize() {
+  if (dataSize < sizeof(Header)) {
+    throw file_exception("MappedGridStorage: file too small");
+  }
+
+  header = reinterpret_cast<const Header*>(data);
+
+  if (std::memcmp(header->magic, BINARY_MAGIC, sizeof(header->magic)) != 0) {
+    throw file_exception("MappedGridStorage: not a binary grid file");
+  }
+
+  if (header->byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception("MappedGridStorage: file was written with a different byte order");
+  }
+
+  if (header->version != SERIALIZATION_VERSION_BINARY) {
+    std::ostringstream errstream;
+    errstream << "MappedGridStorage: unsupported version " << header->version
+              << " of binary grid, expected " << SERIALIZATION_VERSION_BINARY << ".";
+    throw file_exception(errstream.str().c_str());
+  }
+
+  if ((header->fileSize > dataSize) || (header->geometryOffset + header->geometrySize >
+                                        header->fileSize)) {
+    throw file_exception("MappedGridStorage: file is truncated");
+  }
+
+  const uint64_t arraySize = header->dimension * header->numberOfPoints;
+
+  if ((header->levelOffset + arraySize * sizeof(level_type) > header->fileSize) ||
+      (header->indexOffset + arraySize * sizeof(index_type) > header->fileSize) ||
+      (header->leafOffset + header->numberOfPoints > header->fileSize) ||
+      ((header->hasCoefficients != 0) &&
+       (header->coefficientOffset + header->numberOfPoints * sizeof(double) > header->fileSize))) {
+    throw file_exception("MappedGridStorage: inconsistent binary grid header");
+  }
+
+  if (header->numberOfPoints >= static_cast<uint64_t>(GridPointHashTable::emptySlot)) {
+    throw file_exception("MappedGridStorage: grid too large");
+  }
+
+  // the offsets are aligned, so the arrays can be accessed directly
+  level = reinterpret_cast<const level_type*>(data + header->levelOffset);
+  index = reinterpret_cast<const index_type*>(data + header->indexOffset);
+  leaf = reinterpret_cast<const uint8_t*>(data + header->leafOffset);
+  coefficients = (header->hasCoefficients != 0)
+                     ? reinterpret_cast<const double*>(data + header->coefficientOffset)
+                     : nullptr;
+
+  // parse the (small) geometry section
+  const size_t dimension = getDimension();
+  std::istringstream geometryStream(
+      std::string(data + header->geometryOffset, static_cast<size_t>(header->geometrySize)));
+  int useStretching;
+  geometryStream >> useStretching;
+
+  if (useStretching == 0) {
+    bUseStretching = false;
+    boundingBox.reset(new BoundingBox(dimension));
+    boundingBox->unserialize(geometryStream, SERIALIZATION_VERSION);
+  } else {
+    bUseStretching = true;
+    stretching.reset(new Stretching(dimension));
+    stretching->unserialize(geometryStream, (useStretching == 1) ? "analytic" : "discrete",
+                            SERIALIZATION_VERSION);
+  }
+}
+
+void MappedGridStorage::getCoefficients(DataVector& alpha) const {
+  if (coefficients == nullptr) {
+    throw file_exception("MappedGridStorage::getCoefficients: file contains no coefficients");
+  }
+
+  alpha.resize(getSize());
+  std::memcpy(alpha.getPointer(), coefficients, getSize() * sizeof(double));
+}
+
+size_t MappedGridStorage::getSequenceNumber(const HashGridPoint& point) const {
+  std::call_once(indexFlag, &MappedGridStorage::buildIndex, this);
+
+  const size_t dimension = getDimension();
+  const size_t numberOfPoints = getSize();
+  std::vector<level_type> pointLevel(dimension);
+  std::vector<index_type> pointIndex(dimension);
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, pointLevel[d], pointIndex[d]);
+  }
+
+  const size_t hash = GridPointHashTable::computeHash(dimension, pointLevel.data(),
+                                                      pointIndex.data());
+  const size_t slot = table.findSlot(hash, [&](size_t seq) {
+    for (size_t d = 0; d < dimension; d++) {
+      if ((level[d * numberOfPoints + seq] != pointLevel[d]) ||
+          (index[d * numberOfPoints + seq] != pointIndex[d])) {
+        return false;
+      }
+    }
+
+    return true;
+  });
+
+  if (table[slot] != GridPointHashTable::emptySlot) {
+    return table[slot];
+  }
+
+  return numberOfPoints + 1;
+}
+
+void MappedGridStorage::toHashGridStorage(HashGridStorage& storage) const {
+  const size_t dimension = getDimension();
+  const size_t numberOfPoints = getSize();
+
+  if (storage.getDimension() != dimension) {
+    throw file_exception("MappedGridStorage::toHashGridStorage: dimension mismatch");
+  }
+
+  if (bUseStretching) {
+    storage.setStretching(*stretching);
+  } else {
+    storage.setBoundingBox(*boundingBox);
+  }
+
+  storage.reserve(storage.getSize() + numberOfPoints);
+
+  HashGridPoint point(dimension);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dimension; d++) {
+      point.push(d, level[d * numberOfPoints + i], index[d * numberOfPoints + i]);
+    }
+
+    point.setLeaf(leaf[i] != 0);
+    point.rehash();
+    storage.insert(point);
+  }
+}
+
+void MappedGridStorage::buildIndex() const {
+  const size_t numberOfPoints = getSize();
+  table.rebuild(GridPointHashTable::getRequiredTableBits(numberOfPoints), numberOfPoints,
+                [this](size_t seq) { return computeHash(seq); });
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,277 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MAPPEDGRIDSTORAGE_HPP
+#define MAPPEDGRIDSTORAGE_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+#include <sgpp/base/grid/common/Stretching.hpp>
+#include <sgpp/base/grid/storage/hashmap/GridPointHashTable.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only grid storage backed by a file in the binary serialization format
+ * (SERIALIZATION_VERSION_BINARY), which is written by HashGridStorage::serializeBinary.
+ *
+ * File layout (native byte order, all sections aligned to 8 bytes):
+ *   - header (MappedGridStorage::Header)
+ *   - geometry: text serialization of the bounding box or stretching
+ *     (same format as in the text serialization, written with full precision)
+ *   - levels: dimension-major uint32 array (all levels of dimension 0, then dimension 1, ...)
+ *   - indices: dimension-major uint32 array
+ *   - leaf properties: one byte per grid point
+ *   - coefficients (optional): one double per grid point
+ *
+ * The file is mapped into memory with mmap (on Windows, it is read into a buffer),
+ * so that opening even very large grids does not parse or copy the grid points.
+ * The arrays (getLevelArray(), getIndexArray(), getCoefficientArray()) can be read directly
+ * by code that works on the dimension-major layout, and the compact hash index that is needed
+ * for getSequenceNumber() is built lazily on the first call.
+ *
+ * This class is not a GridStorage, i.e., it cannot back a Grid and cannot be passed to the
+ * operations. For this purpose, the grid points are copied into the storage of a Grid of the
+ * matching type with toHashGridStorage(), which inserts them into the hash map of
+ * HashGridStorage in a single pass (after reserving memory for all of them).
+ */
+class MappedGridStorage {
+ public:
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+
+  /**
+   * Header of the binary format.
+   */
+  struct Header {
+    /// magic bytes "SGPPGRID"
+    char magic[8];
+    /// serialization version (SERIALIZATION_VERSION_BINARY)
+    uint32_t version;
+    /// byte order mark (0x01020304 in the byte order of the writing machine)
+    uint32_t byteOrderMark;
+    /// dimension of the grid
+    uint64_t dimension;
+    /// number of grid points
+    uint64_t numberOfPoints;
+    /// whether the file contains coefficients
+    uint64_t hasCoefficients;
+    /// offset of the geometry section in bytes
+    uint64_t geometryOffset;
+    /// size of the geometry section in bytes
+    uint64_t geometrySize;
+    /// offset of the levels in bytes
+    uint64_t levelOffset;
+    /// offset of the indices in bytes
+    uint64_t indexOffset;
+    /// offset of the leaf properties in bytes
+    uint64_t leafOffset;
+    /// offset of the coefficients in bytes
+    uint64_t coefficientOffset;
+    /// total size of the file in bytes
+    uint64_t fileSize;
+  };
+
+  /**
+   * Writes a grid storage (and optionally coefficients) in the binary format.
+   *
+   * @param ostream       stream to write to (should be opened in binary mode)
+   * @param storage       grid storage
+   * @param coefficients  coefficient vector of the grid points (optional, nullptr if none)
+   */
+  static void write(std::ostream& ostream, const HashGridStorage& storage,
+                    const DataVector* coefficients = nullptr);
+
+  /**
+   * Maps a file in the binary format into memory.
+   *
+   * @param filename  name of the file
+   */
+  explicit MappedGridStorage(const std::string& filename);
+
+  /**
+   * Reads a grid in the binary format from a stream into an internal buffer.
+   *
+   * @param istream   stream to read from (should be opened in binary mode)
+   */
+  explicit MappedGridStorage(std::istream& istream);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~MappedGridStorage();
+
+  /**
+   * @return the dimension of the grid
+   */
+  inline size_t getDimension() const { return static_cast<size_t>(header->dimension); }
+
+  /**
+   * @return the number of grid points
+   */
+  inline size_t getSize() const { return static_cast<size_t>(header->numberOfPoints); }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return level of the grid point in dimension <i>d</i>
+   */
+  inline level_type getLevel(size_t seq, size_t d) const {
+    return level[d * getSize() + seq];
+  }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return index of the grid point in dimension <i>d</i>
+   */
+  inline index_type getIndex(size_t seq, size_t d) const {
+    return index[d * getSize() + seq];
+  }
+
+  /**
+   * @param d dimension
+   * @return pointer to the contiguous levels of all grid points in dimension <i>d</i>
+   */
+  inline const level_type* getLevelArray(size_t d) const { return level + d * getSize(); }
+
+  /**
+   * @param d dimension
+   * @return pointer to the contiguous indices of all grid points in dimension <i>d</i>
+   */
+  inline const index_type* getIndexArray(size_t d) const { return index + d * getSize(); }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return leaf property of the grid point
+   */
+  inline bool isLeaf(size_t seq) const { return leaf[seq] != 0; }
+
+  /**
+   * @return whether the file contains coefficients
+   */
+  inline bool hasCoefficients() const { return coefficients != nullptr; }
+
+  /**
+   * @return pointer to the coefficients of the grid points (nullptr if there are none)
+   */
+  inline const double* getCoefficientArray() const { return coefficients; }
+
+  /**
+   * Copies the coefficients into a DataVector.
+   *
+   * @param[out] alpha coefficient vector
+   */
+  void getCoefficients(DataVector& alpha) const;
+
+  /**
+   * @return whether the grid uses a stretching instead of a bounding box
+   */
+  inline bool isUseStretching() const { return bUseStretching; }
+
+  /**
+   * @return bounding box of the grid (nullptr if a stretching is used)
+   */
+  inline BoundingBox* getBoundingBox() const { return boundingBox.get(); }
+
+  /**
+   * @return stretching of the grid (nullptr if a bounding box is used)
+   */
+  inline Stretching* getStretching() const { return stretching.get(); }
+
+  /**
+   * Gets the sequence number of a grid point. Builds the hash index on the first call.
+   *
+   * @param point grid point
+   * @return sequence number, or getSize() + 1 if the point is not contained
+   *         (same convention as HashGridStorage::getSequenceNumber)
+   */
+  size_t getSequenceNumber(const HashGridPoint& point) const;
+
+  /**
+   * @param s sequence number that should be tested
+   * @return true if the sequence number does not point to a valid grid point
+   */
+  inline bool isInvalidSequenceNumber(size_t s) const { return s > getSize(); }
+
+  /**
+   * Copies the grid points (in the same order), the bounding box and the stretching
+   * into a HashGridStorage. Existing grid points are kept.
+   *
+   * @param[out] storage storage of the same dimension
+   */
+  void toHashGridStorage(HashGridStorage& storage) const;
+
+ private:
+  /// start of the mapped memory (or of buffer)
+  const char* data;
+  /// size of the mapped memory
+  size_t dataSize;
+  /// whether data has been mapped with mmap (and has to be unmapped)
+  bool isMapped;
+  /// buffer that holds the file if it has not been mapped
+  std::vector<char> buffer;
+
+  /// header of the file
+  const Header* header;
+  /// levels, dimension-major
+  const level_type* level;
+  /// indices, dimension-major
+  const index_type* index;
+  /// leaf properties
+  const uint8_t* leaf;
+  /// coefficients (nullptr if the file contains none)
+  const double* coefficients;
+
+  /// whether the grid uses a stretching
+  bool bUseStretching;
+  /// bounding box of the grid
+  std::unique_ptr<BoundingBox> boundingBox;
+  /// stretching of the grid
+  std::unique_ptr<Stretching> stretching;
+
+  /// guards the lazy construction of the hash index
+  mutable std::once_flag indexFlag;
+  /// open addressing hash table containing the sequence numbers
+  mutable GridPointHashTable table;
+
+  /**
+   * Checks the header, sets the array pointers and parses the geometry.
+   */
+  void initialize();
+
+  /**
+   * Builds the hash index of all grid points.
+   */
+  void buildIndex() const;
+
+  /**
+   * Computes the hash value of a stored grid point.
+   */
+  inline size_t computeHash(size_t seq) const {
+    return GridPointHashTable::computeHash(getDimension(), level + seq, index + seq, getSize());
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MAPPEDGRIDSTORAGE_HPP */
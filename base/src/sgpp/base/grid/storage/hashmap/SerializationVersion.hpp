@@ -20,7 +20,15 @@
  * Version 7: PointDistribution changed from enum to enum class
  * Version 8: Add custom boundaryLevel (>= 1) for LinearBoundaryGrid etc.
  * Version 9: Remove PointDistribution again, include Clenshaw-Curtis points in Stretching
+ * Version 10: binary format with contiguous level/index arrays and optional coefficients
+ *             (HashGridStorage::serializeBinary, MappedGridStorage); the text format
+ *             is still written with version 9
  */
 #define SERIALIZATION_VERSION 9
 
+/**
+ * Version of the binary serialization format (see above)
+ */
+#define SERIALIZATION_VERSION_BINARY 10
+
 #endif /* SERIALIZATIONVERSION_HPP */
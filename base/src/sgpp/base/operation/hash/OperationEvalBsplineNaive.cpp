@@ -9,21 +9,35 @@
 namespace sgpp {
 namespace base {
 
-double OperationEvalBsplineNaive::eval(const DataVector& alpha,
-                                        const DataVector& point) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  double result = 0.0;
+double OperationEvalBsplineNaive::eval(const DataVector& alpha, const DataVector& point) {
+  pointInUnitCube = point;
+  storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
+  // use the specialized basis for the degree (without virtual calls) if available
+  return visitFixedDegreeBsplineBasis(base.getDegree(), base, EvalVisitor{*this, alpha});
+}
+
+void OperationEvalBsplineNaive::eval(const DataMatrix& alpha, const DataVector& point,
+                                     DataVector& value) {
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
+  // use the specialized basis for the degree (without virtual calls) if available
+  visitFixedDegreeBsplineBasis(base.getDegree(), base, EvalMatrixVisitor{*this, alpha, value});
+}
+
+template <class BASIS>
+double OperationEvalBsplineNaive::evalWithBasis(BASIS& basis, const DataVector& alpha) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  double result = 0.0;
+
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
 
     for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
+      const double val1d = basis.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
 
       if (val1d == 0.0) {
         curValue = 0.0;
@@ -39,16 +53,13 @@ double OperationEvalBsplineNaive::eval(const DataVector& alpha,
   return result;
 }
 
-void OperationEvalBsplineNaive::eval(const DataMatrix& alpha,
-                                     const DataVector& point,
-                                     DataVector& value) {
+template <class BASIS>
+void OperationEvalBsplineNaive::evalWithBasis(BASIS& basis, const DataMatrix& alpha,
+                                              DataVector& value) {
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = alpha.getNcols();
 
-  pointInUnitCube = point;
-  storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
-
   value.resize(m);
   value.setAll(0.0);
 
@@ -57,7 +68,7 @@ void OperationEvalBsplineNaive::eval(const DataMatrix& alpha,
     double curValue = 1.0;
 
     for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
+      const double val1d = basis.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
 
       if (val1d == 0.0) {
         curValue = 0.0;
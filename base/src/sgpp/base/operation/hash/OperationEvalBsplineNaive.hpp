@@ -10,6 +10,7 @@
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/FixedDegreeBsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
@@ -59,6 +60,64 @@ class OperationEvalBsplineNaive : public OperationEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+
+  /**
+   * Functor calling evalWithBasis() for a coefficient vector
+   * (see visitFixedDegreeBsplineBasis()).
+   */
+  struct EvalVisitor {
+    typedef double result_type;
+    /// operation
+    OperationEvalBsplineNaive& op;
+    /// coefficient vector
+    const DataVector& alpha;
+
+    template <class BASIS>
+    double operator()(BASIS& basis) const {
+      return op.evalWithBasis(basis, alpha);
+    }
+  };
+
+  /**
+   * Functor calling evalWithBasis() for a coefficient matrix
+   * (see visitFixedDegreeBsplineBasis()).
+   */
+  struct EvalMatrixVisitor {
+    typedef void result_type;
+    /// operation
+    OperationEvalBsplineNaive& op;
+    /// coefficient matrix
+    const DataMatrix& alpha;
+    /// values of the linear combinations
+    DataVector& value;
+
+    template <class BASIS>
+    void operator()(BASIS& basis) const {
+      op.evalWithBasis(basis, alpha, value);
+    }
+  };
+
+  /**
+   * Evaluates the linear combination at pointInUnitCube with a given 1D basis
+   * (base or the FixedDegreeBsplineBasis of the same degree).
+   *
+   * @param basis     1D basis
+   * @param alpha     coefficient vector
+   * @return          value of the linear combination
+   */
+  template <class BASIS>
+  double evalWithBasis(BASIS& basis, const DataVector& alpha);
+
+  /**
+   * Evaluates the linear combinations at pointInUnitCube with a given 1D basis
+   * (base or the FixedDegreeBsplineBasis of the same degree).
+   *
+   * @param      basis  1D basis
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param[out] value  values of linear combination
+   */
+  template <class BASIS>
+  void evalWithBasis(BASIS& basis, const DataMatrix& alpha, DataVector& value);
 };
 
 }  // namespace base
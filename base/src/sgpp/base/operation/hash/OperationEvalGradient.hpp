@@ -66,6 +66,34 @@ class OperationEvalGradient {
     }
   }
 
+  /**
+   * Evaluates the linear combination and its gradient at multiple points.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (each row is a point)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination (each row is the gradient
+   *                        at the corresponding point)
+   */
+  virtual void evalGradient(const DataVector& alpha,
+                            const DataMatrix& points,
+                            DataVector& value,
+                            DataMatrix& gradient) {
+    const size_t d = points.getNcols();
+    const size_t numberOfPoints = points.getNrows();
+    DataVector curPoint(d);
+    DataVector curGradient(d);
+
+    value.resize(numberOfPoints);
+    gradient.resize(numberOfPoints, d);
+
+    for (size_t k = 0; k < numberOfPoints; k++) {
+      points.getRow(k, curPoint);
+      value[k] = evalGradient(alpha, curPoint, curGradient);
+      gradient.setRow(k, curGradient);
+    }
+  }
+
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
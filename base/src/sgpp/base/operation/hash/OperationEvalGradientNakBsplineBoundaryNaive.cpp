@@ -9,13 +9,10 @@
 namespace sgpp {
 namespace base {
 
-double OperationEvalGradientNakBsplineBoundaryNaive::evalGradient(
-    const DataVector& alpha,
-    const DataVector& point,
-    DataVector& gradient) {
-  const size_t n = storage.getSize();
+double OperationEvalGradientNakBsplineBoundaryNaive::evalGradient(const DataVector& alpha,
+                                                                  const DataVector& point,
+                                                                  DataVector& gradient) {
   const size_t d = storage.getDimension();
-  double result = 0.0;
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
@@ -24,46 +21,27 @@ double OperationEvalGradientNakBsplineBoundaryNaive::evalGradient(
     innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
   }
 
-  gradient.resize(storage.getDimension());
-  gradient.setAll(0.0);
-
-  DataVector curGradient(d);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-    curGradient.setAll(alpha[i]);
-
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = baseDeriv1.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
 
-      curValue *= val1d;
+  auto eval1D = [this](size_t t, size_t order, uint32_t l, uint32_t i, double x,
+                       double* derivatives) {
+    derivatives[0] = base.eval(l, i, x);
 
-      for (size_t t2 = 0; t2 < d; t2++) {
-        if (t2 == t) {
-          curGradient[t2] *= dx1d;
-        } else {
-          curGradient[t2] *= val1d;
-        }
-      }
+    if (order >= 1) {
+      derivatives[1] = baseDeriv1.eval(l, i, x) * innerDerivative[t];
     }
+  };
 
-    result += alpha[i] * curValue;
-    gradient.add(curGradient);
-  }
-
-  return result;
+  return evaluator.evalGradient(eval1D, alpha, pointInUnitCube.getPointer(), gradient);
 }
 
 void OperationEvalGradientNakBsplineBoundaryNaive::evalGradient(const DataMatrix& alpha,
-                                                               const DataVector& point,
-                                                               DataVector& value,
-                                                               DataMatrix& gradient) {
-  const size_t n = storage.getSize();
+                                                                const DataVector& point,
+                                                                DataVector& value,
+                                                                DataMatrix& gradient) {
   const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
@@ -72,41 +50,64 @@ void OperationEvalGradientNakBsplineBoundaryNaive::evalGradient(const DataMatrix
     innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
   }
 
-  value.resize(m);
-  value.setAll(0.0);
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
 
-  gradient.resize(m, d);
-  gradient.setAll(0.0);
+  auto eval1D = [this](size_t t, size_t order, uint32_t l, uint32_t i, double x,
+                       double* derivatives) {
+    derivatives[0] = base.eval(l, i, x);
 
-  DataVector curGradient(d);
+    if (order >= 1) {
+      derivatives[1] = baseDeriv1.eval(l, i, x) * innerDerivative[t];
+    }
+  };
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-    curGradient.setAll(1.0);
+  evaluator.evalGradient(eval1D, alpha, pointInUnitCube.getPointer(), value, gradient);
+}
 
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = baseDeriv1.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
+void OperationEvalGradientNakBsplineBoundaryNaive::evalGradient(const DataVector& alpha,
+                                                                const DataMatrix& points,
+                                                                DataVector& value,
+                                                                DataMatrix& gradient) {
+  const size_t d = storage.getDimension();
+  const size_t numberOfPoints = points.getNrows();
 
-      curValue *= val1d;
+  DataMatrix pointsInUnitCube(points);
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-      for (size_t t2 = 0; t2 < d; t2++) {
-        if (t2 == t) {
-          curGradient[t2] *= dx1d;
-        } else {
-          curGradient[t2] *= val1d;
-        }
-      }
-    }
+  for (size_t t = 0; t < d; t++) {
+    innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+  }
 
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
+
+  value.resize(numberOfPoints);
+  gradient.resize(numberOfPoints, d);
+
+#pragma omp parallel
+  {
+    // every thread uses its own copy of the 1D basis
+    SNakBsplineBase threadBase(base);
+    SNakBsplineBaseDeriv1 threadBaseDeriv1(baseDeriv1);
+    auto eval1D = [&](size_t t, size_t order, uint32_t l, uint32_t i, double x,
+                      double* derivatives) {
+      derivatives[0] = threadBase.eval(l, i, x);
 
-      for (size_t t = 0; t < d; t++) {
-        gradient(j, t) += alpha(i, j) * curGradient[t];
+      if (order >= 1) {
+        derivatives[1] = threadBaseDeriv1.eval(l, i, x) * innerDerivative[t];
       }
+    };
+
+    DataVector curGradient(d);
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t k = 0; k < numberOfPoints; k++) {
+      value[k] = evaluator.evalGradient(eval1D, alpha, pointsInUnitCube.getPointer() + k * d,
+                                        curGradient);
+      gradient.setRow(k, curGradient);
     }
   }
 }
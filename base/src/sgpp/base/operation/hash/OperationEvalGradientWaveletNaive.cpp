@@ -12,9 +12,7 @@ namespace base {
 double OperationEvalGradientWaveletNaive::evalGradient(const DataVector& alpha,
                                                        const DataVector& point,
                                                        DataVector& gradient) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  double result = 0.0;
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
@@ -23,46 +21,20 @@ double OperationEvalGradientWaveletNaive::evalGradient(const DataVector& alpha,
     innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
   }
 
-  gradient.resize(storage.getDimension());
-  gradient.setAll(0.0);
-
-  DataVector curGradient(d);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-    curGradient.setAll(alpha[i]);
-
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = base.evalDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
-
-      curValue *= val1d;
-
-      for (size_t t2 = 0; t2 < d; t2++) {
-        if (t2 == t) {
-          curGradient[t2] *= dx1d;
-        } else {
-          curGradient[t2] *= val1d;
-        }
-      }
-    }
-
-    result += alpha[i] * curValue;
-    gradient.add(curGradient);
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
   }
 
-  return result;
+  BasisDerivativeEvaluation<SWaveletBase> eval1D(base, innerDerivative);
+
+  return evaluator.evalGradient(eval1D, alpha, pointInUnitCube.getPointer(), gradient);
 }
 
 void OperationEvalGradientWaveletNaive::evalGradient(const DataMatrix& alpha,
                                                      const DataVector& point,
                                                      DataVector& value,
                                                      DataMatrix& gradient) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
@@ -71,41 +43,49 @@ void OperationEvalGradientWaveletNaive::evalGradient(const DataMatrix& alpha,
     innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
   }
 
-  value.resize(m);
-  value.setAll(0.0);
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
+
+  BasisDerivativeEvaluation<SWaveletBase> eval1D(base, innerDerivative);
 
-  gradient.resize(m, d);
-  gradient.setAll(0.0);
+  evaluator.evalGradient(eval1D, alpha, pointInUnitCube.getPointer(), value, gradient);
+}
+
+void OperationEvalGradientWaveletNaive::evalGradient(const DataVector& alpha,
+                                                     const DataMatrix& points,
+                                                     DataVector& value,
+                                                     DataMatrix& gradient) {
+  const size_t d = storage.getDimension();
+  const size_t numberOfPoints = points.getNrows();
 
-  DataVector curGradient(d);
+  DataMatrix pointsInUnitCube(points);
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-    curGradient.setAll(1.0);
+  for (size_t t = 0; t < d; t++) {
+    innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+  }
 
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = base.evalDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
 
-      curValue *= val1d;
+  value.resize(numberOfPoints);
+  gradient.resize(numberOfPoints, d);
 
-      for (size_t t2 = 0; t2 < d; t2++) {
-        if (t2 == t) {
-          curGradient[t2] *= dx1d;
-        } else {
-          curGradient[t2] *= val1d;
-        }
-      }
-    }
+#pragma omp parallel
+  {
+    // every thread uses its own copy of the 1D basis
+    SWaveletBase threadBase(base);
+    BasisDerivativeEvaluation<SWaveletBase> eval1D(threadBase, innerDerivative);
 
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
+    DataVector curGradient(d);
 
-      for (size_t t = 0; t < d; t++) {
-        gradient(j, t) += alpha(i, j) * curGradient[t];
-      }
+#pragma omp for schedule(dynamic, 16)
+    for (size_t k = 0; k < numberOfPoints; k++) {
+      value[k] = evaluator.evalGradient(eval1D, alpha, pointsInUnitCube.getPointer() + k * d,
+                                        curGradient);
+      gradient.setRow(k, curGradient);
     }
   }
 }
@@ -14,42 +14,30 @@ double OperationEvalPartialDerivativeNakBsplineBoundaryNaive::evalPartialDerivat
     const DataVector& point,
     size_t derivDim,
     double& partialDerivative) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  double result = 0.0;
 
-  partialDerivative = 0.0;
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  const double innerDerivative = 1.0 / storage.getBoundingBox()->getIntervalWidth(derivDim);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-    double curPartialDerivative = 1.0;
-
-    const double dx1d = baseDeriv1.eval(gp.getLevel(derivDim), gp.getIndex(derivDim),
-                                    pointInUnitCube[derivDim]) * innerDerivative;
+  for (size_t t = 0; t < d; t++) {
+    innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+  }
 
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
 
-      if ((val1d == 0.0) && (t != derivDim)) {
-        curValue = 0.0;
-        curPartialDerivative = 0.0;
-        break;
-      }
+  auto eval1D = [this](size_t t, size_t order, uint32_t l, uint32_t i, double x,
+                       double* derivatives) {
+    derivatives[0] = base.eval(l, i, x);
 
-      curValue *= val1d;
-      curPartialDerivative *= ((t == derivDim) ? dx1d : val1d);
+    if (order >= 1) {
+      derivatives[1] = baseDeriv1.eval(l, i, x) * innerDerivative[t];
     }
+  };
 
-    result += alpha[i] * curValue;
-    partialDerivative += alpha[i] * curPartialDerivative;
-  }
-
-  return result;
+  return evaluator.evalPartialDerivative(eval1D, alpha, pointInUnitCube.getPointer(), derivDim,
+                                         partialDerivative);
 }
 
 void OperationEvalPartialDerivativeNakBsplineBoundaryNaive::evalPartialDerivative(
@@ -58,46 +46,30 @@ void OperationEvalPartialDerivativeNakBsplineBoundaryNaive::evalPartialDerivativ
     size_t derivDim,
     DataVector& value,
     DataVector& partialDerivative) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  const double innerDerivative = 1.0 / storage.getBoundingBox()->getIntervalWidth(derivDim);
-
-  value.resize(m);
-  value.setAll(0.0);
-  partialDerivative.resize(m);
-  partialDerivative.setAll(0.0);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-    double curPartialDerivative = 1.0;
-
-    const double dx1d = baseDeriv1.eval(gp.getLevel(derivDim), gp.getIndex(derivDim),
-                                    pointInUnitCube[derivDim]) * innerDerivative;
+  for (size_t t = 0; t < d; t++) {
+    innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+  }
 
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
+  if (!evaluator.isPrepared(storage)) {
+    evaluator.prepare(storage);
+  }
 
-      if ((val1d == 0.0) && (t != derivDim)) {
-        curValue = 0.0;
-        curPartialDerivative = 0.0;
-        break;
-      }
+  auto eval1D = [this](size_t t, size_t order, uint32_t l, uint32_t i, double x,
+                       double* derivatives) {
+    derivatives[0] = base.eval(l, i, x);
 
-      curValue *= val1d;
-      curPartialDerivative *= ((t == derivDim) ? dx1d : val1d);
+    if (order >= 1) {
+      derivatives[1] = baseDeriv1.eval(l, i, x) * innerDerivative[t];
     }
+  };
 
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
-      partialDerivative[j] += alpha(i, j) * curPartialDerivative;
-    }
-  }
+  evaluator.evalPartialDerivative(eval1D, alpha, pointInUnitCube.getPointer(), derivDim, value,
+                                  partialDerivative);
 }
 
 }  // namespace base
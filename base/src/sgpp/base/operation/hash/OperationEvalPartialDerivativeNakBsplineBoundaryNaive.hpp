@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalPartialDerivative.hpp>
+#include <sgpp/base/algorithm/AlgorithmEvaluationDerivativesPruned.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/NakBsplineBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/NakBsplineBasisDeriv1.hpp>
@@ -34,7 +35,8 @@ class OperationEvalPartialDerivativeNakBsplineBoundaryNaive :
     storage(storage),
     base(degree),
     baseDeriv1(degree),
-    pointInUnitCube(storage.getDimension()) {
+    pointInUnitCube(storage.getDimension()),
+    innerDerivative(storage.getDimension()) {
   }
 
   /**
@@ -80,6 +82,10 @@ class OperationEvalPartialDerivativeNakBsplineBoundaryNaive :
   SNakBsplineBaseDeriv1 baseDeriv1;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// inner derivative (temporary vector)
+  DataVector innerDerivative;
+  /// support-pruned evaluation of the basis functions and their derivatives
+  AlgorithmEvaluationDerivativesPruned evaluator;
 };
 
 }  // namespace base
@@ -6,6 +6,8 @@
 #include <sgpp/base/operation/hash/OperationHierarchisationModBspline.hpp>
 
 #include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationEvalModBsplineNaive.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -15,14 +17,35 @@ namespace base {
 
 void OperationHierarchisationModBspline::doHierarchisation(
   DataVector& node_values) {
-  throw operation_exception(
-    "This operation is not implemented, yet! Sorry ;-)");
+  DataMatrix values(node_values.getPointer(), node_values.getSize(), 1);
+
+  if (!sle_solver::CombinationTechnique::hierarchise(
+          storage,
+          [this](GridPoint::level_type l, GridPoint::index_type i, double x) {
+            return base.eval(l, i, x);
+          },
+          values)) {
+    throw operation_exception(
+      "OperationHierarchisationModBspline: Only grids that are unions of full grids "
+      "(e.g., regular or dimensionally adaptive sparse grids) are supported, "
+      "use OperationMultipleHierarchisationModBspline otherwise.");
+  }
+
+  values.getColumn(0, node_values);
 }
 
 void OperationHierarchisationModBspline::doDehierarchisation(
   DataVector& alpha) {
-  throw operation_exception(
-    "This operation is not implemented, yet! Sorry ;-)");
+  OperationEvalModBsplineNaive opEval(storage, base.getDegree());
+  DataVector nodeValues(storage.getSize());
+  DataVector x(storage.getDimension());
+
+  for (size_t j = 0; j < storage.getSize(); j++) {
+    storage.getCoordinates(storage[j], x);
+    nodeValues[j] = opEval.eval(alpha, x);
+  }
+
+  alpha = nodeValues;
 }
 
 }  // namespace base
@@ -101,6 +101,29 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with multiple coefficient vectors at once
+   *
+   * Kernels may override this to determine the affected basis functions of each data point
+   * only once for all coefficient vectors; by default, mult() is called for each column.
+   *
+   * @param alpha matrix whose columns are the coefficient vectors
+   * @param result matrix in which entry (i, k) is the value at data point i for column k
+   */
+  virtual void multMatrix(const DataMatrix& alpha, DataMatrix& result) {
+    const size_t numberOfPoints = dataset.getNrows();
+    DataVector curAlpha(alpha.getNrows());
+    DataVector curResult(numberOfPoints);
+
+    result.resize(numberOfPoints, alpha.getNcols());
+
+    for (size_t k = 0; k < alpha.getNcols(); k++) {
+      alpha.getColumn(k, curAlpha);
+      mult(curAlpha, curResult);
+      result.setColumn(k, curResult);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
@@ -119,6 +142,17 @@ class OperationMultipleEval {
    */
   virtual void prepare() {}
 
+  /**
+   * Has to be called after the contents or the number of rows of the data set (that was passed to
+   * the constructor) have changed, while the grid is unchanged. Kernels that keep a copy or a
+   * transformed version of the data set update it, but keep the data structures that have been
+   * derived from the grid. This allows to reuse an operation for several batches of data points.
+   *
+   * @return whether the kernel supports updating the data set; if not, a new operation
+   * has to be created for the changed data set
+   */
+  virtual bool updateDataset() { return false; }
+
   virtual double getDuration() = 0;
 
   /**
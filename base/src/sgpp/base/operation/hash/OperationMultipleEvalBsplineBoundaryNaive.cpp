@@ -11,67 +11,31 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalBsplineBoundaryNaive::mult(DataVector& alpha, DataVector& result) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
+  prepare();
 
-  result.setAll(0.0);
-
-  pointsInUnitCube = dataset;
-  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
-
-  for (size_t j = 0; j < m; j++) {
-    for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
-      double curValue = 1.0;
-
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
-
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
-
-        curValue *= val1d;
-      }
-
-      result[j] += alpha[i] * curValue;
-    }
-  }
+  // the boundary B-splines coincide with the uniform B-splines of the same degree,
+  // use the kernels specialized for the degree (without virtual calls) if available
+  visitFixedDegreeBsplineBasis(
+      base.getDegree(), base, decltype(algorithm)::MultVisitor{algorithm, alpha, result});
 }
 
 void OperationMultipleEvalBsplineBoundaryNaive::multTranspose(DataVector& alpha,
                                                               DataVector& result) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
+  prepare();
 
-  pointsInUnitCube = dataset;
-  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-
-    for (size_t j = 0; j < m; j++) {
-      double curValue = 1.0;
-
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
-
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
+  // the boundary B-splines coincide with the uniform B-splines of the same degree,
+  // use the kernels specialized for the degree (without virtual calls) if available
+  visitFixedDegreeBsplineBasis(
+      base.getDegree(), base, decltype(algorithm)::MultTransposeVisitor{algorithm, alpha, result});
+}
 
-        curValue *= val1d;
-      }
+void OperationMultipleEvalBsplineBoundaryNaive::prepare() {
+  algorithm.prepare(storage, dataset);
+  isPrepared = true;
+}
 
-      result[i] += alpha[j] * curValue;
-    }
-  }
+bool OperationMultipleEvalBsplineBoundaryNaive::updateDataset() {
+  return true;
 }
 
 double OperationMultipleEvalBsplineBoundaryNaive::getDuration() { return 0.0; }
@@ -50,6 +50,9 @@ class OperationMultipleEvalInterModLinear : public OperationMultipleEval {
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
 
+  /// the data set is read directly in every evaluation, nothing has to be updated
+  bool updateDataset() override { return true; }
+
 
   double getDuration() override { return 0.0; }
 
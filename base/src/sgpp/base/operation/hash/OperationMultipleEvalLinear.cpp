@@ -3,6 +3,7 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
@@ -26,6 +27,14 @@ void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& r
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::multMatrix(const DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  result.resize(this->dataset.getNrows(), alpha.getNcols());
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -26,6 +26,14 @@ void OperationMultipleEvalLinearBoundary::multTranspose(DataVector& source, Data
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalLinearBoundary::multMatrix(const DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBoundaryBase> op;
+  LinearBoundaryBasis<unsigned int, unsigned int> base;
+
+  result.resize(this->dataset.getNrows(), alpha.getNcols());
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalLinearBoundary::getDuration() { return 0.0; }
 
 }  // namespace base
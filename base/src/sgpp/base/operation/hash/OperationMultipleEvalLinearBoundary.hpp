@@ -37,6 +37,10 @@ class OperationMultipleEvalLinearBoundary : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multMatrix(const DataMatrix& alpha, DataMatrix& result) override;
+
+  /// the data set is read directly in every evaluation, nothing has to be updated
+  bool updateDataset() override { return true; }
 
   double getDuration() override;
 
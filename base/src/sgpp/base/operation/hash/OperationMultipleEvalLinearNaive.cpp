@@ -4,8 +4,16 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearNaive.hpp>
+#include <sgpp/base/grid/storage/hashmap/FlatGridStorage.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace sgpp {
 namespace base {
 
@@ -19,23 +27,34 @@ void OperationMultipleEvalLinearNaive::mult(DataVector& alpha, DataVector& resul
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-  for (size_t j = 0; j < m; j++) {
-    for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
-      double curValue = 1.0;
+  // levels and indices of all grid points in contiguous arrays per dimension
+  const FlatGridStorage flatStorage(storage);
+
+#pragma omp parallel
+  {
+    std::vector<double> values(n);
+
+#pragma omp for schedule(static)
+    for (size_t j = 0; j < m; j++) {
+      std::fill(values.begin(), values.end(), 1.0);
 
       for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+        const FlatGridStorage::level_type* level = flatStorage.getLevelArray(t);
+        const FlatGridStorage::index_type* index = flatStorage.getIndexArray(t);
+        const double x = pointsInUnitCube(j, t);
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
+        for (size_t i = 0; i < n; i++) {
+          values[i] *= base.eval(level[i], index[i], x);
         }
+      }
+
+      double curResult = 0.0;
 
-        curValue *= val1d;
+      for (size_t i = 0; i < n; i++) {
+        curResult += alpha[i] * values[i];
       }
 
-      result[j] += alpha[i] * curValue;
+      result[j] = curResult;
     }
   }
 }
@@ -50,24 +69,38 @@ void OperationMultipleEvalLinearNaive::multTranspose(DataVector& alpha, DataVect
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
+  // levels and indices of all grid points in contiguous arrays per dimension
+  const FlatGridStorage flatStorage(storage);
+
+#pragma omp parallel
+  {
+    // every thread accumulates the results of a contiguous range of grid points
+    size_t threadCount = 1;
+    size_t threadIndex = 0;
+#ifdef _OPENMP
+    threadCount = static_cast<size_t>(omp_get_num_threads());
+    threadIndex = static_cast<size_t>(omp_get_thread_num());
+#endif
+    const size_t begin = n * threadIndex / threadCount;
+    const size_t end = n * (threadIndex + 1) / threadCount;
+    std::vector<double> values(end - begin);
 
     for (size_t j = 0; j < m; j++) {
-      double curValue = 1.0;
+      std::fill(values.begin(), values.end(), 1.0);
 
       for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+        const FlatGridStorage::level_type* level = flatStorage.getLevelArray(t);
+        const FlatGridStorage::index_type* index = flatStorage.getIndexArray(t);
+        const double x = pointsInUnitCube(j, t);
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
+        for (size_t i = begin; i < end; i++) {
+          values[i - begin] *= base.eval(level[i], index[i], x);
         }
-
-        curValue *= val1d;
       }
 
-      result[i] += alpha[j] * curValue;
+      for (size_t i = begin; i < end; i++) {
+        result[i] += alpha[j] * values[i - begin];
+      }
     }
   }
 }
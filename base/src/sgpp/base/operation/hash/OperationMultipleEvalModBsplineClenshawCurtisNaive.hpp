@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <sgpp/base/algorithm/AlgorithmMultipleEvaluationBlocked.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineModifiedClenshawCurtisBasis.hpp>
@@ -24,6 +25,20 @@ class OperationMultipleEvalModBsplineClenshawCurtisNaive : public OperationMulti
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
 
+  /**
+   * Sorts the grid points by level and transforms the data points into the unit cube.
+   * Has to be called if the grid or the data points have changed; it is called automatically
+   * if the number of grid points or data points has changed.
+   */
+  void prepare() override;
+
+  /**
+   * Nothing to do, the data points are read in every evaluation (the sorted grid is kept).
+   *
+   * @return true
+   */
+  bool updateDataset() override;
+
   double getDuration() override;
 
  protected:
@@ -31,8 +46,8 @@ class OperationMultipleEvalModBsplineClenshawCurtisNaive : public OperationMulti
   GridStorage& storage;
   /// 1D B-spline basis
   SBsplineModifiedClenshawCurtisBase base;
-  /// untransformed evaluation point (temporary vector)
-  DataMatrix pointsInUnitCube;
+  /// blocked and multi-threaded evaluation kernel (caches sorted grid and transformed data)
+  AlgorithmMultipleEvaluationBlocked<SBsplineModifiedClenshawCurtisBase> algorithm;
 };
 
 }  // namespace base
@@ -27,6 +27,14 @@ void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVecto
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalModLinear::multMatrix(const DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  result.resize(this->dataset.getNrows(), alpha.getNcols());
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -0,0 +1,184 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef FIXED_DEGREE_BSPLINE_BASE_HPP
+#define FIXED_DEGREE_BSPLINE_BASE_HPP
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Coefficients of the polynomial pieces of the uniform B-spline of a fixed degree.
+ * getPiece(k) returns the coefficients (highest power first) of the piece on \f$[k, k+1)\f$
+ * as a polynomial in the local coordinate \f$t = x - k \in [0, 1)\f$.
+ */
+template <size_t DEGREE>
+struct FixedDegreeBsplineCoefficients;
+
+template <>
+struct FixedDegreeBsplineCoefficients<1> {
+  static inline const double* getPiece(size_t k) {
+    static const double coefficients[2][2] = {{1.0, 0.0}, {-1.0, 1.0}};
+    return coefficients[k];
+  }
+};
+
+template <>
+struct FixedDegreeBsplineCoefficients<3> {
+  static inline const double* getPiece(size_t k) {
+    static const double coefficients[4][4] = {{1.0 / 6.0, 0.0, 0.0, 0.0},
+                                              {-0.5, 0.5, 0.5, 1.0 / 6.0},
+                                              {0.5, -1.0, 0.0, 2.0 / 3.0},
+                                              {-1.0 / 6.0, 0.5, -0.5, 1.0 / 6.0}};
+    return coefficients[k];
+  }
+};
+
+template <>
+struct FixedDegreeBsplineCoefficients<5> {
+  static inline const double* getPiece(size_t k) {
+    static const double coefficients[6][6] = {
+        {1.0 / 120.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {-1.0 / 24.0, 1.0 / 24.0, 1.0 / 12.0, 1.0 / 12.0, 1.0 / 24.0, 1.0 / 120.0},
+        {1.0 / 12.0, -1.0 / 6.0, -1.0 / 6.0, 1.0 / 6.0, 5.0 / 12.0, 13.0 / 60.0},
+        {-1.0 / 12.0, 0.25, 0.0, -0.5, 0.0, 11.0 / 20.0},
+        {1.0 / 24.0, -1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, -5.0 / 12.0, 13.0 / 60.0},
+        {-1.0 / 120.0, 1.0 / 24.0, -1.0 / 12.0, 1.0 / 12.0, -1.0 / 24.0, 1.0 / 120.0}};
+    return coefficients[k];
+  }
+};
+
+/**
+ * B-spline basis on Noboundary grids with a degree fixed at compile time
+ * (supported degrees: 1, 3, 5).
+ *
+ * The values are the same as the ones of BsplineBasis with the same degree, but the
+ * evaluation does not dispatch on the degree at runtime: the piece containing the evaluation
+ * point is selected by a table lookup and evaluated with Horner's method (with a loop of
+ * constant length). As the class is final, eval() is not called virtually if the static type
+ * of the basis is known, e.g., in the templated kernels of the multiple evaluation.
+ * Derivatives and integrals are inherited from BsplineBasis.
+ */
+template <class LT, class IT, size_t DEGREE>
+class FixedDegreeBsplineBasis final : public BsplineBasis<LT, IT> {
+  static_assert((DEGREE == 1) || (DEGREE == 3) || (DEGREE == 5),
+                "FixedDegreeBsplineBasis only supports the degrees 1, 3 and 5");
+
+ public:
+  /**
+   * Default constructor.
+   */
+  FixedDegreeBsplineBasis() : BsplineBasis<LT, IT>(DEGREE) {}
+
+  /**
+   * Constructor.
+   *
+   * @param degree    B-spline degree, must be equal to DEGREE
+   */
+  explicit FixedDegreeBsplineBasis(size_t degree) : BsplineBasis<LT, IT>(DEGREE) {
+    if (degree != DEGREE) {
+      throw operation_exception("FixedDegreeBsplineBasis: degree mismatch");
+    }
+  }
+
+  /**
+   * Destructor.
+   */
+  ~FixedDegreeBsplineBasis() override {}
+
+  using BsplineBasis<LT, IT>::uniformBSpline;
+
+  /**
+   * @param x     evaluation point
+   * @return      value of uniform B-spline of degree DEGREE
+   *              (with knots \f$\{0, 1, ..., DEGREE+1\}\f$)
+   */
+  static inline double uniformBSpline(double x) {
+    // negated comparison to map NaN to zero, too
+    if (!(x >= 0.0) || (x >= static_cast<double>(DEGREE + 1))) {
+      return 0.0;
+    }
+
+    const size_t k = static_cast<size_t>(x);
+    const double t = x - static_cast<double>(k);
+    const double* coefficients = FixedDegreeBsplineCoefficients<DEGREE>::getPiece(k);
+    double result = coefficients[0];
+
+    for (size_t j = 1; j <= DEGREE; j++) {
+      result = coefficients[j] + result * t;
+    }
+
+    return result;
+  }
+
+  /**
+   * @param l     level of basis function
+   * @param i     index of basis function
+   * @param x     evaluation point
+   * @return      value of B-spline basis function
+   */
+  inline double eval(LT l, IT i, double x) override {
+    const double hInv = static_cast<double>(static_cast<IT>(1) << l);
+
+    return uniformBSpline(x * hInv - static_cast<double>(i) +
+                          static_cast<double>(DEGREE + 1) / 2.0);
+  }
+};
+
+// default type-defs (unsigned int for level and index)
+typedef FixedDegreeBsplineBasis<unsigned int, unsigned int, 1> SBsplineBaseDegree1;
+typedef FixedDegreeBsplineBasis<unsigned int, unsigned int, 3> SBsplineBaseDegree3;
+typedef FixedDegreeBsplineBasis<unsigned int, unsigned int, 5> SBsplineBaseDegree5;
+
+/**
+ * Calls a templated kernel with the FixedDegreeBsplineBasis of the given degree
+ * if the degree is supported (1, 3 or 5) and with a fallback basis otherwise.
+ * This way, the kernel is instantiated without virtual calls to the 1D evaluation
+ * for the common degrees.
+ *
+ * @tparam VISITOR        functor with a templated operator()(BASIS&) and a result_type typedef
+ * @tparam FALLBACK_BASIS type of the fallback basis
+ * @param degree          B-spline degree
+ * @param fallbackBasis   basis to use if there is no FixedDegreeBsplineBasis for the degree
+ *                        (must have the same values as the uniform B-splines of the degree)
+ * @param visitor         kernel to call
+ * @return                return value of the kernel
+ */
+template <class VISITOR, class FALLBACK_BASIS>
+inline typename VISITOR::result_type visitFixedDegreeBsplineBasis(size_t degree,
+                                                                  FALLBACK_BASIS& fallbackBasis,
+                                                                  const VISITOR& visitor) {
+  switch (degree) {
+    case 1: {
+      SBsplineBaseDegree1 fixedDegreeBasis;
+      return visitor(fixedDegreeBasis);
+    }
+
+    case 3: {
+      SBsplineBaseDegree3 fixedDegreeBasis;
+      return visitor(fixedDegreeBasis);
+    }
+
+    case 5: {
+      SBsplineBaseDegree5 fixedDegreeBasis;
+      return visitor(fixedDegreeBasis);
+    }
+
+    default:
+      return visitor(fallbackBasis);
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* FIXED_DEGREE_BSPLINE_BASE_HPP */
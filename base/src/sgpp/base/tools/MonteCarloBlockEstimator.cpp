@@ -0,0 +1,121 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/MonteCarloBlockEstimator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+MonteCarloBlockEstimator::MonteCarloBlockEstimator(size_t numberOfSamples, size_t blockSize)
+    : numberOfSamples(numberOfSamples), blockSize(blockSize) {
+  if (blockSize == 0) {
+    throw tool_exception("MonteCarloBlockEstimator: block size must be positive");
+  }
+}
+
+void MonteCarloBlockEstimator::run(const BlockFunction& blockSum, double tolerance) {
+  const size_t numberOfBlocks = (numberOfSamples + blockSize - 1) / blockSize;
+  blockMeans.clear();
+  blockSizes.clear();
+
+  for (size_t roundBegin = 0; roundBegin < numberOfBlocks; roundBegin += BLOCKS_PER_ROUND) {
+    const size_t roundEnd = std::min(roundBegin + BLOCKS_PER_ROUND, numberOfBlocks);
+    std::vector<double> sums(roundEnd - roundBegin);
+    std::vector<std::exception_ptr> exceptions(roundEnd - roundBegin);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t block = roundBegin; block < roundEnd; block++) {
+      const size_t begin = block * blockSize;
+      const size_t curBlockSize = std::min(blockSize, numberOfSamples - begin);
+
+      try {
+        sums[block - roundBegin] = blockSum(block, begin, curBlockSize);
+      } catch (...) {
+        exceptions[block - roundBegin] = std::current_exception();
+      }
+    }
+
+    for (size_t block = roundBegin; block < roundEnd; block++) {
+      if (exceptions[block - roundBegin]) {
+        std::rethrow_exception(exceptions[block - roundBegin]);
+      }
+
+      const size_t curBlockSize = std::min(blockSize, numberOfSamples - block * blockSize);
+      blockMeans.push_back(sums[block - roundBegin] / static_cast<double>(curBlockSize));
+      blockSizes.push_back(curBlockSize);
+    }
+
+    if ((tolerance > 0.0) && (std::sqrt(getVariance()) <= tolerance)) {
+      break;
+    }
+  }
+}
+
+double MonteCarloBlockEstimator::getMean() const {
+  const size_t n = getNumberOfSamples();
+
+  if (n == 0) {
+    return 0.0;
+  }
+
+  double result = 0.0;
+
+  for (size_t b = 0; b < blockMeans.size(); b++) {
+    result += static_cast<double>(blockSizes[b]) * blockMeans[b];
+  }
+
+  return result / static_cast<double>(n);
+}
+
+double MonteCarloBlockEstimator::getVariance() const {
+  const size_t numberOfBlocks = blockMeans.size();
+
+  if (numberOfBlocks < 2) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  // weighted sample variance of the block means, for equal block sizes this is
+  // 1/(B (B-1)) sum_b (m_b - m)^2
+  const double mean = getMean();
+  const double n = static_cast<double>(getNumberOfSamples());
+  double result = 0.0;
+
+  for (size_t b = 0; b < numberOfBlocks; b++) {
+    const double weight = static_cast<double>(blockSizes[b]) / n;
+    const double diff = blockMeans[b] - mean;
+    result += weight * weight * diff * diff;
+  }
+
+  return result * static_cast<double>(numberOfBlocks) / static_cast<double>(numberOfBlocks - 1);
+}
+
+size_t MonteCarloBlockEstimator::getNumberOfSamples() const {
+  size_t result = 0;
+
+  for (size_t curBlockSize : blockSizes) {
+    result += curBlockSize;
+  }
+
+  return result;
+}
+
+size_t MonteCarloBlockEstimator::getNumberOfBlocks() const { return blockMeans.size(); }
+
+std::uint64_t MonteCarloBlockEstimator::getBlockSeed(std::uint64_t seed, size_t block) {
+  std::uint64_t z = seed + (static_cast<std::uint64_t>(block) + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+}  // namespace base
+}  // namespace sgpp
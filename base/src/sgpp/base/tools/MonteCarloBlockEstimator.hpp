@@ -0,0 +1,104 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Monte Carlo estimator that evaluates the samples in independent blocks.
+ *
+ * The samples \f$0, \dotsc, N-1\f$ are split into blocks of a fixed size, which are evaluated in
+ * parallel. The estimate of the mean is the weighted mean of the block means and its variance is
+ * estimated from the spread of the block means, which is also valid for stratified and
+ * quasi-random samples (as long as the blocks are independent replications; for consecutive
+ * segments of a low-discrepancy sequence, the estimate is conservative).
+ *
+ * The blocks are processed in rounds of BLOCKS_PER_ROUND blocks. After every round, the
+ * evaluation stops if the estimated standard error is below a given tolerance. As the rounds do
+ * not depend on the number of threads, the result is reproducible if every block draws its samples
+ * from its own random number stream (see getBlockSeed()).
+ */
+class MonteCarloBlockEstimator {
+ public:
+  /**
+   * Function that returns the sum of the integrand over the samples of a block.
+   * Parameters: index of the block, index of the first sample, number of samples in the block.
+   * The function is called concurrently for different blocks.
+   */
+  typedef std::function<double(size_t, size_t, size_t)> BlockFunction;
+
+  /// number of blocks between two checks of the tolerance
+  static const size_t BLOCKS_PER_ROUND = 16;
+
+  /**
+   * Constructor.
+   *
+   * @param numberOfSamples   maximal number of samples
+   * @param blockSize         number of samples per block (the last block may be smaller)
+   */
+  MonteCarloBlockEstimator(size_t numberOfSamples, size_t blockSize);
+
+  /**
+   * Evaluates the blocks (discards previous results).
+   *
+   * @param blockSum    function returning the sum of the integrand over a block
+   * @param tolerance   the evaluation stops as soon as the estimated standard error of the mean
+   *                    is at most this value (0: evaluate all samples)
+   */
+  void run(const BlockFunction& blockSum, double tolerance = 0.0);
+
+  /**
+   * @return estimated mean of the integrand
+   */
+  double getMean() const;
+
+  /**
+   * @return estimated variance of getMean()
+   *         (infinity if fewer than two blocks have been evaluated)
+   */
+  double getVariance() const;
+
+  /**
+   * @return number of samples that have been evaluated
+   */
+  size_t getNumberOfSamples() const;
+
+  /**
+   * @return number of blocks that have been evaluated
+   */
+  size_t getNumberOfBlocks() const;
+
+  /**
+   * Derives the seed of a random number stream for a block from a global seed (SplitMix64), such
+   * that the streams of different blocks are decorrelated.
+   *
+   * @param seed    global seed
+   * @param block   index of the block
+   * @return        seed for the block
+   */
+  static std::uint64_t getBlockSeed(std::uint64_t seed, size_t block);
+
+ protected:
+  /// maximal number of samples
+  size_t numberOfSamples;
+  /// number of samples per block
+  size_t blockSize;
+  /// means of the evaluated blocks
+  std::vector<double> blockMeans;
+  /// sizes of the evaluated blocks
+  std::vector<size_t> blockSizes;
+};
+
+}  // namespace base
+}  // namespace sgpp
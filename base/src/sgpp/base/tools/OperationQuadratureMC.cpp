@@ -6,6 +6,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/tools/MonteCarloBlockEstimator.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -13,12 +14,18 @@
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
 
 namespace sgpp {
 namespace base {
 
 OperationQuadratureMC::OperationQuadratureMC(Grid& grid, int mcPaths)
-    : grid(&grid), mcPaths(mcPaths) {
+    : grid(&grid),
+      mcPaths(mcPaths),
+      seed(static_cast<std::uint64_t>(time(nullptr))),
+      blockSize(1024),
+      varianceEstimate(0.0),
+      numberOfUsedSamples(0) {
   // init seed for random number generator
   srand(static_cast<unsigned>(time(nullptr)));
   // this->simple_rand.seed((unsigned)time(0));
@@ -117,5 +124,121 @@ double OperationQuadratureMC::doQuadratureL2Error(FUNC func, void* clientdata, D
   return sqrt(res / static_cast<double>(mcPaths) * determinant);
 }
 
+double OperationQuadratureMC::doQuadratureBatched(DataVector& alpha, double tolerance) {
+  const size_t dim = grid->getDimension();
+  MonteCarloBlockEstimator estimator(mcPaths, blockSize);
+
+  estimator.run(
+      [this, &alpha, dim](size_t block, size_t, size_t curBlockSize) {
+        DataMatrix samples(curBlockSize, dim);
+        generateBlockSamples(block, samples);
+
+        DataVector res(curBlockSize);
+        std::unique_ptr<OperationMultipleEval>(
+            sgpp::op_factory::createOperationMultipleEval(*grid, samples))
+            ->mult(alpha, res);
+        return res.sum();
+      },
+      tolerance / getBoundingBoxDeterminant());
+
+  const double determinant = getBoundingBoxDeterminant();
+  varianceEstimate = estimator.getVariance() * determinant * determinant;
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return estimator.getMean() * determinant;
+}
+
+double OperationQuadratureMC::doQuadratureFuncBatched(FUNC func, void* clientdata,
+                                                      double tolerance) {
+  const size_t dim = grid->getDimension();
+  MonteCarloBlockEstimator estimator(mcPaths, blockSize);
+
+  estimator.run(
+      [this, func, clientdata, dim](size_t block, size_t, size_t curBlockSize) {
+        DataMatrix samples(curBlockSize, dim);
+        generateBlockSamples(block, samples);
+        double sum = 0.0;
+
+        for (size_t i = 0; i < curBlockSize; i++) {
+          sum += func(static_cast<int>(dim), samples.getPointer() + i * dim, clientdata);
+        }
+
+        return sum;
+      },
+      tolerance / getBoundingBoxDeterminant());
+
+  const double determinant = getBoundingBoxDeterminant();
+  varianceEstimate = estimator.getVariance() * determinant * determinant;
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return estimator.getMean() * determinant;
+}
+
+double OperationQuadratureMC::doQuadratureL2ErrorBatched(FUNC func, void* clientdata,
+                                                         DataVector& alpha, double tolerance) {
+  const size_t dim = grid->getDimension();
+  MonteCarloBlockEstimator estimator(mcPaths, blockSize);
+
+  estimator.run(
+      [this, func, clientdata, &alpha, dim](size_t block, size_t, size_t curBlockSize) {
+        DataMatrix samples(curBlockSize, dim);
+        generateBlockSamples(block, samples);
+
+        DataVector res(curBlockSize);
+        std::unique_ptr<OperationMultipleEval>(
+            sgpp::op_factory::createOperationMultipleEval(*grid, samples))
+            ->mult(alpha, res);
+        double sum = 0.0;
+
+        for (size_t i = 0; i < curBlockSize; i++) {
+          sum += pow(func(static_cast<int>(dim), samples.getPointer() + i * dim, clientdata) -
+                     res[i], 2);
+        }
+
+        return sum;
+      },
+      tolerance / getBoundingBoxDeterminant());
+
+  // the variance of the square root is estimated with the delta method
+  const double determinant = getBoundingBoxDeterminant();
+  const double squaredError = estimator.getMean() * determinant;
+  varianceEstimate = (squaredError > 0.0)
+                         ? estimator.getVariance() * determinant * determinant / (4 * squaredError)
+                         : 0.0;
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return sqrt(squaredError);
+}
+
+double OperationQuadratureMC::getVarianceEstimate() const { return varianceEstimate; }
+
+size_t OperationQuadratureMC::getNumberOfUsedSamples() const { return numberOfUsedSamples; }
+
+void OperationQuadratureMC::setBlockSize(size_t blockSize) { this->blockSize = blockSize; }
+
+size_t OperationQuadratureMC::getBlockSize() const { return blockSize; }
+
+void OperationQuadratureMC::setSeed(std::uint64_t seed) { this->seed = seed; }
+
+void OperationQuadratureMC::generateBlockSamples(size_t block, DataMatrix& samples) {
+  BoundingBox& boundingBox = grid->getBoundingBox();
+  std::mt19937_64 rng(MonteCarloBlockEstimator::getBlockSeed(seed, block));
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < samples.getNrows(); i++) {
+    for (size_t d = 0; d < samples.getNcols(); d++) {
+      samples.set(i, d, boundingBox.transformPointToBoundingBox(d, distribution(rng)));
+    }
+  }
+}
+
+double OperationQuadratureMC::getBoundingBoxDeterminant() {
+  BoundingBox& boundingBox = grid->getBoundingBox();
+  double determinant = 1.0;
+
+  for (size_t d = 0; d < grid->getDimension(); d++) {
+    determinant *= boundingBox.getIntervalWidth(d);
+  }
+
+  return determinant;
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -6,12 +6,14 @@
 #ifndef OPERATIONQUADRATUREMC_HPP
 #define OPERATIONQUADRATUREMC_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationQuadrature.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 // Better random number generator in C++11
+#include <cstdint>
 #include <random>
 
 namespace sgpp {
@@ -71,6 +73,70 @@ class OperationQuadratureMC : public OperationQuadrature {
    */
   double doQuadratureL2Error(FUNC func, void* clientdata, sgpp::base::DataVector& alpha);
 
+  /**
+   * Batched quadrature using simple MC in @f$\Omega=[0,1]^d@f$.
+   * The samples are generated and evaluated (with OperationMultipleEval) in blocks of
+   * getBlockSize() samples, which are processed in parallel. Every block draws its samples from
+   * its own random number stream, which is derived from the seed, such that the result does not
+   * depend on the number of threads.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param tolerance Stop as soon as the estimated standard error is at most this value
+   * (0: use all samples)
+   */
+  double doQuadratureBatched(sgpp::base::DataVector& alpha, double tolerance = 0.0);
+
+  /**
+   * Batched quadrature of an arbitrary function using simple MC in @f$\Omega=[0,1]^d@f$
+   * (see doQuadratureBatched()). The function is called concurrently by multiple threads.
+   *
+   * @param func The function to integrate
+   * @param clientdata Optional data to pass to FUNC
+   * @param tolerance Stop as soon as the estimated standard error is at most this value
+   * (0: use all samples)
+   */
+  double doQuadratureFuncBatched(FUNC func, void* clientdata, double tolerance = 0.0);
+
+  /**
+   * Batched quadrature of the @f$L^2@f$-norm of the error between a given function and the
+   * current sparse grid function using simple MC in @f$\Omega=[0,1]^d@f$
+   * (see doQuadratureBatched()). The function is called concurrently by multiple threads.
+   *
+   * @param func The function @f$f(x)@f$
+   * @param clientdata Optional data to pass to FUNC
+   * @param alpha Coefficient vector for current grid
+   * @param tolerance Stop as soon as the estimated standard error of the squared
+   * @f$L^2@f$-norm is at most this value (0: use all samples)
+   */
+  double doQuadratureL2ErrorBatched(FUNC func, void* clientdata, sgpp::base::DataVector& alpha,
+                                    double tolerance = 0.0);
+
+  /**
+   * @return estimated variance of the result of the last batched quadrature
+   */
+  double getVarianceEstimate() const;
+
+  /**
+   * @return number of samples used by the last batched quadrature
+   */
+  size_t getNumberOfUsedSamples() const;
+
+  /**
+   * @param blockSize Number of samples per block of the batched quadrature
+   */
+  void setBlockSize(size_t blockSize);
+
+  /**
+   * @return number of samples per block of the batched quadrature
+   */
+  size_t getBlockSize() const;
+
+  /**
+   * @param seed Seed for the random number streams of the batched quadrature
+   * (defaults to the current time)
+   */
+  void setSeed(std::uint64_t seed);
+
  protected:
   // Pointer to the grid object
   sgpp::base::Grid* grid;
@@ -78,6 +144,27 @@ class OperationQuadratureMC : public OperationQuadrature {
   size_t mcPaths;
   // random number generator
   std::minstd_rand simple_rand;
+  // seed for the batched quadrature
+  std::uint64_t seed;
+  // number of samples per block of the batched quadrature
+  size_t blockSize;
+  // estimated variance of the last batched quadrature
+  double varianceEstimate;
+  // number of samples used by the last batched quadrature
+  size_t numberOfUsedSamples;
+
+  /**
+   * Generates the samples of a block of the batched quadrature.
+   *
+   * @param block Index of the block
+   * @param[out] samples Matrix whose rows are overwritten by the samples in the bounding box
+   */
+  void generateBlockSamples(size_t block, sgpp::base::DataMatrix& samples);
+
+  /**
+   * @return determinant of the transformation from the unit cube to the bounding box
+   */
+  double getBoundingBoxDeterminant();
 };
 
 }  // namespace base
@@ -0,0 +1,159 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/sle/LUFactorization.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+LUFactorization::LUFactorization(SLE& system)
+    : n(system.getDimension()),
+      lowerBandwidth(0),
+      upperBandwidth(0),
+      isBanded(false),
+      rowWidth(0),
+      isSingular_(false),
+      lu(),
+      pivots(n) {
+  // determine the bandwidths of the matrix
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      if (system.getMatrixEntry(i, j) != 0.0) {
+        lowerBandwidth = std::max(lowerBandwidth, (i > j) ? (i - j) : 0);
+        upperBandwidth = std::max(upperBandwidth, (j > i) ? (j - i) : 0);
+      }
+    }
+  }
+
+  // partial pivoting may increase the upper bandwidth by the lower bandwidth
+  upperBandwidth = std::min(upperBandwidth + lowerBandwidth, (n > 0) ? (n - 1) : 0);
+  isBanded = (lowerBandwidth + upperBandwidth + 1 < n);
+  rowWidth = (isBanded ? (lowerBandwidth + upperBandwidth + 1) : n);
+  lu.assign(n * rowWidth, 0.0);
+
+  // assemble
+  for (size_t i = 0; i < n; i++) {
+    double* row = getRow(i);
+    const size_t jBegin = (isBanded ? (i - std::min(i, lowerBandwidth)) : 0);
+    const size_t jEnd = (isBanded ? std::min(n, i + upperBandwidth - lowerBandwidth + 1) : n);
+
+    for (size_t j = jBegin; j < jEnd; j++) {
+      row[j] = system.getMatrixEntry(i, j);
+    }
+  }
+
+  // LU factorization with partial pivoting
+  for (size_t k = 0; k < n; k++) {
+    const size_t iEnd = std::min(n, k + lowerBandwidth + 1);
+    const size_t jEnd = std::min(n, k + upperBandwidth + 1);
+    size_t p = k;
+
+    for (size_t i = k + 1; i < iEnd; i++) {
+      if (std::abs(getRow(i)[k]) > std::abs(getRow(p)[k])) {
+        p = i;
+      }
+    }
+
+    pivots[k] = p;
+
+    if (getRow(p)[k] == 0.0) {
+      isSingular_ = true;
+      return;
+    }
+
+    if (p != k) {
+      double* rowK = getRow(k);
+      double* rowP = getRow(p);
+
+      for (size_t j = k; j < jEnd; j++) {
+        std::swap(rowK[j], rowP[j]);
+      }
+    }
+
+    const double* rowK = getRow(k);
+
+    for (size_t i = k + 1; i < iEnd; i++) {
+      double* rowI = getRow(i);
+      const double factor = rowI[k] / rowK[k];
+      rowI[k] = factor;
+
+      if (factor != 0.0) {
+        for (size_t j = k + 1; j < jEnd; j++) {
+          rowI[j] -= factor * rowK[j];
+        }
+      }
+    }
+  }
+}
+
+size_t LUFactorization::getDimension() const { return n; }
+
+bool LUFactorization::isSingular() const {
+  return isSingular_;
+}
+
+void LUFactorization::solve(double* B, size_t numberOfRHS) const {
+  const size_t m = numberOfRHS;
+
+  // forward substitution (L y = P b)
+  for (size_t k = 0; k < n; k++) {
+    double* bK = B + k * m;
+
+    if (pivots[k] != k) {
+      std::swap_ranges(bK, bK + m, B + pivots[k] * m);
+    }
+
+    const size_t iEnd = std::min(n, k + lowerBandwidth + 1);
+
+    for (size_t i = k + 1; i < iEnd; i++) {
+      const double factor = getRow(i)[k];
+
+      if (factor != 0.0) {
+        double* bI = B + i * m;
+
+#pragma omp simd
+        for (size_t r = 0; r < m; r++) {
+          bI[r] -= factor * bK[r];
+        }
+      }
+    }
+  }
+
+  // backward substitution (U x = y)
+  for (size_t i = n; i-- > 0;) {
+    const double* rowI = getRow(i);
+    const size_t jEnd = std::min(n, i + upperBandwidth + 1);
+    double* bI = B + i * m;
+
+    for (size_t j = i + 1; j < jEnd; j++) {
+      const double factor = rowI[j];
+
+      if (factor != 0.0) {
+        const double* bJ = B + j * m;
+
+#pragma omp simd
+        for (size_t r = 0; r < m; r++) {
+          bI[r] -= factor * bJ[r];
+        }
+      }
+    }
+
+    const double diagonalInverse = 1.0 / rowI[i];
+
+#pragma omp simd
+    for (size_t r = 0; r < m; r++) {
+      bI[r] *= diagonalInverse;
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,88 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/tools/sle/system/SLE.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * LU factorization with partial pivoting of the matrix of a system of linear equations,
+ * which can be used to solve the system for many right-hand sides.
+ * If the matrix is banded (e.g., for nodal B-spline bases), only the band (including the
+ * fill-in due to pivoting) is stored and eliminated, otherwise the matrix is stored densely.
+ */
+class LUFactorization {
+ public:
+  /**
+   * Constructor, assembles and factorizes the matrix.
+   *
+   * @param system  system of linear equations
+   */
+  explicit LUFactorization(SLE& system);
+
+  /**
+   * @return dimensionality of the system
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return whether the matrix is singular (in this case, solve must not be called)
+   */
+  bool isSingular() const;
+
+  /**
+   * Solve the system for multiple right-hand sides in-place.
+   *
+   * @param[in,out] B         row-major matrix of size (dimension) x (numberOfRHS),
+   *                          every column is one right-hand side, which is replaced by the
+   *                          corresponding solution
+   * @param numberOfRHS       number of right-hand sides
+   */
+  void solve(double* B, size_t numberOfRHS = 1) const;
+
+ protected:
+  /// dimensionality
+  size_t n;
+  /// number of subdiagonals
+  size_t lowerBandwidth;
+  /// number of superdiagonals of U (including fill-in)
+  size_t upperBandwidth;
+  /// whether only the band is stored
+  bool isBanded;
+  /// number of stored entries per row
+  size_t rowWidth;
+  /// whether the matrix is singular
+  bool isSingular_;
+  /// L (without unit diagonal) and U
+  std::vector<double> lu;
+  /// row interchanges, row i has been swapped with row pivots[i]
+  std::vector<size_t> pivots;
+
+  /**
+   * @param i   row index
+   * @return pointer p such that p[j] is entry (i, j) for all j in the stored range of row i
+   */
+  inline double* getRow(size_t i) {
+    return lu.data() + (isBanded ? (i * rowWidth + lowerBandwidth - i) : (i * rowWidth));
+  }
+
+  /**
+   * @param i   row index
+   * @return pointer p such that p[j] is entry (i, j) for all j in the stored range of row i
+   */
+  inline const double* getRow(size_t i) const {
+    return lu.data() + (isBanded ? (i * rowWidth + lowerBandwidth - i) : (i * rowWidth));
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -5,7 +5,6 @@
 
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/Armadillo.hpp>
-#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
 #include <sgpp/globaldef.hpp>
 
 #ifdef USE_ARMADILLO
@@ -18,6 +17,7 @@ typedef arma::mat ArmadilloMatrix;
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -45,57 +45,22 @@ bool Armadillo::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
   const arma::uword n = static_cast<arma::uword>(system.getDimension());
   ArmadilloMatrix A(n, n);
-  size_t nnz = 0;
-  size_t rowsDone = 0;
-
   A.zeros();
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz, rowsDone) default(none)
-  {
-    SLE* system2 = &system;
-#ifdef _OPENMP
-    std::unique_ptr<CloneableSLE> clonedSLE;
-
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-      dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-      system2 = clonedSLE.get();
-    }
-
-#endif /* _OPENMP */
-
-// copy system matrix to Armadillo matrix object
-#pragma omp for ordered schedule(static)
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
 
-    for (arma::uword i = 0; i < n; i++) {
-      for (arma::uword j = 0; j < n; j++) {
-        A(i, j) = system2->getMatrixEntry(i, j);
+  // copy system matrix to Armadillo matrix object
+  system.getCSRMatrix(rowPointers, columnIndices, values);
+  const size_t nnz = values.size();
 
-        // count nonzero entries
-        // (not necessary, you can also remove that if you like)
-        if (A(i, j) != 0) {
-#pragma omp atomic
-          nnz++;
-        }
-      }
-
-#pragma omp atomic
-      rowsDone++;
-
-      // status message
-      if (rowsDone % 100 == 0) {
-        char str[10];
-        snprintf(str, sizeof(str), "%.1f%%",
-               static_cast<double>(rowsDone) / static_cast<double>(n) * 100.0);
-        Printer::getInstance().printStatusUpdate("constructing matrix (" + std::string(str) +
-                                                 ")");
-      }
+  for (arma::uword i = 0; i < n; i++) {
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      A(i, static_cast<arma::uword>(columnIndices[k])) = values[k];
     }
   }
 
-  Printer::getInstance().printStatusUpdate("constructing matrix (100.0%)");
-  Printer::getInstance().printStatusNewLine();
-
   // print ratio of nonzero entries
   {
     char str[10];
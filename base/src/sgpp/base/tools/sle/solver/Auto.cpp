@@ -11,11 +11,13 @@
 #include <sgpp/base/tools/sle/solver/GaussianElimination.hpp>
 #include <sgpp/base/tools/sle/solver/Gmmpp.hpp>
 #include <sgpp/base/tools/sle/solver/UMFPACK.hpp>
+#include <sgpp/base/tools/sle/system/SparseSLE.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -97,8 +99,34 @@ bool Auto::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
   // should be the first element
   std::vector<SLESolver*> solvers;
   const size_t n = system.getDimension();
+  // system with the assembled sparse matrix (shared by all solvers)
+  std::unique_ptr<SparseSLE> sparseSystem;
 
-  if (supports[&solverUMFPACK] || supports[&solverGmmpp]) {
+  if (system.hasSparseAssembly()) {
+    // the system can enumerate its non-zero entries efficiently
+    // ==> count them exactly and assemble the matrix once if it's sparse
+    Printer::getInstance().printStatusUpdate("counting non-zero entries");
+
+    const size_t nnz = system.countNNZ();
+    double nnzRatio =
+        static_cast<double>(nnz) / (static_cast<double>(n) * static_cast<double>(n));
+
+    // print ratio
+    {
+      char str[10];
+      snprintf(str, sizeof(str), "%.1f%%", nnzRatio * 100.0);
+      Printer::getInstance().printStatusUpdate("nnz ratio: " + std::string(str));
+      Printer::getInstance().printStatusNewLine();
+    }
+
+    if (nnzRatio <= MAX_NNZ_RATIO_FOR_SPARSE) {
+      sparseSystem.reset(new SparseSLE(system));
+
+      // prefer UMFPACK over Gmm++
+      addSLESolver(&solverUMFPACK, solvers, supports);
+      addSLESolver(&solverGmmpp, solvers, supports);
+    }
+  } else if (supports[&solverUMFPACK] || supports[&solverGmmpp]) {
     // if at least one of the sparse solvers is supported
     // ==> estimate sparsity ratio of matrix by considering
     // every inc-th row
@@ -137,6 +165,8 @@ bool Auto::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
     }
   }
 
+  SLE& system2 = ((sparseSystem != nullptr) ? *sparseSystem : system);
+
   // add all remaining solvers (prefer Armadillo over Eigen)
   addSLESolver(&solverArmadillo, solvers, supports);
   addSLESolver(&solverEigen, solvers, supports);
@@ -153,7 +183,7 @@ bool Auto::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
   for (size_t i = 0; i < solvers.size(); i++) {
     // try solver
-    bool result = solvers[i]->solve(system, B, X);
+    bool result = solvers[i]->solve(system2, B, X);
 
     if (result) {
       Printer::getInstance().printStatusEnd();
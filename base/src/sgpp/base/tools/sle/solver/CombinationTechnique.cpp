@@ -0,0 +1,413 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/Printer.hpp>
+#include <sgpp/base/tools/sle/LUFactorization.hpp>
+#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
+#include <sgpp/base/tools/sle/system/FullSLE.hpp>
+#include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+namespace sle_solver {
+
+namespace {
+
+typedef GridPoint::level_type level_type;
+typedef GridPoint::index_type index_type;
+typedef std::vector<level_type> LevelVector;
+
+struct LevelVectorHash {
+  size_t operator()(const LevelVector& level) const {
+    size_t hash = 0;
+
+    for (level_type l : level) {
+      hash = hash * 31 + l;
+    }
+
+    return hash;
+  }
+};
+
+/// levels of the subspaces of the grid, mapped to the number of grid points
+typedef std::unordered_map<LevelVector, size_t, LevelVectorHash> SubspaceMap;
+
+/**
+ * @param l   level
+ * @return    number of univariate grid points of level l
+ *            (two boundary points for l = 0)
+ */
+inline size_t getNumberOfPoints1D(level_type l) {
+  return (l == 0) ? 2 : (static_cast<size_t>(1) << (l - 1));
+}
+
+/**
+ * Determines the subspaces of the grid and checks if the grid is the union of complete full
+ * grids whose levels form a downward closed set.
+ *
+ * @param       storage     grid storage
+ * @param[out]  subspaces   levels of the subspaces
+ * @param[out]  minLevel    minimal level (0 for grids with boundary points, 1 otherwise)
+ * @return                  whether the grid is supported
+ */
+bool getSubspaces(const GridStorage& storage, SubspaceMap& subspaces, level_type& minLevel) {
+  const size_t d = storage.getDimension();
+  LevelVector level(d);
+  subspaces.clear();
+  minLevel = 1;
+
+  for (size_t k = 0; k < storage.getSize(); k++) {
+    const GridPoint& point = storage[k];
+
+    for (size_t t = 0; t < d; t++) {
+      level[t] = point.getLevel(t);
+
+      if (level[t] > CombinationTechnique::MAX_LEVEL_1D) {
+        return false;
+      } else if (level[t] == 0) {
+        minLevel = 0;
+      }
+    }
+
+    subspaces[level]++;
+  }
+
+  if (subspaces.empty()) {
+    return false;
+  }
+
+  for (const auto& subspace : subspaces) {
+    level = subspace.first;
+    size_t numberOfPoints = 1;
+
+    for (size_t t = 0; t < d; t++) {
+      numberOfPoints *= getNumberOfPoints1D(level[t]);
+
+      // the backward neighbors of the subspace have to be contained in the grid
+      if (level[t] > minLevel) {
+        level[t]--;
+        const bool isContained = (subspaces.find(level) != subspaces.end());
+        level[t]++;
+
+        if (!isContained) {
+          return false;
+        }
+      }
+    }
+
+    // the subspace has to be complete
+    if (subspace.second != numberOfPoints) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Adds (-1)^|z| for all z in {0, 1}^d with level + z in the set of subspaces.
+ * As the set is downward closed, z is built up dimension by dimension.
+ */
+void addCombinationCoefficientTerms(const SubspaceMap& subspaces, LevelVector& level,
+                                    const std::vector<size_t>& forwardDims, size_t start,
+                                    int sign, int& coefficient) {
+  coefficient += sign;
+
+  for (size_t k = start; k < forwardDims.size(); k++) {
+    level[forwardDims[k]]++;
+
+    if (subspaces.find(level) != subspaces.end()) {
+      addCombinationCoefficientTerms(subspaces, level, forwardDims, k + 1, -sign, coefficient);
+    }
+
+    level[forwardDims[k]]--;
+  }
+}
+
+/**
+ * @param subspaces   downward closed set of levels
+ * @param level       level of the set
+ * @return            combination coefficient of the level
+ */
+int getCombinationCoefficient(const SubspaceMap& subspaces, LevelVector level) {
+  std::vector<size_t> forwardDims;
+
+  for (size_t t = 0; t < level.size(); t++) {
+    level[t]++;
+
+    if (subspaces.find(level) != subspaces.end()) {
+      forwardDims.push_back(t);
+    }
+
+    level[t]--;
+  }
+
+  // if all combinations of forward neighbors are contained, the terms cancel out
+  for (size_t t : forwardDims) {
+    level[t]++;
+  }
+
+  const bool isInterior = !forwardDims.empty() && (subspaces.find(level) != subspaces.end());
+
+  for (size_t t : forwardDims) {
+    level[t]--;
+  }
+
+  if (isInterior) {
+    return 0;
+  }
+
+  int coefficient = 0;
+  addCombinationCoefficientTerms(subspaces, level, forwardDims, 0, 1, coefficient);
+  return coefficient;
+}
+
+/**
+ * Univariate grid of a full grid with the LU factorization
+ * of the interpolation matrix in the hierarchical basis.
+ */
+class Grid1D {
+ public:
+  Grid1D(const GridStorage& storage, const CombinationTechnique::BasisFunction1D& basis,
+         level_type minLevel, level_type maxLevel) {
+    // univariate grid points in hierarchical order
+    for (level_type l = minLevel; l <= maxLevel; l++) {
+      if (l == 0) {
+        levels.insert(levels.end(), {0, 0});
+        indices.insert(indices.end(), {0, 1});
+      } else {
+        for (index_type i = 1; i < (static_cast<index_type>(1) << l); i += 2) {
+          levels.push_back(l);
+          indices.push_back(i);
+        }
+      }
+    }
+
+    n = levels.size();
+
+    // coordinates (e.g., for Clenshaw-Curtis grids) are determined by the storage
+    GridPoint point(storage.getDimension());
+    std::vector<double> x(n);
+
+    for (size_t k = 0; k < n; k++) {
+      point.set(0, levels[k], indices[k]);
+      x[k] = storage.getUnitCoordinate(point, 0);
+    }
+
+    DataMatrix A(n, n);
+
+    for (size_t k = 0; k < n; k++) {
+      for (size_t j = 0; j < n; j++) {
+        A(k, j) = basis(levels[j], indices[j], x[k]);
+      }
+    }
+
+    FullSLE system(A);
+    factorization.reset(new LUFactorization(system));
+  }
+
+  /// number of grid points
+  size_t n;
+  /// levels of the grid points
+  std::vector<level_type> levels;
+  /// indices of the grid points
+  std::vector<index_type> indices;
+  /// factorization of the interpolation matrix
+  std::unique_ptr<LUFactorization> factorization;
+};
+
+}  // namespace
+
+CombinationTechnique::~CombinationTechnique() {}
+
+bool CombinationTechnique::solve(SLE& system, DataVector& b, DataVector& x) const {
+  DataMatrix B(b.getPointer(), b.getSize(), 1);
+  DataMatrix X(B.getNrows(), B.getNcols());
+
+  // call version for multiple RHSs
+  if (solve(system, B, X)) {
+    x.resize(X.getNrows());
+    X.getColumn(0, x);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+bool CombinationTechnique::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
+  HierarchisationSLE* hierarchisationSystem = dynamic_cast<HierarchisationSLE*>(&system);
+
+  if ((hierarchisationSystem != nullptr) &&
+      isApplicable(hierarchisationSystem->getGridStorage())) {
+    Printer::getInstance().printStatusBegin(
+        "Solving linear system (combination technique)...");
+    X = B;
+
+    if (hierarchise(hierarchisationSystem->getGridStorage(),
+                    [hierarchisationSystem](GridPoint::level_type l, GridPoint::index_type i,
+                                            double x) {
+                      return hierarchisationSystem->evalBasisFunction1D(l, i, x);
+                    },
+                    X)) {
+      Printer::getInstance().printStatusEnd();
+      return true;
+    }
+
+    Printer::getInstance().printStatusEnd("error: univariate system is singular");
+  }
+
+  Auto solver;
+  return solver.solve(system, B, X);
+}
+
+bool CombinationTechnique::isApplicable(const GridStorage& storage) {
+  SubspaceMap subspaces;
+  level_type minLevel;
+  return getSubspaces(storage, subspaces, minLevel);
+}
+
+bool CombinationTechnique::hierarchise(GridStorage& storage, const BasisFunction1D& basis,
+                                       DataMatrix& values) {
+  const size_t d = storage.getDimension();
+  const size_t m = values.getNcols();
+  SubspaceMap subspaces;
+  level_type minLevel;
+
+  if (!getSubspaces(storage, subspaces, minLevel)) {
+    return false;
+  }
+
+  // full grids of the combination technique
+  std::vector<std::pair<LevelVector, int>> fullGrids;
+  level_type maxLevel = minLevel;
+
+  for (const auto& subspace : subspaces) {
+    const int coefficient = getCombinationCoefficient(subspaces, subspace.first);
+
+    if (coefficient != 0) {
+      fullGrids.emplace_back(subspace.first, coefficient);
+
+      for (level_type l : subspace.first) {
+        maxLevel = std::max(maxLevel, l);
+      }
+    }
+  }
+
+  // univariate grids and factorizations (the same for all dimensions)
+  std::vector<Grid1D> grids1D;
+
+  for (level_type l = 0; l <= maxLevel; l++) {
+    grids1D.emplace_back(storage, basis, minLevel, std::max(l, minLevel));
+
+    if (grids1D.back().factorization->isSingular()) {
+      return false;
+    }
+  }
+
+  DataMatrix result(values.getNrows(), m, 0.0);
+
+#pragma omp parallel
+  {
+    GridPoint point(d);
+    std::vector<size_t> sizes(d);
+    std::vector<size_t> multiIndex(d);
+    std::vector<size_t> sequenceNumbers;
+    std::vector<double> fullGridValues;
+    std::vector<double> pole;
+
+#pragma omp for schedule(dynamic)
+    for (size_t k = 0; k < fullGrids.size(); k++) {
+      const LevelVector& level = fullGrids[k].first;
+      const double coefficient = static_cast<double>(fullGrids[k].second);
+      size_t numberOfPoints = 1;
+
+      for (size_t t = 0; t < d; t++) {
+        sizes[t] = grids1D[level[t]].n;
+        numberOfPoints *= sizes[t];
+        multiIndex[t] = 0;
+      }
+
+      // gather the function values (the last dimension is the fastest)
+      sequenceNumbers.resize(numberOfPoints);
+      fullGridValues.resize(numberOfPoints * m);
+
+      for (size_t j = 0; j < numberOfPoints; j++) {
+        for (size_t t = 0; t < d; t++) {
+          const Grid1D& grid1D = grids1D[level[t]];
+          point.push(t, grid1D.levels[multiIndex[t]], grid1D.indices[multiIndex[t]]);
+        }
+
+        point.rehash();
+        sequenceNumbers[j] = storage.getSequenceNumber(point);
+
+        for (size_t c = 0; c < m; c++) {
+          fullGridValues[j * m + c] = values(sequenceNumbers[j], c);
+        }
+
+        for (size_t t = d; t-- > 0;) {
+          if (++multiIndex[t] < sizes[t]) {
+            break;
+          }
+
+          multiIndex[t] = 0;
+        }
+      }
+
+      // unidirectional principle: solve the univariate systems along all poles
+      size_t stride = numberOfPoints;
+
+      for (size_t t = 0; t < d; t++) {
+        const Grid1D& grid1D = grids1D[level[t]];
+        const size_t n = sizes[t];
+        stride /= n;
+        pole.resize(n * m);
+
+        for (size_t outer = 0; outer < numberOfPoints; outer += n * stride) {
+          for (size_t inner = 0; inner < stride; inner++) {
+            // all functions are solved at once (one right-hand side per column)
+            double* data = &fullGridValues[(outer + inner) * m];
+
+            for (size_t i = 0; i < n; i++) {
+              std::copy(data + i * stride * m, data + i * stride * m + m, &pole[i * m]);
+            }
+
+            grid1D.factorization->solve(pole.data(), m);
+
+            for (size_t i = 0; i < n; i++) {
+              std::copy(&pole[i * m], &pole[i * m] + m, data + i * stride * m);
+            }
+          }
+        }
+      }
+
+      // combine the hierarchical surpluses
+      for (size_t j = 0; j < numberOfPoints; j++) {
+        double* row = result.getPointer() + sequenceNumbers[j] * m;
+
+        for (size_t c = 0; c < m; c++) {
+#pragma omp atomic
+          row[c] += coefficient * fullGridValues[j * m + c];
+        }
+      }
+    }
+  }
+
+  values = result;
+  return true;
+}
+
+}  // namespace sle_solver
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/tools/sle/solver/SLESolver.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace base {
+namespace sle_solver {
+
+/**
+ * Solver for hierarchisation systems (sgpp::base::HierarchisationSLE) that does not assemble
+ * the interpolation matrix.
+ *
+ * If the grid is the union of complete full grids whose levels form a downward closed set
+ * (e.g., regular or dimensionally adaptive sparse grids), the sparse grid interpolant is the
+ * combination of the interpolants on these full grids, as the univariate interpolation operators
+ * of any hierarchical basis are commuting projections. The interpolant on every full grid is
+ * computed with the unidirectional principle, i.e., by solving univariate systems along all
+ * poles with cached LU factorizations, and the hierarchical surpluses of the full grids are
+ * summed up with the combination coefficients. The memory is linear in the number of grid
+ * points, the full grids are processed in parallel.
+ *
+ * For other grids or systems, sgpp::base::sle_solver::Auto is used.
+ */
+class CombinationTechnique : public SLESolver {
+ public:
+  /// maximal level of the univariate systems (which are factorized densely)
+  static const size_t MAX_LEVEL_1D = 11;
+
+  /// univariate basis function: (level, index, x) -> value
+  typedef std::function<double(GridPoint::level_type, GridPoint::index_type, double)>
+      BasisFunction1D;
+
+  /**
+   * Destructor.
+   */
+  ~CombinationTechnique() override;
+
+  /**
+   * @param       system  system to be solved
+   * @param       b       right-hand side
+   * @param[out]  x       solution to the system
+   * @return              whether all went well
+   *                      (false if errors occurred)
+   */
+  bool solve(SLE& system, DataVector& b, DataVector& x) const override;
+
+  /**
+   * @param       system  system to be solved
+   * @param       B       matrix of right-hand sides
+   * @param[out]  X       matrix of solutions to the systems
+   * @return              whether all went well
+   *                      (false if errors occurred)
+   */
+  bool solve(SLE& system, DataMatrix& B, DataMatrix& X) const override;
+
+  /**
+   * @param storage   grid storage
+   * @return          whether the grid is the union of complete full grids
+   *                  with downward closed levels (and moderate univariate levels)
+   */
+  static bool isApplicable(const GridStorage& storage);
+
+  /**
+   * Hierarchises function values on a grid for which isApplicable() is true.
+   *
+   * @param           storage   grid storage
+   * @param           basis     univariate basis function
+   * @param[in,out]   values    before: function values at the grid points
+   *                            (one column per function),
+   *                            after: hierarchical surpluses
+   * @return                    whether the hierarchisation was successful
+   *                            (false if the grid is not supported or
+   *                            a univariate system is singular)
+   */
+  static bool hierarchise(GridStorage& storage, const BasisFunction1D& basis,
+                          DataMatrix& values);
+};
+}  // namespace sle_solver
+}  // namespace base
+}  // namespace sgpp
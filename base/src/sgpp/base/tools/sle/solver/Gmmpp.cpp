@@ -5,7 +5,6 @@
 
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/Gmmpp.hpp>
-#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
 #include <sgpp/globaldef.hpp>
 
 #ifdef USE_GMMPP
@@ -114,53 +113,21 @@ bool Gmmpp::solve(SLE& system, DataVector& b, DataVector& x) const {
 
   const size_t n = system.getDimension();
   size_t nnz = 0;
-  size_t rowsDone = 0;
   gmm::csr_matrix<double> A2;
 
   {
     gmm::row_matrix<gmm::rsvector<double>> A(n, n);
+    std::vector<size_t> rowPointers;
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz, rowsDone) default(none)
-    {
-      SLE* system2 = &system;
-#ifdef _OPENMP
-      std::unique_ptr<CloneableSLE> clonedSLE;
+    // copy system matrix to Gmm++ matrix object
+    system.getCSRMatrix(rowPointers, columnIndices, values);
+    nnz = values.size();
 
-      if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-        dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-        system2 = clonedSLE.get();
-      }
-
-#endif /* _OPENMP */
-
-// copy system matrix to Gmm++ matrix object
-#pragma omp for ordered schedule(static)
-
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          double entry = system2->getMatrixEntry(i, j);
-
-          if (entry != 0) {
-#pragma omp critical
-            {
-              A(i, j) = entry;
-              nnz++;
-            }
-          }
-        }
-
-#pragma omp atomic
-        rowsDone++;
-
-        // status message
-        if (rowsDone % 100 == 0) {
-          char str[10];
-          snprintf(str, sizeof(str), "%.1f%%",
-                 static_cast<double>(rowsDone) / static_cast<double>(n) * 100.0);
-          Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
-                                                   std::string(str) + ")");
-        }
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+        A(i, columnIndices[k]) = values[k];
       }
     }
 
@@ -169,9 +136,6 @@ bool Gmmpp::solve(SLE& system, DataVector& b, DataVector& x) const {
     gmm::copy(A, A2);
   }
 
-  Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
-  Printer::getInstance().printStatusNewLine();
-
   // print ratio of nonzero entries
   {
     char str[10];
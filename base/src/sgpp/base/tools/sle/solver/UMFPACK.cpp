@@ -5,7 +5,6 @@
 
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/UMFPACK.hpp>
-#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
 #include <sgpp/globaldef.hpp>
 
 #ifdef USE_UMFPACK
@@ -73,69 +72,12 @@ bool UMFPACK::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
   const size_t n = system.getDimension();
 
-  size_t nnz = 0;
-  std::vector<uint32_t> Ti;
-  std::vector<uint32_t> Tj;
-  std::vector<double> Tx;
-  size_t rowsDone = 0;
-
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) \
-shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
-  {
-    SLE* system2 = &system;
-#ifdef _OPENMP
-    std::unique_ptr<CloneableSLE> clonedSLE;
-
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-      dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-      system2 = clonedSLE.get();
-    }
-
-#endif /* _OPENMP */
-
-    std::vector<uint32_t> curTi;
-    std::vector<uint32_t> curTj;
-    std::vector<double> curTx;
-
-// get indices and values of nonzero entries
-#pragma omp for ordered schedule(static)
-
-    for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
-
-        if (entry != 0) {
-          curTi.push_back(i);
-          curTj.push_back(j);
-          curTx.push_back(entry);
-        }
-      }
-
-#pragma omp atomic
-      rowsDone++;
-
-      // status message
-      if (rowsDone % 100 == 0) {
-        char str[10];
-        snprintf(str, sizeof(str), "%.1f%%",
-                 static_cast<double>(rowsDone) / static_cast<double>(n) * 100.0);
-        Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
-                                                 std::string(str) + ")");
-      }
-    }
-
-#pragma omp critical
-    {
-      Ti.insert(Ti.end(), curTi.begin(), curTi.end());
-      Tj.insert(Tj.end(), curTj.begin(), curTj.end());
-      Tx.insert(Tx.end(), curTx.begin(), curTx.end());
-      nnz += curTx.size();
-    }
-  }
-
-  Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
-  Printer::getInstance().printStatusNewLine();
+  // get indices and values of nonzero entries
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
+  system.getCSRMatrix(rowPointers, columnIndices, values);
+  const size_t nnz = values.size();
 
   // print ratio of nonzero entries
   {
@@ -157,15 +99,17 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
     std::vector<sslong> TiArray(nnz, 0);
     std::vector<sslong> TjArray(nnz, 0);
 
-    for (size_t k = 0; k < nnz; k++) {
-      TiArray[k] = static_cast<sslong>(Ti[k]);
-      TjArray[k] = static_cast<sslong>(Tj[k]);
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+        TiArray[k] = static_cast<sslong>(i);
+        TjArray[k] = static_cast<sslong>(columnIndices[k]);
+      }
     }
 
     Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_triplet_to_col");
 
     result = umfpack_dl_triplet_to_col(static_cast<sslong>(n), static_cast<sslong>(n),
-                                       static_cast<sslong>(nnz), &TiArray[0], &TjArray[0], &Tx[0],
+                                       static_cast<sslong>(nnz), &TiArray[0], &TjArray[0], &values[0],
                                        &Ap[0], &Ai[0], &Ax[0], nullptr);
 
     if (result != UMFPACK_OK) {
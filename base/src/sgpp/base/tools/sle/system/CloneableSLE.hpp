@@ -5,10 +5,20 @@
 
 #pragma once
 
+#include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/system/SLE.hpp>
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -45,6 +55,138 @@ class CloneableSLE : public SLE {
    * @return whether this system derives from CloneableSLE or not (true)
    */
   bool isCloneable() const override { return true; }
+
+  /**
+   * Assemble the matrix in compressed sparse row (CSR) format.
+   * The \f$\mathcal{O}(n^2)\f$ matrix entry lookups are distributed among
+   * threads, each of which uses its own clone of the system.
+   *
+   * @param[out] rowPointers    row pointers (size \f$n+1\f$)
+   * @param[out] columnIndices  column indices of the non-zero entries
+   *                            (ascending in every row)
+   * @param[out] values         values of the non-zero entries
+   */
+  void getCSRMatrix(std::vector<size_t>& rowPointers, std::vector<size_t>& columnIndices,
+                    std::vector<double>& values) override {
+    const size_t n = getDimension();
+
+    assembleCSRMatrix(
+        [n](CloneableSLE& system, size_t i, std::vector<size_t>& rowColumnIndices,
+            std::vector<double>& rowValues) {
+          for (size_t j = 0; j < n; j++) {
+            const double entry = system.getMatrixEntry(i, j);
+
+            if (entry != 0.0) {
+              rowColumnIndices.push_back(j);
+              rowValues.push_back(entry);
+            }
+          }
+        },
+        true, rowPointers, columnIndices, values);
+  }
+
+ protected:
+  /**
+   * Assemble a CSR matrix in parallel. Every thread processes a contiguous
+   * block of rows, the blocks are concatenated afterwards.
+   *
+   * @param      getRow         function (system, i, rowColumnIndices, rowValues)
+   *                            that appends the non-zero entries of the i-th row
+   *                            (with ascending column indices)
+   * @param      cloneSystem    whether every thread should pass its own clone
+   *                            of the system to getRow
+   *                            (if getMatrixEntry() is not thread-safe)
+   * @param[out] rowPointers    row pointers (size \f$n+1\f$)
+   * @param[out] columnIndices  column indices of the non-zero entries
+   * @param[out] values         values of the non-zero entries
+   */
+  template <class RowFunction>
+  void assembleCSRMatrix(RowFunction getRow, bool cloneSystem, std::vector<size_t>& rowPointers,
+                         std::vector<size_t>& columnIndices, std::vector<double>& values) {
+    const size_t n = getDimension();
+    std::vector<std::vector<size_t>> threadColumnIndices;
+    std::vector<std::vector<double>> threadValues;
+    std::vector<size_t> threadRowBegin;
+    size_t rowsDone = 0;
+
+    rowPointers.assign(n + 1, 0);
+
+#pragma omp parallel
+    {
+      size_t threadNum = 0;
+      size_t numThreads = 1;
+#ifdef _OPENMP
+      threadNum = static_cast<size_t>(omp_get_thread_num());
+      numThreads = static_cast<size_t>(omp_get_num_threads());
+#endif /* _OPENMP */
+
+#pragma omp single
+      {
+        threadColumnIndices.resize(numThreads);
+        threadValues.resize(numThreads);
+        threadRowBegin.resize(numThreads + 1);
+
+        for (size_t t = 0; t <= numThreads; t++) {
+          threadRowBegin[t] = t * n / numThreads;
+        }
+      }
+
+      CloneableSLE* system = this;
+      std::unique_ptr<CloneableSLE> clonedSLE;
+
+      if (cloneSystem && (numThreads > 1)) {
+        clone(clonedSLE);
+        system = clonedSLE.get();
+      }
+
+      std::vector<size_t>& curColumnIndices = threadColumnIndices[threadNum];
+      std::vector<double>& curValues = threadValues[threadNum];
+
+      for (size_t i = threadRowBegin[threadNum]; i < threadRowBegin[threadNum + 1]; i++) {
+        getRow(*system, i, curColumnIndices, curValues);
+        // number of entries in the block up to row i, shifted below
+        rowPointers[i + 1] = curValues.size();
+
+        size_t curRowsDone;
+#pragma omp atomic capture
+        curRowsDone = ++rowsDone;
+
+        // status message
+        if (curRowsDone % 100 == 0) {
+          char str[10];
+          snprintf(str, sizeof(str), "%.1f%%",
+                   static_cast<double>(curRowsDone) / static_cast<double>(n) * 100.0);
+          Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
+                                                   std::string(str) + ")");
+        }
+      }
+    }
+
+    // concatenate the blocks
+    size_t nnz = 0;
+
+    for (size_t t = 0; t < threadValues.size(); t++) {
+      for (size_t i = threadRowBegin[t]; i < threadRowBegin[t + 1]; i++) {
+        rowPointers[i + 1] += nnz;
+      }
+
+      nnz += threadValues[t].size();
+    }
+
+    columnIndices.resize(nnz);
+    values.resize(nnz);
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_t t = 0; t < threadValues.size(); t++) {
+      const size_t offset = rowPointers[threadRowBegin[t]];
+      std::copy(threadColumnIndices[t].begin(), threadColumnIndices[t].end(),
+                columnIndices.begin() + offset);
+      std::copy(threadValues[t].begin(), threadValues[t].end(), values.begin() + offset);
+    }
+
+    Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
+    Printer::getInstance().printStatusNewLine();
+  }
 };
 }  // namespace base
 }  // namespace sgpp
@@ -53,10 +53,15 @@
 #include <sgpp/base/grid/type/NaturalBsplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/NakBsplineBoundaryGrid.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -222,6 +227,148 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * Evaluates the univariate basis function of the grid,
+   * whose tensor products form the sparse grid basis.
+   *
+   * @param l     level of the basis function
+   * @param i     index of the basis function
+   * @param x     evaluation point in [0, 1]
+   * @return      value of the univariate basis function
+   */
+  inline double evalBasisFunction1D(GridPoint::level_type l, GridPoint::index_type i, double x) {
+    switch (basisType) {
+      case BSPLINE:
+        return bsplineBasis->eval(l, i, x);
+      case BSPLINE_BOUNDARY:
+        return bsplineBoundaryBasis->eval(l, i, x);
+      case BSPLINE_CLENSHAW_CURTIS:
+        return bsplineClenshawCurtisBasis->eval(l, i, x);
+      case BSPLINE_MODIFIED:
+        return modBsplineBasis->eval(l, i, x);
+      case BSPLINE_MODIFIED_CLENSHAW_CURTIS:
+        return modBsplineClenshawCurtisBasis->eval(l, i, x);
+      case FUNDAMENTAL_NAK_SPLINE:
+        return fundamentalNakSplineBasis->eval(l, i, x);
+      case FUNDAMENTAL_SPLINE:
+        return fundamentalSplineBasis->eval(l, i, x);
+      case FUNDAMENTAL_SPLINE_MODIFIED:
+        return modFundamentalSplineBasis->eval(l, i, x);
+      case WEAKLY_FUNDAMENTAL_NAK_SPLINE:
+        return weaklyFundamentalNakSplineBasis->eval(l, i, x);
+      case WEAKLY_FUNDAMENTAL_NAK_SPLINE_MODIFIED:
+        return modWeaklyFundamentalNakSplineBasis->eval(l, i, x);
+      case WEAKLY_FUNDAMENTAL_SPLINE:
+        return weaklyFundamentalSplineBasis->eval(l, i, x);
+      case LINEAR:
+        return linearBasis->eval(l, i, x);
+      case LINEAR_BOUNDARY:
+        return linearL0BoundaryBasis->eval(l, i, x);
+      case LINEAR_CLENSHAW_CURTIS:
+        return linearClenshawCurtisBasis->eval(l, i, x);
+      case LINEAR_CLENSHAW_CURTIS_BOUNDARY:
+        return linearClenshawCurtisBoundaryBasis->eval(l, i, x);
+      case LINEAR_MODIFIED:
+        return modLinearBasis->eval(l, i, x);
+      case NAK_BSPLINEBOUNDARY_COMBIGRID:
+        return nakBsplineBoundaryCombigridBasis->eval(l, i, x);
+      case NATURAL_BSPLINE:
+        return naturalBsplineBasis->eval(l, i, x);
+      case NAK_BSPLINE:
+        return nakBsplineBasis->eval(l, i, x);
+      case NAK_BSPLINE_MODIFIED:
+        return modNakBsplineBasis->eval(l, i, x);
+      case WAVELET:
+        return waveletBasis->eval(l, i, x);
+      case WAVELET_BOUNDARY:
+        return waveletBoundaryBasis->eval(l, i, x);
+      case WAVELET_MODIFIED:
+        return modWaveletBasis->eval(l, i, x);
+      default:
+        return 0.0;
+    }
+  }
+
+  /**
+   * Count the non-zero entries via the sparsity pattern
+   * (see getCSRMatrix()).
+   *
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override {
+    SparsityPattern pattern;
+    computeSparsityPattern(pattern);
+    const size_t n = gridStorage.getSize();
+    size_t nnz = 0;
+
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : nnz)
+    for (size_t i = 0; i < n; i++) {
+      std::vector<size_t> rowColumnIndices;
+      std::vector<double> rowValues;
+      addRowEntries(pattern, i, 0, 0, 1.0, rowColumnIndices, rowValues);
+      nnz += rowValues.size();
+    }
+
+    return nnz;
+  }
+
+  /**
+   * Assemble the matrix in compressed sparse row (CSR) format
+   * without probing all \f$n^2\f$ entries.
+   * The values of the univariate basis functions at the univariate grid
+   * points are tabulated per dimension. For bases with local support, only
+   * the basis functions whose support may contain the point are evaluated,
+   * i.e., a constant number per level (see getSupportRadius1D()), which
+   * takes \f$\mathcal{O}(m L)\f$ evaluations in every dimension, where
+   * \f$m\f$ is the number of different level-index pairs in the dimension
+   * and \f$L\f$ is the number of levels. For bases with global support
+   * (fundamental splines, wavelets), all \f$\mathcal{O}(m^2)\f$ pairs are
+   * evaluated.
+   * For every grid point, the basis functions that do not vanish at the point
+   * are then enumerated by traversing a trie of the level-index pairs of the
+   * grid points dimension by dimension, skipping all level-index pairs whose
+   * basis functions vanish at the point. The rows are assembled in parallel.
+   *
+   * @param[out] rowPointers    row pointers (size \f$n+1\f$)
+   * @param[out] columnIndices  column indices of the non-zero entries
+   *                            (ascending in every row)
+   * @param[out] values         values of the non-zero entries
+   */
+  void getCSRMatrix(std::vector<size_t>& rowPointers, std::vector<size_t>& columnIndices,
+                    std::vector<double>& values) override {
+    SparsityPattern pattern;
+    computeSparsityPattern(pattern);
+
+    assembleCSRMatrix(
+        [this, &pattern](CloneableSLE&, size_t i, std::vector<size_t>& rowColumnIndices,
+                         std::vector<double>& rowValues) {
+          const size_t rowBegin = rowValues.size();
+          addRowEntries(pattern, i, 0, 0, 1.0, rowColumnIndices, rowValues);
+
+          // sort entries of the row by column index
+          std::vector<std::pair<size_t, double>> entries;
+          entries.reserve(rowValues.size() - rowBegin);
+
+          for (size_t k = rowBegin; k < rowValues.size(); k++) {
+            entries.emplace_back(rowColumnIndices[k], rowValues[k]);
+          }
+
+          std::sort(entries.begin(), entries.end());
+
+          for (size_t k = 0; k < entries.size(); k++) {
+            rowColumnIndices[rowBegin + k] = entries[k].first;
+            rowValues[rowBegin + k] = entries[k].second;
+          }
+        },
+        false, rowPointers, columnIndices, values);
+  }
+
+  /**
+   * @return whether getCSRMatrix() and countNNZ() run in time proportional
+   *         to the number of non-zero entries (true)
+   */
+  bool hasSparseAssembly() const override { return true; }
+
   /**
    * @return          sparse grid
    */
@@ -322,6 +469,282 @@ class HierarchisationSLE : public CloneableSLE {
     WAVELET_MODIFIED,
   } basisType;
 
+  /**
+   * Univariate tables of the matrix entries and trie of the grid points
+   * for the assembly of the sparse matrix.
+   */
+  struct SparsityPattern {
+    /// IDs of the univariate level-index pairs of the grid points
+    /// (entry k * d + t for the t-th coordinate of the k-th grid point)
+    std::vector<uint32_t> pointIDs;
+    /// for every dimension and univariate point ID, start of the
+    /// non-vanishing univariate basis functions in entryIDs/entryValues
+    std::vector<std::vector<size_t>> entryPointers;
+    /// IDs of the univariate basis functions that do not vanish at the points
+    std::vector<std::vector<uint32_t>> entryIDs;
+    /// values of the univariate basis functions at the points
+    std::vector<std::vector<double>> entryValues;
+    /// trie of the grid points, the t-th map assigns to (node at depth t, ID)
+    /// the child node (or the grid point index if t = d - 1)
+    std::vector<std::unordered_map<uint64_t, size_t>> children;
+  };
+
+  /**
+   * Evaluates the univariate factor of a matrix entry.
+   *
+   * @param l         level of the basis function
+   * @param i         index of the basis function
+   * @param pointL    level of the grid point
+   * @param pointI    index of the grid point
+   * @param x         coordinate of the grid point in [0, 1]
+   * @return          value of the univariate basis function at the grid point
+   */
+  inline double evalBasisFunction1DAtGridPoint(GridPoint::level_type l, GridPoint::index_type i,
+                                               GridPoint::level_type pointL,
+                                               GridPoint::index_type pointI, double x) {
+    if ((basisType == FUNDAMENTAL_NAK_SPLINE) || (basisType == FUNDAMENTAL_SPLINE) ||
+        (basisType == FUNDAMENTAL_SPLINE_MODIFIED)) {
+      if (pointL < l) {
+        return 0.0;
+      } else if (pointL == l) {
+        return ((pointI == i) ? 1.0 : 0.0);
+      }
+    } else if ((basisType == WEAKLY_FUNDAMENTAL_NAK_SPLINE) ||
+               (basisType == WEAKLY_FUNDAMENTAL_NAK_SPLINE_MODIFIED) ||
+               (basisType == WEAKLY_FUNDAMENTAL_SPLINE)) {
+      if (pointL < l) {
+        return 0.0;
+      }
+    }
+
+    return evalBasisFunction1D(l, i, x);
+  }
+
+  /**
+   * @return  radius \f$r\f$ (in multiples of the mesh width \f$h_l\f$) such that the
+   *          univariate basis function of level \f$l\f$ and index \f$i\f$ vanishes
+   *          outside of \f$[(i - r) h_l, (i + r) h_l]\f$ (in the index domain of the grid
+   *          points, i.e., before Clenshaw-Curtis transformations), or 0 if the
+   *          basis functions do not have local support
+   */
+  size_t getSupportRadius1D() const {
+    size_t degree;
+
+    switch (basisType) {
+      case LINEAR:
+      case LINEAR_BOUNDARY:
+      case LINEAR_CLENSHAW_CURTIS:
+      case LINEAR_CLENSHAW_CURTIS_BOUNDARY:
+      case LINEAR_MODIFIED:
+        degree = 1;
+        break;
+      case BSPLINE:
+        degree = bsplineBasis->getDegree();
+        break;
+      case BSPLINE_BOUNDARY:
+        degree = bsplineBoundaryBasis->getDegree();
+        break;
+      case BSPLINE_CLENSHAW_CURTIS:
+        degree = bsplineClenshawCurtisBasis->getDegree();
+        break;
+      case BSPLINE_MODIFIED:
+        degree = modBsplineBasis->getDegree();
+        break;
+      case BSPLINE_MODIFIED_CLENSHAW_CURTIS:
+        degree = modBsplineClenshawCurtisBasis->getDegree();
+        break;
+      case NATURAL_BSPLINE:
+        degree = naturalBsplineBasis->getDegree();
+        break;
+      case NAK_BSPLINE:
+        degree = nakBsplineBasis->getDegree();
+        break;
+      case NAK_BSPLINE_MODIFIED:
+        degree = modNakBsplineBasis->getDegree();
+        break;
+      default:
+        return 0;
+    }
+
+    // (degree + 1) / 2 for uniform B-splines, the boundary modifications (modified,
+    // not-a-knot, natural) enlarge the support by less than degree + 1 mesh widths
+    // (and the polynomials on coarse levels are covered as r >= 2^l)
+    return (degree + 1) / 2 + degree + 1;
+  }
+
+  /**
+   * @param[out] pattern  univariate tables and trie of the grid points
+   */
+  void computeSparsityPattern(SparsityPattern& pattern) {
+    const size_t n = gridStorage.getSize();
+    const size_t d = gridStorage.getDimension();
+    // level, index, and a grid point index (for the coordinate) per univariate ID
+    std::vector<std::vector<GridPoint::level_type>> levels(d);
+    std::vector<std::vector<GridPoint::index_type>> indices(d);
+    std::vector<std::vector<size_t>> representatives(d);
+
+    pattern.pointIDs.resize(n * d);
+    pattern.entryPointers.assign(d, std::vector<size_t>());
+    pattern.entryIDs.assign(d, std::vector<uint32_t>());
+    pattern.entryValues.assign(d, std::vector<double>());
+    pattern.children.assign(d, std::unordered_map<uint64_t, size_t>());
+
+    // univariate IDs, key is (level << 32) | index
+    std::vector<std::unordered_map<uint64_t, uint32_t>> ids(d);
+
+    for (size_t t = 0; t < d; t++) {
+      for (size_t k = 0; k < n; k++) {
+        const GridPoint& gp = gridStorage[k];
+        const uint64_t key = (static_cast<uint64_t>(gp.getLevel(t)) << 32) | gp.getIndex(t);
+        const auto it = ids[t].emplace(key, static_cast<uint32_t>(levels[t].size())).first;
+
+        if (it->second == levels[t].size()) {
+          levels[t].push_back(gp.getLevel(t));
+          indices[t].push_back(gp.getIndex(t));
+          representatives[t].push_back(k);
+        }
+
+        pattern.pointIDs[k * d + t] = it->second;
+      }
+    }
+
+    // build trie
+    for (size_t k = 0; k < n; k++) {
+      size_t node = 0;
+
+      for (size_t t = 0; t < d; t++) {
+        const uint64_t key = (static_cast<uint64_t>(node) << 32) | pattern.pointIDs[k * d + t];
+        const size_t newNode = ((t < d - 1) ? pattern.children[t].size() : k);
+        node = pattern.children[t].emplace(key, newNode).first->second;
+      }
+    }
+
+    // tabulate univariate basis functions at the univariate points
+    const int64_t supportRadius = static_cast<int64_t>(getSupportRadius1D());
+
+    for (size_t t = 0; t < d; t++) {
+      const size_t m = levels[t].size();
+      std::vector<std::vector<uint32_t>> curEntryIDs(m);
+      std::vector<std::vector<double>> curEntryValues(m);
+      // levels of the univariate basis functions
+      std::vector<GridPoint::level_type> basisLevels(levels[t]);
+      std::sort(basisLevels.begin(), basisLevels.end());
+      basisLevels.erase(std::unique(basisLevels.begin(), basisLevels.end()), basisLevels.end());
+
+#pragma omp parallel
+      {
+        HierarchisationSLE* system = this;
+        std::unique_ptr<CloneableSLE> clonedSLE;
+#ifdef _OPENMP
+        if (omp_get_num_threads() > 1) {
+          clone(clonedSLE);
+          system = dynamic_cast<HierarchisationSLE*>(clonedSLE.get());
+        }
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic)
+        for (size_t p = 0; p < m; p++) {
+          const GridPoint::level_type pointL = levels[t][p];
+          const GridPoint::index_type pointI = indices[t][p];
+          const double x = gridStorage.getUnitCoordinate(gridStorage[representatives[t][p]], t);
+
+          if (supportRadius == 0) {
+            // global support, all basis functions have to be evaluated
+            for (size_t b = 0; b < m; b++) {
+              const double entry = system->evalBasisFunction1DAtGridPoint(
+                  levels[t][b], indices[t][b], pointL, pointI, x);
+
+              if (entry != 0.0) {
+                curEntryIDs[p].push_back(static_cast<uint32_t>(b));
+                curEntryValues[p].push_back(entry);
+              }
+            }
+
+            continue;
+          }
+
+          // local support: only the basis functions whose index is within the
+          // support radius of the position of the point on the level are evaluated
+          for (const GridPoint::level_type l : basisLevels) {
+            const int64_t center =
+                (l >= pointL) ? (static_cast<int64_t>(pointI) << (l - pointL))
+                              : (static_cast<int64_t>(pointI) >> (pointL - l));
+            const int64_t iBegin = std::max<int64_t>(center - supportRadius, 0);
+            const int64_t iEnd =
+                std::min<int64_t>(center + supportRadius + 1, static_cast<int64_t>(1) << l);
+
+            for (int64_t i = iBegin; i <= iEnd; i++) {
+              const auto it = ids[t].find((static_cast<uint64_t>(l) << 32) |
+                                          static_cast<uint64_t>(i));
+
+              if (it == ids[t].end()) {
+                continue;
+              }
+
+              const double entry = system->evalBasisFunction1DAtGridPoint(
+                  l, static_cast<GridPoint::index_type>(i), pointL, pointI, x);
+
+              if (entry != 0.0) {
+                curEntryIDs[p].push_back(it->second);
+                curEntryValues[p].push_back(entry);
+              }
+            }
+          }
+        }
+      }
+
+      pattern.entryPointers[t].assign(1, 0);
+
+      for (size_t p = 0; p < m; p++) {
+        pattern.entryIDs[t].insert(pattern.entryIDs[t].end(), curEntryIDs[p].begin(),
+                                   curEntryIDs[p].end());
+        pattern.entryValues[t].insert(pattern.entryValues[t].end(), curEntryValues[p].begin(),
+                                      curEntryValues[p].end());
+        pattern.entryPointers[t].push_back(pattern.entryIDs[t].size());
+      }
+    }
+  }
+
+  /**
+   * Recursively appends the non-zero entries of a row, i.e., the basis functions
+   * that do not vanish at a grid point (in unspecified order).
+   *
+   * @param       pattern           univariate tables and trie of the grid points
+   * @param       i                 row index (index of the grid point)
+   * @param       t                 current dimension
+   * @param       node              current node of the trie at depth t
+   * @param       value             product of the univariate values in the
+   *                                dimensions 0, ..., t - 1
+   * @param[out]  rowColumnIndices  column indices (indices of the basis functions)
+   * @param[out]  rowValues         values of the entries
+   */
+  void addRowEntries(const SparsityPattern& pattern, size_t i, size_t t, size_t node,
+                     double value, std::vector<size_t>& rowColumnIndices,
+                     std::vector<double>& rowValues) const {
+    const size_t d = gridStorage.getDimension();
+    const uint32_t pointID = pattern.pointIDs[i * d + t];
+    const std::unordered_map<uint64_t, size_t>& curChildren = pattern.children[t];
+
+    for (size_t k = pattern.entryPointers[t][pointID]; k < pattern.entryPointers[t][pointID + 1];
+         k++) {
+      const uint64_t key = (static_cast<uint64_t>(node) << 32) | pattern.entryIDs[t][k];
+      const auto it = curChildren.find(key);
+
+      if (it == curChildren.end()) {
+        continue;
+      }
+
+      const double newValue = value * pattern.entryValues[t][k];
+
+      if (t == d - 1) {
+        rowColumnIndices.push_back(it->second);
+        rowValues.push_back(newValue);
+      } else {
+        addRowEntries(pattern, i, t + 1, it->second, newValue, rowColumnIndices, rowValues);
+      }
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
@@ -9,6 +9,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -88,6 +89,45 @@ class SLE {
     return nnz;
   }
 
+  /**
+   * Assemble the matrix in compressed sparse row (CSR) format, i.e.,
+   * the non-zero entries of the i-th row are
+   * values[rowPointers[i]], ..., values[rowPointers[i+1]-1]
+   * in the columns columnIndices[rowPointers[i]], ...
+   * Standard implementation with \f$\mathcal{O}(n^2)\f$ matrix entry lookups.
+   *
+   * @param[out] rowPointers    row pointers (size \f$n+1\f$)
+   * @param[out] columnIndices  column indices of the non-zero entries
+   *                            (ascending in every row)
+   * @param[out] values         values of the non-zero entries
+   */
+  virtual void getCSRMatrix(std::vector<size_t>& rowPointers, std::vector<size_t>& columnIndices,
+                            std::vector<double>& values) {
+    const size_t n = getDimension();
+    rowPointers.assign(1, 0);
+    columnIndices.clear();
+    values.clear();
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        const double entry = getMatrixEntry(i, j);
+
+        if (entry != 0.0) {
+          columnIndices.push_back(j);
+          values.push_back(entry);
+        }
+      }
+
+      rowPointers.push_back(values.size());
+    }
+  }
+
+  /**
+   * @return whether getCSRMatrix() and countNNZ() run in time proportional
+   *         to the number of non-zero entries (standard: false)
+   */
+  virtual bool hasSparseAssembly() const { return false; }
+
   /**
    * Pure virtual method returning the dimension (number of rows/columns)
    * of the system.
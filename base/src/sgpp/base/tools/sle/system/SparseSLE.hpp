@@ -0,0 +1,124 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/tools/sle/system/SLE.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Linear system whose matrix is stored in compressed sparse row (CSR) format.
+ * Can be used to assemble the matrix of another system once and share it
+ * between several solvers (see sgpp::base::sle_solver::Auto).
+ */
+class SparseSLE : public SLE {
+ public:
+  /**
+   * Constructor, assembles the matrix of another system.
+   *
+   * @param system    linear system (only needed during construction)
+   */
+  explicit SparseSLE(SLE& system) : SLE() {
+    system.getCSRMatrix(rowPointers, columnIndices, values);
+  }
+
+  /**
+   * Constructor.
+   *
+   * @param rowPointers     row pointers (size \f$n+1\f$)
+   * @param columnIndices   column indices of the non-zero entries
+   *                        (ascending in every row)
+   * @param values          values of the non-zero entries
+   */
+  SparseSLE(const std::vector<size_t>& rowPointers, const std::vector<size_t>& columnIndices,
+            const std::vector<double>& values)
+      : SLE(), rowPointers(rowPointers), columnIndices(columnIndices), values(values) {}
+
+  /**
+   * Destructor.
+   */
+  ~SparseSLE() override {}
+
+  /**
+   * @param i     row index
+   * @param j     column index
+   * @return      whether the (i,j)-th entry of the matrix is non-zero
+   */
+  bool isMatrixEntryNonZero(size_t i, size_t j) override { return (getMatrixEntry(i, j) != 0.0); }
+
+  /**
+   * Binary search in the i-th row.
+   *
+   * @param i     row index
+   * @param j     column index
+   * @return      (i,j)-th entry of the matrix
+   */
+  double getMatrixEntry(size_t i, size_t j) override {
+    const std::vector<size_t>::const_iterator rowBegin = columnIndices.begin() + rowPointers[i];
+    const std::vector<size_t>::const_iterator rowEnd = columnIndices.begin() + rowPointers[i + 1];
+    const std::vector<size_t>::const_iterator it = std::lower_bound(rowBegin, rowEnd, j);
+
+    if ((it != rowEnd) && (*it == j)) {
+      return values[it - columnIndices.begin()];
+    } else {
+      return 0.0;
+    }
+  }
+
+  /**
+   * Multiply the matrix with a vector in \f$\mathcal{O}(\mathrm{nnz})\f$.
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const DataVector& x, DataVector& y) override {
+    const size_t n = getDimension();
+    y.resize(n);
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      double yi = 0.0;
+
+      for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+        yi += values[k] * x[columnIndices[k]];
+      }
+
+      y[i] = yi;
+    }
+  }
+
+  /**
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override { return values.size(); }
+
+  void getCSRMatrix(std::vector<size_t>& rowPointers, std::vector<size_t>& columnIndices,
+                    std::vector<double>& values) override {
+    rowPointers = this->rowPointers;
+    columnIndices = this->columnIndices;
+    values = this->values;
+  }
+
+  bool hasSparseAssembly() const override { return true; }
+
+  size_t getDimension() const override { return rowPointers.size() - 1; }
+
+ protected:
+  /// row pointers
+  std::vector<size_t> rowPointers;
+  /// column indices of the non-zero entries
+  std::vector<size_t> columnIndices;
+  /// values of the non-zero entries
+  std::vector<double> values;
+};
+}  // namespace base
+}  // namespace sgpp
@@ -64,6 +64,7 @@
 #include <sgpp/base/application/ScreenOutput.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/SymmetricPackedMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridDataBase.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
@@ -159,6 +160,7 @@
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/tools/GridPrinter.hpp>
 #include <sgpp/base/tools/GridPrinterForStretching.hpp>
+#include <sgpp/base/tools/MonteCarloBlockEstimator.hpp>
 #include <sgpp/base/tools/MultipleClassPoint.hpp>
 #include <sgpp/base/tools/MutexType.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
@@ -167,9 +169,11 @@
 #include <sgpp/base/tools/ScopedLock.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/base/tools/StdNormalDistribution.hpp>
+#include <sgpp/base/tools/sle/LUFactorization.hpp>
 #include <sgpp/base/tools/sle/solver/Armadillo.hpp>
 #include <sgpp/base/tools/sle/solver/Auto.hpp>
 #include <sgpp/base/tools/sle/solver/BiCGStab.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/solver/Eigen.hpp>
 #include <sgpp/base/tools/sle/solver/GaussianElimination.hpp>
 #include <sgpp/base/tools/sle/solver/Gmmpp.hpp>
@@ -179,6 +183,7 @@
 #include <sgpp/base/tools/sle/system/FullSLE.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/base/tools/sle/system/SLE.hpp>
+#include <sgpp/base/tools/sle/system/SparseSLE.hpp>
 
 #include <sgpp/base/function/scalar/ComponentScalarFunction.hpp>
 #include <sgpp/base/function/scalar/ComponentScalarFunctionGradient.hpp>
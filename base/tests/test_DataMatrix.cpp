@@ -8,12 +8,15 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/SymmetricPackedMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
 
 #include <algorithm>
 #include <cmath>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::base::SymmetricPackedMatrix;
 
 struct FixtureDataMatrix {
   FixtureDataMatrix()
@@ -432,4 +435,70 @@ BOOST_AUTO_TEST_CASE(resizeToSubMatrixTests) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(symmetricPackedMatrixTest) {
+  const size_t n = 37;
+  DataMatrix m(n, n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = i; j < n; j++) {
+      const double value = std::sin(static_cast<double>(i * n + j));
+      m.set(i, j, value);
+      m.set(j, i, value);
+    }
+  }
+
+  SymmetricPackedMatrix packed(m);
+  BOOST_CHECK_EQUAL(packed.getSize(), n);
+  BOOST_CHECK_EQUAL(packed.getNumberOfEntries(), n * (n + 1) / 2);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      BOOST_CHECK_EQUAL(packed.get(i, j), m.get(i, j));
+    }
+  }
+
+  DataVector x(n);
+
+  for (size_t i = 0; i < n; i++) {
+    x[i] = std::cos(static_cast<double>(i));
+  }
+
+  DataVector y(n);
+  DataVector yPacked(n);
+  m.mult(x, y);
+  packed.mult(x, yPacked);
+
+  for (size_t i = 0; i < n; i++) {
+    double expected = 0.0;
+
+    for (size_t j = 0; j < n; j++) {
+      expected += m.get(i, j) * x[j];
+    }
+
+    BOOST_CHECK_CLOSE(y[i], expected, 1e-10);
+    BOOST_CHECK_CLOSE(yPacked[i], expected, 1e-10);
+  }
+
+  // the scratch space of the first product must not leak into the second one
+  DataVector yPacked2(n);
+  packed.mult(x, yPacked2);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_EQUAL(yPacked2[i], yPacked[i]);
+  }
+
+  packed.set(5, 2, 42.0);
+  BOOST_CHECK_EQUAL(packed.get(2, 5), 42.0);
+
+  DataMatrix unpacked;
+  packed.toDataMatrix(unpacked);
+  BOOST_CHECK_EQUAL(unpacked.getNrows(), n);
+  BOOST_CHECK_EQUAL(unpacked.get(5, 2), 42.0);
+  BOOST_CHECK_EQUAL(unpacked.get(2, 5), 42.0);
+  BOOST_CHECK_EQUAL(unpacked.get(7, 3), m.get(3, 7));
+
+  BOOST_CHECK_THROW(packed.mult(DataVector(n + 1), yPacked), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(SymmetricPackedMatrix(DataMatrix(2, 3)), sgpp::base::data_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
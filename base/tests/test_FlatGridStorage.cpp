@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/grid/storage/hashmap/FlatGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::FlatGridPointView;
+using sgpp::base::FlatGridStorage;
+using sgpp::base::HashGenerator;
+using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridStorage;
+
+BOOST_AUTO_TEST_SUITE(TestFlatGridStorage)
+
+BOOST_AUTO_TEST_CASE(testInsert) {
+  FlatGridStorage s(2);
+  HashGridPoint p(2);
+
+  p.set(0, 1, 1);
+  p.set(1, 2, 3);
+
+  BOOST_CHECK_EQUAL(s.insert(p), 0U);
+  BOOST_CHECK_EQUAL(s.getSize(), 1U);
+
+  // inserting the same point again must not create a duplicate
+  BOOST_CHECK_EQUAL(s.insert(p), 0U);
+  BOOST_CHECK_EQUAL(s.getSize(), 1U);
+
+  p.set(1, 2, 1);
+  BOOST_CHECK_EQUAL(s.insert(p), 1U);
+  BOOST_CHECK_EQUAL(s.getSize(), 2U);
+
+  FlatGridPointView view = s[0];
+  BOOST_CHECK_EQUAL(view.getLevel(0), 1U);
+  BOOST_CHECK_EQUAL(view.getIndex(0), 1U);
+  BOOST_CHECK_EQUAL(view.getLevel(1), 2U);
+  BOOST_CHECK_EQUAL(view.getIndex(1), 3U);
+  BOOST_CHECK_CLOSE(view.getStandardCoordinate(1), 0.75, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(testConversion) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regular(s, 5);
+
+  FlatGridStorage flat(s);
+  BOOST_CHECK_EQUAL(flat.getSize(), s.getSize());
+  BOOST_CHECK_EQUAL(flat.getMaxLevel(), s.getMaxLevel());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    HashGridPoint& p = s[i];
+    FlatGridPointView view = flat[i];
+
+    BOOST_CHECK_EQUAL(view.getHash(), p.getHash());
+    BOOST_CHECK_EQUAL(view.isLeaf(), p.isLeaf());
+    BOOST_CHECK_EQUAL(view.getLevelSum(), p.getLevelSum());
+    BOOST_CHECK_EQUAL(flat.getSequenceNumber(p), i);
+
+    for (size_t d = 0; d < s.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(view.getLevel(d), p.getLevel(d));
+      BOOST_CHECK_EQUAL(view.getIndex(d), p.getIndex(d));
+      BOOST_CHECK_EQUAL(flat.getLevelArray(d)[i], p.getLevel(d));
+    }
+  }
+
+  HashGridStorage s2(3);
+  flat.toHashGridStorage(s2);
+  BOOST_CHECK_EQUAL(s2.getSize(), s.getSize());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK(s2[i].equals(s[i]));
+  }
+
+  DataMatrix level(s.getSize(), 3), index(s.getSize(), 3);
+  DataMatrix flatLevel, flatIndex;
+  s.getLevelIndexArraysForEval(level, index);
+  flat.getLevelIndexArraysForEval(flatLevel, flatIndex);
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    for (size_t d = 0; d < 3; d++) {
+      BOOST_CHECK_EQUAL(flatLevel.get(i, d), level.get(i, d));
+      BOOST_CHECK_EQUAL(flatIndex.get(i, d), index.get(i, d));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSeq) {
+  HashGridStorage s(2);
+  HashGenerator g;
+
+  g.regular(s, 3);
+
+  FlatGridStorage flat(s);
+  HashGridPoint p(2);
+
+  p.set(0, 2, 1);
+  p.set(1, 1, 1);
+  size_t seq = flat.getSequenceNumber(p);
+  BOOST_CHECK(!flat.isInvalidSequenceNumber(seq));
+  BOOST_CHECK(flat.isContaining(p));
+  BOOST_CHECK_EQUAL(seq, s.getSequenceNumber(p));
+
+  p.set(0, 4, 1);
+  seq = flat.getSequenceNumber(p);
+  BOOST_CHECK(flat.isInvalidSequenceNumber(seq));
+  BOOST_CHECK(!flat.isContaining(p));
+
+  // growing the storage must keep all sequence numbers valid
+  flat.reserve(4 * flat.getCapacity());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(flat.getSequenceNumber(s[i]), i);
+  }
+
+  flat.clear();
+  BOOST_CHECK_EQUAL(flat.getSize(), 0U);
+  BOOST_CHECK(!flat.isContaining(s[0]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
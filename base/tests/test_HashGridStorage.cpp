@@ -7,22 +7,34 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
-
+#include <sgpp/base/grid/storage/hashmap/MappedGridStorage.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
+using sgpp::base::BoundingBox;
+using sgpp::base::BoundingBox1D;
 using sgpp::base::DataVector;
+using sgpp::base::Grid;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
 using sgpp::base::HashGridStorage;
 using sgpp::base::HashRefinement;
 using sgpp::base::HashRefinementBoundaries;
+using sgpp::base::MappedGridStorage;
 using sgpp::base::SurplusRefinementFunctor;
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorage)
@@ -89,6 +101,107 @@ BOOST_AUTO_TEST_CASE(testSerializeWithLeaf) {
   delete[] srcLeaf;
 }
 
+BOOST_AUTO_TEST_CASE(testSerializeBinary) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  BoundingBox boundingBox(3);
+  boundingBox.setBoundary(1, BoundingBox1D(-1.0 / 3.0, 2.0 / 7.0));
+  s.setBoundingBox(boundingBox);
+  g.regular(s, 4);
+
+  DataVector alpha(s.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = 1.0 / static_cast<double>(i + 3);
+  }
+
+  // in-memory stream
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  s.serializeBinary(stream, &alpha);
+  MappedGridStorage mapped(stream);
+
+  BOOST_CHECK_EQUAL(mapped.getSize(), s.getSize());
+  BOOST_CHECK_EQUAL(mapped.getDimension(), s.getDimension());
+  BOOST_CHECK(mapped.hasCoefficients());
+  BOOST_CHECK_EQUAL(mapped.getBoundingBox()->getBoundary(1).leftBoundary, -1.0 / 3.0);
+  BOOST_CHECK_EQUAL(mapped.getBoundingBox()->getBoundary(1).rightBoundary, 2.0 / 7.0);
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(mapped.getSequenceNumber(s[i]), i);
+    BOOST_CHECK_EQUAL(mapped.isLeaf(i), s[i].isLeaf());
+    BOOST_CHECK_EQUAL(mapped.getCoefficientArray()[i], alpha[i]);
+
+    for (size_t d = 0; d < s.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(mapped.getLevel(i, d), s[i].getLevel(d));
+      BOOST_CHECK_EQUAL(mapped.getIndex(i, d), s[i].getIndex(d));
+    }
+  }
+
+  HashGridPoint p(3);
+  p.set(0, 7, 1);
+  p.set(1, 1, 1);
+  p.set(2, 1, 1);
+  BOOST_CHECK(mapped.isInvalidSequenceNumber(mapped.getSequenceNumber(p)));
+
+  // memory-mapped file
+  const std::string fileName = "test_HashGridStorage_binary.tmp";
+  {
+    std::ofstream file(fileName.c_str(), std::ios::binary);
+    s.serializeBinary(file);
+  }
+
+  {
+    MappedGridStorage mappedFile(fileName);
+    BOOST_CHECK(!mappedFile.hasCoefficients());
+
+    HashGridStorage s2(3);
+    mappedFile.toHashGridStorage(s2);
+    BOOST_CHECK_EQUAL(s2.getSize(), s.getSize());
+    BOOST_CHECK_EQUAL(s2.getBoundingBox()->getBoundary(1).leftBoundary, -1.0 / 3.0);
+
+    for (size_t i = 0; i < s.getSize(); i++) {
+      BOOST_CHECK(s2[i].equals(s[i]));
+      BOOST_CHECK_EQUAL(s2[i].isLeaf(), s[i].isLeaf());
+    }
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testMappedGridStorageIntoGrid) {
+  // load a binary grid with coefficients into the storage of a Grid and evaluate it
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(2));
+  grid->getGenerator().regular(4);
+  grid->getBoundingBox().setBoundary(0, BoundingBox1D(-1.0, 3.0));
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  grid->getStorage().serializeBinary(stream, &alpha);
+  MappedGridStorage mapped(stream);
+
+  std::unique_ptr<Grid> loadedGrid(Grid::createLinearBoundaryGrid(2));
+  mapped.toHashGridStorage(loadedGrid->getStorage());
+  DataVector loadedAlpha;
+  mapped.getCoefficients(loadedAlpha);
+  BOOST_CHECK_EQUAL(loadedGrid->getSize(), grid->getSize());
+
+  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+  std::unique_ptr<sgpp::base::OperationEval> loadedOpEval(
+      sgpp::op_factory::createOperationEval(*loadedGrid));
+  DataVector x(2);
+
+  for (size_t k = 0; k < 10; k++) {
+    x[0] = -1.0 + 0.37 * static_cast<double>(k);
+    x[1] = 0.09 * static_cast<double>(k);
+    BOOST_CHECK_EQUAL(loadedOpEval->eval(loadedAlpha, x), opEval->eval(alpha, x));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testInsert) {
   HashGridPoint i(1);
   HashGridStorage s(1);
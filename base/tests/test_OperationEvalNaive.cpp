@@ -20,6 +20,10 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -451,3 +455,149 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalGradientNaiveBatched) {
+  const size_t d = 4;
+  const size_t l = 4;
+  const size_t p = 3;
+  const size_t N = 50;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createNakBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletGrid(d)));
+
+  std::vector<std::unique_ptr<SBasis>> bases;
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineModifiedBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SNakBsplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SFundamentalSplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SWaveletBase()));
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    Grid& grid = *grids[k];
+    SBasis& basis = *bases[k];
+    grid.getGenerator().regular(l);
+    const size_t n = grid.getSize();
+
+    DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    // random points and grid points (where many 1D factors vanish,
+    // but not necessarily their derivatives)
+    DataMatrix points(2 * N, d);
+
+    for (size_t r = 0; r < N; r++) {
+      GridPoint& gp = grid.getStorage().getPoint((r * 7) % n);
+
+      for (size_t t = 0; t < d; t++) {
+        points(r, t) = uniformDistribution(generator);
+        points(N + r, t) = gp.getStandardCoordinate(t);
+      }
+    }
+
+    std::unique_ptr<OperationEvalGradient> opEvalGradient(
+        sgpp::op_factory::createOperationEvalGradientNaive(grid));
+    DataVector fx2;
+    DataMatrix fxGradient2;
+    opEvalGradient->evalGradient(alpha, points, fx2, fxGradient2);
+
+    BOOST_CHECK_EQUAL(fx2.getSize(), 2 * N);
+    BOOST_CHECK_EQUAL(fxGradient2.getNrows(), 2 * N);
+    BOOST_CHECK_EQUAL(fxGradient2.getNcols(), d);
+
+    for (size_t r = 0; r < 2 * N; r++) {
+      double fx = 0.0;
+      DataVector fxGradient(d, 0.0);
+
+      // evaluate function and gradient by hand
+      for (size_t i = 0; i < n; i++) {
+        GridPoint& gp = grid.getStorage().getPoint(i);
+        double val = alpha[i];
+
+        for (size_t t = 0; t < d; t++) {
+          val *= basisEval(basis, gp.getLevel(t), gp.getIndex(t), points(r, t));
+        }
+
+        fx += val;
+
+        for (size_t j = 0; j < d; j++) {
+          val = alpha[i];
+
+          for (size_t t = 0; t < d; t++) {
+            if (t == j) {
+              val *= basisEvalDx(basis, gp.getLevel(t), gp.getIndex(t), points(r, t));
+            } else {
+              val *= basisEval(basis, gp.getLevel(t), gp.getIndex(t), points(r, t));
+            }
+          }
+
+          fxGradient[j] += val;
+        }
+      }
+
+      BOOST_CHECK_SMALL(fx - fx2[r], 1e-10 * std::max(1.0, std::abs(fx)));
+
+      for (size_t t = 0; t < d; t++) {
+        BOOST_CHECK_SMALL(fxGradient[t] - fxGradient2(r, t),
+                          1e-10 * std::max(1.0, std::abs(fxGradient[t])));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalGradientNaiveChangedGrid) {
+  // the sorted grid of the pruned evaluation must be updated if the grid points change,
+  // even if the number of grid points stays the same (refinement and coarsening)
+  const size_t d = 2;
+  const size_t p = 3;
+  std::unique_ptr<Grid> grid(Grid::createBsplineGrid(d, p));
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  grid->getGenerator().regular(3);
+  const size_t n = grid->getSize();
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+  DataVector alpha(n);
+
+  for (size_t i = 0; i < n; i++) {
+    alpha[i] = normalDistribution(generator);
+  }
+
+  DataVector x(d);
+  x[0] = 0.3;
+  x[1] = 0.7;
+
+  std::unique_ptr<OperationEvalGradient> opEvalGradient(
+      sgpp::op_factory::createOperationEvalGradientNaive(*grid));
+  DataVector gradient(d);
+  opEvalGradient->evalGradient(alpha, x, gradient);
+
+  GridPoint gp(storage[n - 1]);
+  gp.set(0, gp.getLevel(0) + 1, 2 * gp.getIndex(0) - 1);
+  BOOST_REQUIRE(!storage.isContaining(gp));
+  storage.insert(gp);
+  std::list<size_t> removePoints = {0};
+  storage.deletePoints(removePoints);
+  BOOST_REQUIRE_EQUAL(storage.getSize(), n);
+
+  std::unique_ptr<OperationEvalGradient> opEvalGradientNew(
+      sgpp::op_factory::createOperationEvalGradientNaive(*grid));
+  DataVector gradientRef(d);
+  const double fxRef = opEvalGradientNew->evalGradient(alpha, x, gradientRef);
+  const double fx = opEvalGradient->evalGradient(alpha, x, gradient);
+
+  checkClose(fx, fxRef);
+  checkClose(gradient, gradientRef);
+}
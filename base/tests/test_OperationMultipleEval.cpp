@@ -11,13 +11,21 @@
 #include <sgpp/base/grid/Grid.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
+
+#include <list>
+#include <memory>
+#include <vector>
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::OperationEval;
 using sgpp::base::OperationMultipleEval;
+using sgpp::base::RandomNumberGenerator;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
@@ -78,4 +86,235 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalNaiveBlocked) {
+  // compare the blocked multi-threaded kernels of the "Naive" multiple evaluation operations
+  // (and the linear ones working on a FlatGridStorage) with pointwise evaluation
+  const size_t dim = 3;
+  const size_t numberDataPoints = 150;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineClenshawCurtisGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineClenshawCurtisGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyBoundaryGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyClenshawCurtisGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(dim)));
+
+  RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset.set(j, t, RandomNumberGenerator::getInstance().getUniformRN());
+    }
+  }
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(4);
+    const size_t N = grid->getSize();
+
+    DataVector alpha(N);
+    DataVector source(numberDataPoints);
+    RandomNumberGenerator::getInstance().getUniformRV(alpha, -1.0, 1.0);
+    RandomNumberGenerator::getInstance().getUniformRV(source, -1.0, 1.0);
+
+    std::unique_ptr<OperationMultipleEval> opMultEval(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+
+    DataVector result(numberDataPoints);
+    DataVector resultTranspose(N);
+    opMultEval->mult(alpha, result);
+    opMultEval->multTranspose(source, resultTranspose);
+
+    DataVector x(dim);
+    DataVector unitVector(N, 0.0);
+    DataVector resultTransposeRef(N, 0.0);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      dataset.getRow(j, x);
+      BOOST_CHECK_SMALL(result[j] - opEval->eval(alpha, x), 1e-10);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      unitVector[i] = 1.0;
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        dataset.getRow(j, x);
+        resultTransposeRef[i] += source[j] * opEval->eval(unitVector, x);
+      }
+
+      unitVector[i] = 0.0;
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeRef[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalUpdateDataset) {
+  // reuse an operation for a changed data set with a different number of points
+  const size_t dim = 2;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(dim)));
+
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(3);
+    DataVector alpha(grid->getSize());
+    RandomNumberGenerator::getInstance().getUniformRV(alpha, -1.0, 1.0);
+
+    DataMatrix dataset(20, dim);
+    DataVector x(dim);
+
+    for (size_t j = 0; j < dataset.getNrows(); j++) {
+      RandomNumberGenerator::getInstance().getUniformRV(x);
+      dataset.setRow(j, x);
+    }
+
+    std::unique_ptr<OperationMultipleEval> opMultEval(
+        (grid->getType() == sgpp::base::GridType::Linear)
+            ? sgpp::op_factory::createOperationMultipleEval(*grid, dataset)
+            : sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+    DataVector result(dataset.getNrows());
+    opMultEval->mult(alpha, result);
+
+    dataset.resize(33, dim);
+
+    for (size_t j = 0; j < dataset.getNrows(); j++) {
+      RandomNumberGenerator::getInstance().getUniformRV(x);
+      dataset.setRow(j, x);
+    }
+
+    BOOST_CHECK(opMultEval->updateDataset());
+
+    result.resize(dataset.getNrows());
+    opMultEval->mult(alpha, result);
+
+    for (size_t j = 0; j < dataset.getNrows(); j++) {
+      dataset.getRow(j, x);
+      BOOST_CHECK_SMALL(result[j] - opEval->eval(alpha, x), 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalNaiveChangedGrid) {
+  // the blocked kernels must not reuse stale data if the data set, the grid points
+  // (with the same number of points) or the bounding box change between two evaluations
+  const size_t dim = 2;
+  const size_t numberDataPoints = 40;
+  std::unique_ptr<Grid> grid(Grid::createBsplineGrid(dim, 3));
+  GridStorage& storage = grid->getStorage();
+  grid->getGenerator().regular(3);
+  const size_t N = grid->getSize();
+
+  RandomNumberGenerator::getInstance().setSeed(42);
+  DataVector alpha(N);
+  RandomNumberGenerator::getInstance().getUniformRV(alpha, -1.0, 1.0);
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector x(dim);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    RandomNumberGenerator::getInstance().getUniformRV(x);
+    dataset.setRow(j, x);
+  }
+
+  std::unique_ptr<OperationMultipleEval> opMultEval(
+      sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+  std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+  DataVector result(numberDataPoints);
+  opMultEval->mult(alpha, result);
+
+  for (size_t step = 0; step < 3; step++) {
+    if (step == 0) {
+      // change the data points in place (same number of points, no updateDataset())
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        RandomNumberGenerator::getInstance().getUniformRV(x);
+        dataset.setRow(j, x);
+      }
+    } else if (step == 1) {
+      // refine and coarsen such that the number of grid points does not change
+      sgpp::base::GridPoint gp(storage[N - 1]);
+      gp.set(0, gp.getLevel(0) + 1, 2 * gp.getIndex(0) - 1);
+      BOOST_REQUIRE(!storage.isContaining(gp));
+      storage.insert(gp);
+      std::list<size_t> removePoints = {0};
+      storage.deletePoints(removePoints);
+      BOOST_REQUIRE_EQUAL(storage.getSize(), N);
+    } else {
+      // change the bounding box (the data points are mapped accordingly)
+      grid->getBoundingBox().setBoundary(0, BoundingBox1D(-1.0, 2.0));
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        dataset.set(j, 0, 3.0 * dataset.get(j, 0) - 1.0);
+      }
+    }
+
+    opMultEval->mult(alpha, result);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      dataset.getRow(j, x);
+      BOOST_CHECK_SMALL(result[j] - opEval->eval(alpha, x), 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMultMatrix) {
+  // evaluate several coefficient vectors at once and compare with mult for each column
+  const size_t dim = 3;
+  const size_t numberDataPoints = 70;
+  const size_t numberColumns = 4;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(dim, 3)));
+
+  RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector x(dim);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    RandomNumberGenerator::getInstance().getUniformRV(x);
+    dataset.setRow(j, x);
+  }
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(3);
+    const size_t N = grid->getSize();
+
+    DataMatrix alpha(N, numberColumns);
+    DataVector column(N);
+
+    for (size_t k = 0; k < numberColumns; k++) {
+      RandomNumberGenerator::getInstance().getUniformRV(column, -1.0, 1.0);
+      alpha.setColumn(k, column);
+    }
+
+    std::unique_ptr<OperationMultipleEval> opMultEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    DataMatrix result;
+    opMultEval->multMatrix(alpha, result);
+
+    BOOST_REQUIRE_EQUAL(result.getNrows(), numberDataPoints);
+    BOOST_REQUIRE_EQUAL(result.getNcols(), numberColumns);
+
+    DataVector resultColumn(numberDataPoints);
+
+    for (size_t k = 0; k < numberColumns; k++) {
+      alpha.getColumn(k, column);
+      opMultEval->mult(column, resultColumn);
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        BOOST_CHECK_SMALL(result.get(j, k) - resultColumn[j], 1e-12);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
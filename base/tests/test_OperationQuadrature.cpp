@@ -17,6 +17,7 @@
 
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 
+#include <cmath>
 #include <vector>
 
 using sgpp::base::BoundingBox1D;
@@ -307,6 +308,65 @@ BOOST_AUTO_TEST_CASE(testQuadratureMC) {
   delete opMC;
 }
 
+double productFunction(int dim, double* x, void* clientdata) {
+  double res = 1.0;
+
+  for (int d = 0; d < dim; d++) {
+    res *= x[d];
+  }
+
+  return res;
+}
+
+BOOST_AUTO_TEST_CASE(testQuadratureMCBatched) {
+  size_t dim = 3;
+  size_t level = 3;
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  GridStorage& gS = grid->getStorage();
+
+  grid->getBoundingBox().setBoundary(0, BoundingBox1D(3.0, 5.0));
+  grid->getBoundingBox().setBoundary(1, BoundingBox1D(-2.0, 2.0));
+  grid->getBoundingBox().setBoundary(2, BoundingBox1D(2.0, 3.0));
+
+  DataVector alpha(gS.getSize());
+
+  for (size_t i = 0; i < gS.getSize(); i++) alpha[i] = static_cast<double>(i);
+
+  double resDirect =
+      std::unique_ptr<OperationQuadrature>(sgpp::op_factory::createOperationQuadrature(*grid))
+          ->doQuadrature(alpha);
+
+  const size_t numSamples = 100000;
+  OperationQuadratureMC opMC(*grid, static_cast<int>(numSamples));
+  opMC.setSeed(42);
+  opMC.setBlockSize(1000);
+  double resMC = opMC.doQuadratureBatched(alpha);
+
+  BOOST_CHECK_CLOSE(resDirect, resMC, 1.0);
+  BOOST_CHECK_EQUAL(opMC.getNumberOfUsedSamples(), numSamples);
+  BOOST_CHECK_GT(opMC.getVarianceEstimate(), 0.0);
+  // the error should be within a few standard errors
+  BOOST_CHECK_LE(std::abs(resMC - resDirect), 5.0 * std::sqrt(opMC.getVarianceEstimate()));
+
+  // the blocks have their own random number streams
+  BOOST_CHECK_EQUAL(opMC.doQuadratureBatched(alpha), resMC);
+
+  // stop early as soon as the standard error is small enough
+  const double tolerance = 10.0 * std::sqrt(opMC.getVarianceEstimate());
+  double resEarly = opMC.doQuadratureBatched(alpha, tolerance);
+  BOOST_CHECK_LT(opMC.getNumberOfUsedSamples(), numSamples);
+  BOOST_CHECK_EQUAL(opMC.getNumberOfUsedSamples() % 1000, 0);
+  BOOST_CHECK_LE(std::sqrt(opMC.getVarianceEstimate()), tolerance);
+  BOOST_CHECK_CLOSE(resDirect, resEarly, 5.0);
+
+  // the integral of x_1 x_2 x_3 over the bounding box vanishes
+  double resFunc = opMC.doQuadratureFuncBatched(productFunction, nullptr);
+  BOOST_CHECK_GT(opMC.getVarianceEstimate(), 0.0);
+  BOOST_CHECK_SMALL(resFunc, 5.0 * std::sqrt(opMC.getVarianceEstimate()));
+}
+
 BOOST_AUTO_TEST_CASE(test_GaussQuadrature) {
   sgpp::base::GaussLegendreQuadRule1D quadRule1D;
 
@@ -7,18 +7,22 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/function/scalar/InterpolantScalarFunction.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/base/tools/sle/solver/Armadillo.hpp>
 #include <sgpp/base/tools/sle/solver/Auto.hpp>
 #include <sgpp/base/tools/sle/solver/BiCGStab.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/solver/Eigen.hpp>
 #include <sgpp/base/tools/sle/solver/GaussianElimination.hpp>
 #include <sgpp/base/tools/sle/solver/Gmmpp.hpp>
 #include <sgpp/base/tools/sle/solver/UMFPACK.hpp>
 #include <sgpp/base/tools/sle/system/FullSLE.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/base/tools/sle/system/SparseSLE.hpp>
 
 #include <cmath>
 #include <limits>
@@ -333,3 +337,218 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+void testCSRMatrix(SLE& system, const std::vector<size_t>& rowPointers,
+                   const std::vector<size_t>& columnIndices, const std::vector<double>& values) {
+  // compare CSR matrix with sgpp::base::SLE::getMatrixEntry
+  const size_t n = system.getDimension();
+  BOOST_REQUIRE_EQUAL(rowPointers.size(), n + 1);
+  BOOST_CHECK_EQUAL(rowPointers[n], values.size());
+  BOOST_CHECK_EQUAL(columnIndices.size(), values.size());
+
+  for (size_t i = 0; i < n; i++) {
+    size_t k = rowPointers[i];
+
+    for (size_t j = 0; j < n; j++) {
+      const double Aij = system.getMatrixEntry(i, j);
+
+      if (Aij != 0.0) {
+        BOOST_REQUIRE_LT(k, rowPointers[i + 1]);
+        BOOST_CHECK_EQUAL(columnIndices[k], j);
+        BOOST_CHECK_EQUAL(values[k], Aij);
+        k++;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(k, rowPointers[i + 1]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSparseAssembly) {
+  // Test sgpp::base::HierarchisationSLE::getCSRMatrix and sgpp::base::SparseSLE.
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 3;
+  const size_t p = 3;
+  const size_t l = 3;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGridsSLE(d, p, grids);
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+      sgpp::base::Grid::createFundamentalNakSplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+      sgpp::base::Grid::createWeaklyFundamentalSplineBoundaryGrid(d, p)));
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    // spatially adaptive refinement
+    sgpp::base::DataVector surpluses(n, 0.0);
+    surpluses[n / 2] = 1.0;
+    surpluses[n - 1] = 1.0;
+    sgpp::base::SurplusRefinementFunctor functor(surpluses, 2);
+    grid->getGenerator().refine(functor);
+
+    HierarchisationSLE system(*grid);
+    BOOST_CHECK(system.hasSparseAssembly());
+
+    std::vector<size_t> rowPointers;
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
+    system.getCSRMatrix(rowPointers, columnIndices, values);
+    testCSRMatrix(system, rowPointers, columnIndices, values);
+    BOOST_CHECK_EQUAL(system.countNNZ(), values.size());
+    BOOST_CHECK_EQUAL(system.SLE::countNNZ(), values.size());
+
+    // sparse system
+    sgpp::base::SparseSLE sparseSystem(system);
+    sgpp::base::DataVector x(system.getDimension());
+    sgpp::base::DataVector b(system.getDimension());
+
+    for (size_t i = 0; i < x.getSize(); i++) {
+      x[i] = RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+    }
+
+    system.matrixVectorMultiplication(x, b);
+    sgpp::base::DataMatrix A(0, 0);
+    testSLESystem(sparseSystem, x, b, A);
+    BOOST_CHECK_EQUAL(sparseSystem.countNNZ(), values.size());
+
+    // solution via the shared sparse matrix
+    sgpp::base::sle_solver::Auto solver;
+    sgpp::base::DataVector alpha(0);
+    BOOST_CHECK(solver.solve(system, b, alpha));
+    testSLESolution(A, alpha, b);
+  }
+
+  // pattern of the univariate basis functions with local support on higher levels
+  // (the support radius is checked away from and near the boundary)
+  for (size_t p : {1, 3, 5}) {
+    const size_t d = 2;
+    const size_t l = 5;
+
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineBoundaryGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createBsplineClenshawCurtisGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createModBsplineClenshawCurtisGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createNaturalBsplineBoundaryGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createNakBsplineBoundaryGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModNakBsplineGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearClenshawCurtisGrid(d)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(d)));
+
+    for (auto& grid : grids) {
+      grid->getGenerator().regular(l);
+      HierarchisationSLE system(*grid);
+
+      std::vector<size_t> rowPointers;
+      std::vector<size_t> columnIndices;
+      std::vector<double> values;
+      system.getCSRMatrix(rowPointers, columnIndices, values);
+      testCSRMatrix(system, rowPointers, columnIndices, values);
+      BOOST_CHECK_EQUAL(system.countNNZ(), values.size());
+    }
+  }
+
+  // default assembly of cloneable systems
+  sgpp::base::DataMatrix A(3, 3, 0.0);
+  A(0, 0) = 1.0;
+  A(1, 2) = -2.0;
+  A(2, 0) = 3.0;
+  A(2, 1) = 0.5;
+  FullSLE system(A);
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
+  system.getCSRMatrix(rowPointers, columnIndices, values);
+  testCSRMatrix(system, rowPointers, columnIndices, values);
+  BOOST_CHECK_EQUAL(values.size(), 4U);
+}
+
+BOOST_AUTO_TEST_CASE(TestCombinationTechnique) {
+  // Test sgpp::base::sle_solver::CombinationTechnique with sgpp::base::HierarchisationSLE.
+  Printer::getInstance().setVerbosity(-1);
+
+  const size_t d = 2;
+  const size_t p = 3;
+  const size_t l = 5;
+
+  sgpp::base::sle_solver::CombinationTechnique solver;
+  ExampleFunctionSLE f;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGridsSLE(d, p, grids);
+
+  for (auto& grid : grids) {
+    sgpp::base::DataVector functionValues(0);
+    createSampleGridSLE(*grid, l, f, functionValues);
+    sgpp::base::GridStorage& gridStorage = grid->getStorage();
+    const size_t n = gridStorage.getSize();
+    BOOST_CHECK(sgpp::base::sle_solver::CombinationTechnique::isApplicable(gridStorage));
+
+    HierarchisationSLE system(*grid);
+    sgpp::base::DataMatrix A(n, n);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        A(i, j) = system.getMatrixEntry(i, j);
+      }
+    }
+
+    // single right-hand side
+    sgpp::base::DataVector alpha(0);
+    BOOST_CHECK(solver.solve(system, functionValues, alpha));
+    testSLESolution(A, alpha, functionValues);
+
+    // multiple right-hand sides
+    sgpp::base::DataMatrix B(n, 2);
+    sgpp::base::DataMatrix X(0, 0);
+    sgpp::base::DataVector b(n);
+    B.setColumn(0, functionValues);
+
+    for (size_t i = 0; i < n; i++) {
+      B(i, 1) = static_cast<double>(i % 7);
+    }
+
+    BOOST_CHECK(solver.solve(system, B, X));
+
+    for (size_t k = 0; k < 2; k++) {
+      B.getColumn(k, b);
+      X.getColumn(k, alpha);
+      testSLESolution(A, alpha, b);
+    }
+
+    // spatially adaptive grids are solved with the fallback solver
+    sgpp::base::DataVector surpluses(n, 0.0);
+    surpluses[n - 1] = 1.0;
+    sgpp::base::SurplusRefinementFunctor functor(surpluses, 1);
+    grid->getGenerator().refine(functor);
+    BOOST_CHECK(!sgpp::base::sle_solver::CombinationTechnique::isApplicable(gridStorage));
+  }
+
+  // hierarchisation operation of modified B-splines
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModBsplineGrid(d, p));
+  sgpp::base::DataVector functionValues(0);
+  createSampleGridSLE(*grid, l, f, functionValues);
+  sgpp::base::DataVector alpha(functionValues);
+  std::unique_ptr<sgpp::base::OperationHierarchisation> op(
+      sgpp::op_factory::createOperationHierarchisation(*grid));
+  op->doHierarchisation(alpha);
+  op->doDehierarchisation(alpha);
+
+  for (size_t i = 0; i < functionValues.getSize(); i++) {
+    BOOST_CHECK_CLOSE(alpha[i], functionValues[i], 1e-8);
+  }
+}
@@ -7,6 +7,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/operation/hash/common/basis/FixedDegreeBsplineBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearClenshawCurtisBoundaryBasis.hpp>
@@ -374,6 +375,31 @@ BOOST_AUTO_TEST_CASE(TestBsplineBoundaryBasis) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestFixedDegreeBsplineBasis) {
+  // Test B-spline bases with compile-time degree against the runtime degree version.
+  sgpp::base::SBsplineBaseDegree1 basis1;
+  sgpp::base::SBsplineBaseDegree3 basis3;
+  sgpp::base::SBsplineBaseDegree5 basis5;
+  std::vector<SBasis*> fixedDegreeBases = {&basis1, &basis3, &basis5};
+
+  linearUniformUnmodifiedTest(basis1);
+
+  for (SBasis* fixedDegreeBasis : fixedDegreeBases) {
+    sgpp::base::SBsplineBase basis(fixedDegreeBasis->getDegree());
+    bsplinePropertiesTest(*fixedDegreeBasis);
+
+    for (level_t l = 1; l <= 4; l++) {
+      for (index_t i = 1; i < (static_cast<index_t>(1) << l); i += 2) {
+        for (double x = -0.1; x <= 1.1; x += 1.0 / 256.0) {
+          BOOST_CHECK_SMALL(fixedDegreeBasis->eval(l, i, x) - basis.eval(l, i, x), 1e-12);
+        }
+      }
+    }
+  }
+
+  BOOST_CHECK_THROW(sgpp::base::SBsplineBaseDegree3(5), sgpp::base::operation_exception);
+}
+
 BOOST_AUTO_TEST_CASE(TestBsplineClenshawCurtisBoundaryBasis) {
   // Test B-spline ClenshawCurtis basis.
   sgpp::base::SBsplineClenshawCurtisBase basis(1);
@@ -0,0 +1,128 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_benchmarkEvalCombinationGrid_cpp Benchmark of the Combigrid Evaluation (C++)
+ *
+ * This example compares the run time of sgpp::combigrid::OperationEvalCombinationGrid::multiEval,
+ * which evaluates the full grids in parallel with sum factorization, with the straightforward
+ * evaluation that loops over all points and all full grid basis functions and evaluates the
+ * \f$d\f$-variate basis function for every pair.
+ */
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "sgpp_base.hpp"
+#include "sgpp_combigrid.hpp"
+
+/**
+ * The straightforward evaluation of a full grid function, i.e., the evaluation engine of
+ * sgpp::combigrid::OperationEvalFullGrid before the introduction of sum factorization.
+ */
+void evalStraightforward(const sgpp::combigrid::FullGrid& fullGrid,
+    const sgpp::base::DataVector& surpluses, const sgpp::base::DataMatrix& points,
+    sgpp::base::DataVector& result) {
+  const sgpp::combigrid::LevelVector& level = fullGrid.getLevel();
+  const sgpp::combigrid::HeterogeneousBasis& basis = fullGrid.getBasis();
+  const size_t n = points.getNrows();
+  sgpp::base::DataVector point(points.getNcols());
+  size_t i = 0;
+  result.resize(n);
+  result.setAll(0.0);
+
+  for (const sgpp::combigrid::IndexVector& index : sgpp::combigrid::IndexVectorRange(fullGrid)) {
+    for (size_t j = 0; j < n; j++) {
+      points.getRow(j, point);
+      result[j] += surpluses[i] * basis.eval(level, index, point);
+    }
+
+    i++;
+  }
+}
+
+/**
+ * We use nodal and hierarchical cubic B-splines on a regular sparse grid in four dimensions.
+ */
+int main() {
+  // dimensionality
+  const size_t dim = 4;
+  // regular level
+  const size_t n = 5;
+  // B-spline degree
+  const size_t p = 3;
+  // number of evaluation points
+  const size_t numberOfPoints = 2000;
+
+  sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+  sgpp::base::DataMatrix points(numberOfPoints, dim);
+
+  for (size_t j = 0; j < numberOfPoints; j++) {
+    for (size_t d = 0; d < dim; d++) {
+      points(j, d) = sgpp::base::RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  for (bool isHierarchical : {false, true}) {
+    sgpp::base::SBsplineBase basis1d(p);
+    sgpp::combigrid::HeterogeneousBasis basis(dim, basis1d, isHierarchical);
+    sgpp::combigrid::CombinationGrid combiGrid =
+        sgpp::combigrid::CombinationGrid::fromRegularSparse(dim, n, basis);
+    const std::vector<sgpp::combigrid::FullGrid>& fullGrids = combiGrid.getFullGrids();
+
+    // arbitrary coefficients
+    std::vector<sgpp::base::DataVector> surpluses(fullGrids.size());
+
+    for (size_t i = 0; i < fullGrids.size(); i++) {
+      surpluses[i].resize(fullGrids[i].getNumberOfIndexVectors());
+
+      for (size_t k = 0; k < surpluses[i].size(); k++) {
+        surpluses[i][k] = std::sin(static_cast<double>(i + k));
+      }
+    }
+
+    /**
+     * First, we evaluate with the straightforward method.
+     */
+    sgpp::base::SGppStopwatch stopwatch;
+    stopwatch.start();
+    sgpp::base::DataMatrix values(numberOfPoints, fullGrids.size());
+    sgpp::base::DataVector curValues(numberOfPoints);
+
+    for (size_t i = 0; i < fullGrids.size(); i++) {
+      evalStraightforward(fullGrids[i], surpluses[i], points, curValues);
+      values.setColumn(i, curValues);
+    }
+
+    sgpp::base::DataVector resultStraightforward;
+    combiGrid.combineValues(values, resultStraightforward);
+    const double timeStraightforward = stopwatch.stop();
+
+    /**
+     * Then, we evaluate with sgpp::combigrid::OperationEvalCombinationGrid.
+     */
+    stopwatch.start();
+    sgpp::combigrid::OperationEvalCombinationGrid operation(combiGrid);
+    sgpp::base::DataVector result;
+    operation.multiEval(surpluses, points, result);
+    const double timeOperation = stopwatch.stop();
+
+    double maxDifference = 0.0;
+
+    for (size_t j = 0; j < numberOfPoints; j++) {
+      maxDifference = std::max(maxDifference, std::abs(result[j] - resultStraightforward[j]));
+    }
+
+    std::cout << (isHierarchical ? "hierarchical" : "nodal") << " B-splines, "
+              << fullGrids.size() << " full grids, " << numberOfPoints << " points\n";
+    std::cout << "  straightforward:   " << timeStraightforward << " s\n";
+    std::cout << "  sum factorization: " << timeOperation << " s (speedup "
+              << timeStraightforward / timeOperation << ")\n";
+    std::cout << "  max. difference:   " << maxDifference << "\n";
+  }
+
+  return 0;
+}
@@ -35,13 +35,20 @@ void OperationEvalCombinationGrid::multiEval(const std::vector<base::DataVector>
     const base::DataMatrix& points, base::DataVector& result) {
   const std::vector<FullGrid>& fullGrids = grid.getFullGrids();
   base::DataMatrix values(points.getNrows(), fullGrids.size());
-  base::DataVector curValues(points.getNrows());
-  OperationEvalFullGrid operationEvalFullGrid;
 
-  for (size_t i = 0; i < fullGrids.size(); i++) {
-    operationEvalFullGrid.setGrid(fullGrids[i]);
-    operationEvalFullGrid.multiEval(surpluses[i], points, curValues);
-    values.setColumn(i, curValues);
+  // the full grids are evaluated in parallel (the evaluation of the points of one full grid
+  // is parallelized, too, if nested parallelism is enabled)
+#pragma omp parallel
+  {
+    base::DataVector curValues(points.getNrows());
+    OperationEvalFullGrid operationEvalFullGrid;
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < fullGrids.size(); i++) {
+      operationEvalFullGrid.setGrid(fullGrids[i]);
+      operationEvalFullGrid.multiEval(surpluses[i], points, curValues);
+      values.setColumn(i, curValues);
+    }
   }
 
   grid.combineValues(values, result);
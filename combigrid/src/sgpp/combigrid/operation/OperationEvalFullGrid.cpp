@@ -8,13 +8,58 @@
 #include <sgpp/combigrid/grid/IndexVectorRange.hpp>
 #include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/**
+ * Contract the coefficient tensor with the 1D basis values of the dimensions 0, ..., d,
+ * where the 1D indices of the dimensions d+1, ..., dim-1 are already fixed.
+ *
+ * @param surpluses       coefficients (the order is given by IndexVectorRange)
+ * @param basisValues1d   1D basis values of all dimensions
+ * @param offsets1d       offsets of the dimensions in basisValues1d
+ * @param strides         strides of the dimensions in surpluses
+ * @param begin           first non-zero 1D basis function per dimension
+ * @param end             last non-zero 1D basis function (plus one) per dimension
+ * @param d               current dimension
+ * @param k               offset in surpluses corresponding to the fixed 1D indices
+ * @return contracted value
+ */
+double contract(const double* surpluses, const double* basisValues1d, const size_t* offsets1d,
+    const size_t* strides, const size_t* begin, const size_t* end, size_t d, size_t k) {
+  const double* values = basisValues1d + offsets1d[d];
+  double result = 0.0;
+
+  if (d == 0) {
+    // innermost dimension: coefficients are contiguous
+    for (size_t i = begin[0]; i < end[0]; i++) {
+      result += surpluses[k + i] * values[i];
+    }
+  } else {
+    for (size_t i = begin[d]; i < end[d]; i++) {
+      if (values[i] != 0.0) {
+        result += values[i] * contract(surpluses, basisValues1d, offsets1d, strides, begin, end,
+            d - 1, k + i * strides[d]);
+      }
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
 OperationEvalFullGrid::OperationEvalFullGrid() : grid() {
+  prepare();
 }
 
 OperationEvalFullGrid::OperationEvalFullGrid(const FullGrid& grid) : grid(grid) {
+  prepare();
 }
 
 OperationEvalFullGrid::~OperationEvalFullGrid() {
@@ -22,36 +67,30 @@ OperationEvalFullGrid::~OperationEvalFullGrid() {
 
 double OperationEvalFullGrid::eval(const base::DataVector& surpluses,
     const base::DataVector& point) {
-  const LevelVector& level = grid.getLevel();
-  const HeterogeneousBasis& basis = grid.getBasis();
-  size_t i = 0;
-  double result = 0.0;
+  std::vector<double> basisValues1d(basisLevel1d.size());
+  std::vector<size_t> begin(grid.getDimension());
+  std::vector<size_t> end(grid.getDimension());
 
-  for (const IndexVector& index : IndexVectorRange(grid)) {
-    result += surpluses[i] * basis.eval(level, index, point);
-    i++;
-  }
-
-  return result;
+  return evalSumFactorized(surpluses.getPointer(), point.getPointer(), basisValues1d, begin, end);
 }
 
 void OperationEvalFullGrid::multiEval(const base::DataVector& surpluses,
     const base::DataMatrix& points, base::DataVector& result) {
-  const LevelVector& level = grid.getLevel();
-  const HeterogeneousBasis& basis = grid.getBasis();
   const size_t n = points.getNrows();
-  base::DataVector point(points.getNcols());
-  size_t i = 0;
+  const size_t dim = points.getNcols();
   result.resize(n);
-  result.setAll(0.0);
 
-  for (const IndexVector& index : IndexVectorRange(grid)) {
+#pragma omp parallel
+  {
+    std::vector<double> basisValues1d(basisLevel1d.size());
+    std::vector<size_t> begin(grid.getDimension());
+    std::vector<size_t> end(grid.getDimension());
+
+#pragma omp for schedule(static)
     for (size_t j = 0; j < n; j++) {
-      points.getRow(j, point);
-      result[j] += surpluses[i] * basis.eval(level, index, point);
+      result[j] = evalSumFactorized(surpluses.getPointer(), points.getPointer() + j * dim,
+          basisValues1d, begin, end);
     }
-
-    i++;
   }
 }
 
@@ -61,6 +100,81 @@ const FullGrid& OperationEvalFullGrid::getGrid() const {
 
 void OperationEvalFullGrid::setGrid(const FullGrid& grid) {
   this->grid = grid;
+  prepare();
+}
+
+void OperationEvalFullGrid::prepare() {
+  const size_t dim = grid.getDimension();
+  const LevelVector& level = grid.getLevel();
+  const bool isHierarchical = grid.getBasis().isHierarchical();
+
+  offsets1d.resize(dim + 1);
+  strides.resize(dim);
+  basisLevel1d.clear();
+  basisIndex1d.clear();
+  offsets1d[0] = 0;
+  size_t stride = 1;
+
+  for (size_t d = 0; d < dim; d++) {
+    const index_t minIndex = grid.getMinIndex(d);
+    const index_t maxIndex = grid.getMaxIndex(d);
+
+    for (index_t i = minIndex; i <= maxIndex; i++) {
+      level_t levelBasis = level[d];
+      index_t indexBasis = i;
+
+      if (isHierarchical) {
+        HeterogeneousBasis::hierarchizeLevelIndex(levelBasis, indexBasis);
+      }
+
+      basisLevel1d.push_back(levelBasis);
+      basisIndex1d.push_back(indexBasis);
+    }
+
+    offsets1d[d + 1] = basisLevel1d.size();
+    strides[d] = stride;
+    stride *= offsets1d[d + 1] - offsets1d[d];
+  }
+}
+
+double OperationEvalFullGrid::evalSumFactorized(const double* surpluses, const double* point,
+    std::vector<double>& basisValues1d, std::vector<size_t>& begin,
+    std::vector<size_t>& end) const {
+  const size_t dim = grid.getDimension();
+
+  if (dim == 0) {
+    return surpluses[0];
+  }
+
+  const std::vector<base::Basis<level_t, index_t>*>& bases1d = grid.getBasis().getBases1d();
+
+  // evaluate 1D basis functions and determine the range of non-zero values
+  for (size_t d = 0; d < dim; d++) {
+    base::Basis<level_t, index_t>& basis1d = *bases1d[d];
+    const size_t offset = offsets1d[d];
+    const size_t count = offsets1d[d + 1] - offset;
+    begin[d] = count;
+    end[d] = 0;
+
+    for (size_t i = 0; i < count; i++) {
+      const double value = basis1d.eval(basisLevel1d[offset + i], basisIndex1d[offset + i],
+          point[d]);
+      basisValues1d[offset + i] = value;
+
+      if (value != 0.0) {
+        begin[d] = std::min(begin[d], i);
+        end[d] = i + 1;
+      }
+    }
+
+    if (begin[d] >= end[d]) {
+      // all basis functions vanish at the point
+      return 0.0;
+    }
+  }
+
+  return contract(surpluses, basisValues1d.data(), offsets1d.data(), strides.data(),
+      begin.data(), end.data(), dim - 1, 0);
 }
 
 }  // namespace combigrid
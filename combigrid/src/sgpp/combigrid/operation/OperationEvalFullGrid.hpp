@@ -9,13 +9,21 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/combigrid/LevelIndexTypes.hpp>
 #include <sgpp/combigrid/grid/FullGrid.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
 /**
  * Operation for evaluating a full grid function (linear combination of full grid basis functions).
+ *
+ * The evaluation exploits the tensor product structure of the basis functions (sum factorization):
+ * the 1D basis functions are evaluated only once per dimension and point, and only the
+ * coefficients of the basis functions whose 1D factors do not vanish at the point are visited.
+ * Multiple points are evaluated in parallel.
  */
 class OperationEvalFullGrid : public base::OperationEval {
  public:
@@ -69,6 +77,38 @@ class OperationEvalFullGrid : public base::OperationEval {
  protected:
   /// full grid
   FullGrid grid;
+  /// offsets of the dimensions in basisLevel1d/basisIndex1d and in the 1D basis value buffers
+  std::vector<size_t> offsets1d;
+  /// (hierarchized) levels of the 1D basis functions of all dimensions
+  std::vector<level_t> basisLevel1d;
+  /// (hierarchized) indices of the 1D basis functions of all dimensions
+  std::vector<index_t> basisIndex1d;
+  /// strides of the dimensions in the coefficient vector (the order is given by IndexVectorRange)
+  std::vector<size_t> strides;
+
+  /**
+   * Precompute the levels and indices of the 1D basis functions and the strides of the
+   * coefficient tensor for the current grid.
+   */
+  void prepare();
+
+  /**
+   * Evaluate the full grid function at one point (sum factorization). First, the values of all
+   * 1D basis functions are computed in every dimension, then the coefficient tensor is contracted
+   * dimension by dimension, where only the range of 1D basis functions which do not vanish at
+   * the point is traversed.
+   *
+   * @param surpluses         coefficients for the full grid basis functions
+   * @param point             point at which to evaluate the full grid function
+   * @param basisValues1d     buffer for the 1D basis values (same size as basisLevel1d)
+   * @param begin             buffer for the first non-zero 1D basis function per dimension
+   * @param end               buffer for the last non-zero 1D basis function (plus one)
+   *                          per dimension
+   * @return value of the full grid function at the given point
+   */
+  double evalSumFactorized(const double* surpluses, const double* point,
+      std::vector<double>& basisValues1d, std::vector<size_t>& begin,
+      std::vector<size_t>& end) const;
 };
 
 }  // namespace combigrid
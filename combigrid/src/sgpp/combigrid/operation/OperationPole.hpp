@@ -9,12 +9,17 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
 /**
  * Operation on a pole of a full grid. A pole is a one-dimensional sub-grid (1D entries of
  * the index vector/coordinates are fixed in all dimensions but one).
+ *
+ * As OperationUPCombinationGrid processes multiple full grids in parallel, implementations
+ * of apply and applyMultiple have to be thread-safe.
  */
 class OperationPole {
  public:
@@ -59,6 +64,27 @@ class OperationPole {
    */
   virtual void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) = 0;
+
+  /**
+   * Apply the operator on multiple poles of the same full grid. The poles have to be disjoint.
+   * The default implementation calls apply for every pole, derived classes may override this
+   * to process the poles more efficiently (e.g., all at once or in parallel).
+   *
+   * @param[in,out] values    data vector for all full grid points
+   *                          (the order is given by IndexVectorRange)
+   * @param[in] starts        sequence numbers of the first grid points of the poles
+   * @param[in] step          difference of sequence numbers of two subsequent grid points of
+   *                          the poles
+   * @param[in] count         number of grid points of every pole
+   * @param[in] level         level of the full grid
+   * @param[in] hasBoundary   whether the full grid has points on the boundary
+   */
+  virtual void applyMultiple(base::DataVector& values, const std::vector<size_t>& starts,
+      size_t step, size_t count, level_t level, bool hasBoundary = true) {
+    for (const size_t start : starts) {
+      apply(values, start, step, count, level, hasBoundary);
+    }
+  }
 };
 
 }  // namespace combigrid
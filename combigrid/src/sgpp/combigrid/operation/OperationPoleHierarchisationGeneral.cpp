@@ -6,7 +6,11 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationGeneral.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 namespace sgpp {
@@ -38,20 +42,116 @@ void OperationPoleHierarchisationGeneral::fromHeterogenerousBasis(const Heteroge
 
 void OperationPoleHierarchisationGeneral::apply(base::DataVector& values, size_t start, size_t step,
     size_t count, level_t level, bool hasBoundary) {
-  base::DataVector rhs(count);
+  if (count == 0) {
+    return;
+  }
+
+  const base::LUFactorization& factorization = getFactorization(count, level, hasBoundary);
+
+  if (factorization.isSingular()) {
+    applyWithSLESolver(values, std::vector<size_t>{start}, step, count, level, hasBoundary);
+    return;
+  }
+
   base::DataVector solution(count);
 
   for (size_t i = 0; i < count; i++) {
-    rhs[i] = values[start + i * step];
+    solution[i] = values[start + i * step];
+  }
+
+  factorization.solve(solution.getPointer(), 1);
+
+  for (size_t i = 0; i < count; i++) {
+    values[start + i * step] = solution[i];
   }
+}
+
+void OperationPoleHierarchisationGeneral::applyMultiple(base::DataVector& values,
+    const std::vector<size_t>& starts, size_t step, size_t count, level_t level,
+    bool hasBoundary) {
+  if ((count == 0) || starts.empty()) {
+    return;
+  }
+
+  const base::LUFactorization& factorization = getFactorization(count, level, hasBoundary);
+
+  if (factorization.isSingular()) {
+    applyWithSLESolver(values, starts, step, count, level, hasBoundary);
+    return;
+  }
+
+  // number of poles that are solved at once (multiple right-hand sides)
+  const size_t blockSize = 64;
+  const size_t numberOfPoles = starts.size();
+  const size_t numberOfBlocks = (numberOfPoles + blockSize - 1) / blockSize;
+
+#pragma omp parallel
+  {
+    std::vector<double> B(count * blockSize);
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t poleBegin = block * blockSize;
+      const size_t numberOfRHS = std::min(blockSize, numberOfPoles - poleBegin);
+
+      for (size_t r = 0; r < numberOfRHS; r++) {
+        const size_t start = starts[poleBegin + r];
+
+        for (size_t i = 0; i < count; i++) {
+          B[i * numberOfRHS + r] = values[start + i * step];
+        }
+      }
+
+      factorization.solve(B.data(), numberOfRHS);
+
+      for (size_t r = 0; r < numberOfRHS; r++) {
+        const size_t start = starts[poleBegin + r];
+
+        for (size_t i = 0; i < count; i++) {
+          values[start + i * step] = B[i * numberOfRHS + r];
+        }
+      }
+    }
+  }
+}
+
+const base::LUFactorization& OperationPoleHierarchisationGeneral::getFactorization(size_t count,
+    level_t level, bool hasBoundary) {
+  std::lock_guard<std::mutex> lock(mutex);
+  std::unique_ptr<base::LUFactorization>& factorization =
+      factorizations[std::make_tuple(count, level, hasBoundary)];
+
+  if (factorization == nullptr) {
+    sle.setDimension(count);
+    sle.setLevel(level);
+    sle.setHasBoundary(hasBoundary);
+    factorization.reset(new base::LUFactorization(sle));
+  }
+
+  return *factorization;
+}
+
+void OperationPoleHierarchisationGeneral::applyWithSLESolver(base::DataVector& values,
+    const std::vector<size_t>& starts, size_t step, size_t count, level_t level,
+    bool hasBoundary) {
+  std::lock_guard<std::mutex> lock(mutex);
+  base::DataVector rhs(count);
+  base::DataVector solution(count);
 
   sle.setDimension(count);
   sle.setLevel(level);
   sle.setHasBoundary(hasBoundary);
-  sleSolver.solve(sle, rhs, solution);
 
-  for (size_t i = 0; i < count; i++) {
-    values[start + i * step] = solution[i];
+  for (const size_t start : starts) {
+    for (size_t i = 0; i < count; i++) {
+      rhs[i] = values[start + i * step];
+    }
+
+    sleSolver.solve(sle, rhs, solution);
+
+    for (size_t i = 0; i < count; i++) {
+      values[start + i * step] = solution[i];
+    }
   }
 }
 
@@ -68,7 +168,7 @@ OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::~Hierarchisation
 double OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::getMatrixEntry(
     size_t i, size_t j) {
   level_t levelBasis = level;
-  index_t indexBasis = static_cast<index_t>(j);
+  index_t indexBasis = static_cast<index_t>(j + (hasBoundary_ ? 0 : 1));
 
   if (isBasisHierarchical_) {
     HeterogeneousBasis::hierarchizeLevelIndex(levelBasis, indexBasis);
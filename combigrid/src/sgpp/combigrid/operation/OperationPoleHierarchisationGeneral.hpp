@@ -8,12 +8,17 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+#include <sgpp/base/tools/sle/LUFactorization.hpp>
 #include <sgpp/base/tools/sle/solver/Auto.hpp>
 #include <sgpp/base/tools/sle/system/SLE.hpp>
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 #include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
 #include <sgpp/combigrid/operation/OperationPole.hpp>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 namespace sgpp {
@@ -76,6 +81,23 @@ class OperationPoleHierarchisationGeneral : public OperationPole {
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
 
+  /**
+   * Apply the operator on multiple poles of the same full grid. The linear system is factorized
+   * only once (see base::LUFactorization) and solved for blocks of poles at once, where the
+   * blocks are processed in parallel.
+   *
+   * @param[in,out] values    data vector for all full grid points
+   *                          (the order is given by IndexVectorRange)
+   * @param[in] starts        sequence numbers of the first grid points of the poles
+   * @param[in] step          difference of sequence numbers of two subsequent grid points of
+   *                          the poles
+   * @param[in] count         number of grid points of every pole
+   * @param[in] level         level of the full grid
+   * @param[in] hasBoundary   whether the full grid has points on the boundary
+   */
+  void applyMultiple(base::DataVector& values, const std::vector<size_t>& starts, size_t step,
+      size_t count, level_t level, bool hasBoundary = true) override;
+
  protected:
   /**
    * Class for the system of linear equations for hierarchising.
@@ -171,10 +193,38 @@ class OperationPoleHierarchisationGeneral : public OperationPole {
     bool hasBoundary_;
   };
 
+  /**
+   * Get the cached factorization for a specific pole, factorize it on the first call.
+   *
+   * @param count         number of grid points of the pole
+   * @param level         level of the full grid
+   * @param hasBoundary   whether the full grid has points on the boundary
+   * @return factorization
+   */
+  const base::LUFactorization& getFactorization(size_t count, level_t level, bool hasBoundary);
+
+  /**
+   * Solve the systems of the given poles with the SLE solver (used if the matrix is singular).
+   *
+   * @param[in,out] values    data vector for all full grid points
+   * @param[in] starts        sequence numbers of the first grid points of the poles
+   * @param[in] step          difference of sequence numbers of two subsequent grid points
+   * @param[in] count         number of grid points of every pole
+   * @param[in] level         level of the full grid
+   * @param[in] hasBoundary   whether the full grid has points on the boundary
+   */
+  void applyWithSLESolver(base::DataVector& values, const std::vector<size_t>& starts,
+      size_t step, size_t count, level_t level, bool hasBoundary);
+
   /// system of linear equations for the hierarchising
   HierarchisationGeneralSLE sle;
   /// solver for the system of linear equations
   base::sle_solver::Auto sleSolver;
+  /// cached factorizations, key is (count, level, hasBoundary)
+  std::map<std::tuple<size_t, level_t, bool>, std::unique_ptr<base::LUFactorization>>
+      factorizations;
+  /// mutex for factorizations and sle
+  std::mutex mutex;
 };
 
 }  // namespace combigrid
@@ -37,11 +37,16 @@ void OperationUPCombinationGrid::apply(std::vector<base::DataVector>& values) {
     return;
   }
 
-  OperationUPFullGrid operationUPFullGrid(fullGrids[0], operationPole);
+  // the full grids are independent of each other
+#pragma omp parallel
+  {
+    OperationUPFullGrid operationUPFullGrid(fullGrids[0], operationPole);
 
-  for (size_t i = 0; i < values.size(); i++) {
-    operationUPFullGrid.setGrid(fullGrids[i]);
-    operationUPFullGrid.apply(values[i]);
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < values.size(); i++) {
+      operationUPFullGrid.setGrid(fullGrids[i]);
+      operationUPFullGrid.apply(values[i]);
+    }
   }
 }
 
@@ -37,6 +37,7 @@ void OperationUPFullGrid::apply(base::DataVector& values) {
   LevelVector& levelProjection = gridProjection.getLevel();
   IndexVectorRange range(grid);
   IndexVector indexStart(dim);
+  std::vector<size_t> starts;
   size_t step = 1;
 
   for (size_t d = 0; d < dim; d++) {
@@ -54,6 +55,7 @@ void OperationUPFullGrid::apply(base::DataVector& values) {
     const index_t count = grid.getNumberOfIndexVectors(d);
     IndexVectorRange rangeProjection(gridProjection);
     indexStart[d] = grid.getMinIndex(d);
+    starts.clear();
 
     for (const IndexVector& indexProjection : rangeProjection) {
       for (size_t d2 = 0; d2 < dim; d2++) {
@@ -64,9 +66,12 @@ void OperationUPFullGrid::apply(base::DataVector& values) {
         }
       }
 
-      operationPole[d]->apply(values, range.find(indexStart), step, count, level[d], hasBoundary);
+      starts.push_back(range.find(indexStart));
     }
 
+    // all poles in dimension d are processed at once
+    operationPole[d]->applyMultiple(values, starts, step, count, level[d], hasBoundary);
+
     step *= count;
   }
 }
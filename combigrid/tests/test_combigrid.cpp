@@ -16,6 +16,7 @@
 #include <sgpp/combigrid/grid/FullGrid.hpp>
 #include <sgpp/combigrid/grid/IndexVectorRange.hpp>
 #include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
+#include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 #include <sgpp/combigrid/operation/OperationPole.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationGeneral.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationLinear.hpp>
@@ -27,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <numeric>
 #include <vector>
@@ -40,6 +42,7 @@ using sgpp::combigrid::IndexVector;
 using sgpp::combigrid::IndexVectorRange;
 using sgpp::combigrid::LevelVector;
 using sgpp::combigrid::OperationEvalCombinationGrid;
+using sgpp::combigrid::OperationEvalFullGrid;
 using sgpp::combigrid::OperationPole;
 using sgpp::combigrid::OperationPoleHierarchisationGeneral;
 using sgpp::combigrid::OperationPoleHierarchisationLinear;
@@ -505,3 +508,115 @@ BOOST_AUTO_TEST_CASE(testOperationUPCombinationGrid) {
     BOOST_CHECK_EQUAL(values[2][3], 0.5);
   }
 }
+
+BOOST_AUTO_TEST_CASE(testOperationUPCombinationGridGeneral) {
+  // hierarchical B-splines lead to dense, nodal B-splines to banded systems
+  for (bool isBasisHierarchical : {true, false}) {
+    for (bool hasBoundary : {true, false}) {
+      sgpp::base::SBsplineBase basis1d(3);
+      const HeterogeneousBasis basis(2, basis1d, isBasisHierarchical);
+      const CombinationGrid combinationGrid =
+          CombinationGrid::fromRegularSparse(2, 6, basis, hasBoundary);
+      const std::vector<FullGrid>& fullGrids = combinationGrid.getFullGrids();
+      std::vector<DataVector> values(fullGrids.size());
+      std::vector<DataMatrix> points(fullGrids.size());
+
+      for (size_t i = 0; i < fullGrids.size(); i++) {
+        IndexVectorRange::getPoints(fullGrids[i], points[i]);
+        values[i].resize(points[i].getNrows());
+
+        for (size_t k = 0; k < points[i].getNrows(); k++) {
+          values[i][k] = std::sin(3.0 * points[i](k, 0)) * std::exp(points[i](k, 1));
+        }
+      }
+
+      const std::vector<DataVector> originalValues = values;
+      std::vector<std::unique_ptr<OperationPole>> operationPole;
+      OperationPoleHierarchisationGeneral::fromHeterogenerousBasis(basis, operationPole);
+      OperationUPCombinationGrid operation(combinationGrid, operationPole);
+      operation.apply(values);
+
+      // the resulting coefficients must interpolate the values on every full grid
+      for (size_t i = 0; i < fullGrids.size(); i++) {
+        OperationEvalFullGrid operationEval(fullGrids[i]);
+        DataVector result;
+        operationEval.multiEval(values[i], points[i], result);
+
+        for (size_t k = 0; k < result.size(); k++) {
+          BOOST_CHECK_SMALL(result[k] - originalValues[i][k], 1e-10);
+        }
+      }
+
+      // single poles must give the same results as multiple poles at once
+      OperationPole& operationPole1d = *operationPole[0];
+      const FullGrid fullGrid({5}, basis, hasBoundary);
+      DataMatrix points1d;
+      IndexVectorRange::getPoints(fullGrid, points1d);
+      DataVector values1d(points1d.getNrows());
+
+      for (size_t k = 0; k < values1d.size(); k++) {
+        values1d[k] = std::cos(5.0 * points1d(k, 0));
+      }
+
+      DataVector valuesMultiple(2 * values1d.size());
+      valuesMultiple.setAll(0.0);
+
+      for (size_t k = 0; k < values1d.size(); k++) {
+        valuesMultiple[2 * k] = values1d[k];
+        valuesMultiple[2 * k + 1] = -values1d[k];
+      }
+
+      operationPole1d.apply(values1d, 5, hasBoundary);
+      operationPole1d.applyMultiple(valuesMultiple, {0, 1}, 2, values1d.size(), 5, hasBoundary);
+
+      for (size_t k = 0; k < values1d.size(); k++) {
+        BOOST_CHECK_CLOSE(valuesMultiple[2 * k], values1d[k], 1e-10);
+        BOOST_CHECK_CLOSE(valuesMultiple[2 * k + 1], -values1d[k], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationEvalFullGridSumFactorization) {
+  for (bool isBasisHierarchical : {true, false}) {
+    for (bool hasBoundary : {true, false}) {
+      sgpp::base::SBsplineBase basis1d(3);
+      const HeterogeneousBasis basis(3, basis1d, isBasisHierarchical);
+      const FullGrid fullGrid({3, 1, 2}, basis, hasBoundary);
+      const size_t numberOfGridPoints = fullGrid.getNumberOfIndexVectors();
+      DataVector surpluses(numberOfGridPoints);
+
+      for (size_t k = 0; k < numberOfGridPoints; k++) {
+        surpluses[k] = std::cos(static_cast<double>(k));
+      }
+
+      DataMatrix points(20, 3);
+
+      for (size_t j = 0; j < points.getNrows(); j++) {
+        for (size_t d = 0; d < 3; d++) {
+          points(j, d) = std::fmod(0.137 * static_cast<double>(j * (d + 2)) + 0.05, 1.0);
+        }
+      }
+
+      OperationEvalFullGrid operation(fullGrid);
+      DataVector result;
+      operation.multiEval(surpluses, points, result);
+      BOOST_CHECK_EQUAL(result.size(), points.getNrows());
+
+      for (size_t j = 0; j < points.getNrows(); j++) {
+        DataVector point(3);
+        points.getRow(j, point);
+        double expected = 0.0;
+        size_t k = 0;
+
+        for (const IndexVector& index : IndexVectorRange(fullGrid)) {
+          expected += surpluses[k] * basis.eval(fullGrid.getLevel(), index, point);
+          k++;
+        }
+
+        BOOST_CHECK_SMALL(result[j] - expected, 1e-12);
+        BOOST_CHECK_SMALL(operation.eval(surpluses, point) - expected, 1e-12);
+      }
+    }
+  }
+}
@@ -8,6 +8,15 @@
 %shared_ptr(sgpp::datadriven::DMSystemMatrix)
 %shared_ptr(sgpp::datadriven::DensitySystemMatrix)
 %shared_ptr(sgpp::datadriven::OperationRegularizationDiagonal)
+// offline objects are returned as std::shared_ptr<const ...> by DBMatObjectStore
+%shared_ptr(sgpp::datadriven::DBMatOffline)
+%shared_ptr(sgpp::datadriven::DBMatOfflineGE)
+%shared_ptr(sgpp::datadriven::DBMatOfflineChol)
+%shared_ptr(sgpp::datadriven::DBMatOfflineDenseIChol)
+%shared_ptr(sgpp::datadriven::DBMatOfflinePermutable)
+%shared_ptr(sgpp::datadriven::DBMatOfflineEigen)
+%shared_ptr(sgpp::datadriven::DBMatOfflineLU)
+%shared_ptr(sgpp::datadriven::DBMatOfflineOrthoAdapt)
 
 %{
 #include <sgpp/solver/TypesSolver.hpp>
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMappedFile.hpp>
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
@@ -16,7 +17,10 @@
 #include <sgpp/datadriven/datamining/configuration/MatrixDecompositionTypeParser.hpp>
 
 #include <algorithm>
+#include <iomanip>
+#include <limits>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -33,6 +37,17 @@ const std::string keyGridLevel = "level";
 const std::string keyRegularizationStrength = "lambda";
 const std::string keyDecompositionType = "decomposition";
 const std::string keyFilepath = "filepath";
+const std::string keyHash = "hash";
+
+namespace {
+
+std::string hashToString(uint64_t hash) {
+  std::ostringstream stream;
+  stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return stream.str();
+}
+
+}  // namespace
 
 DBMatDatabase::DBMatDatabase(const std::string& filepath) {
   databaseFilepath = filepath;
@@ -40,6 +55,15 @@ DBMatDatabase::DBMatDatabase(const std::string& filepath) {
   // Get the root node of the database (list)
   if (databaseRoot->contains("database")) {
     database = dynamic_cast<json::ListNode*>(&(*databaseRoot)["database"]);
+    // index the entries by their configuration hash
+    for (size_t i = 0; i < database->size(); i++) {
+      json::DictNode* entry = dynamic_cast<json::DictNode*>(&((*database)[i]));
+      if ((entry != nullptr) && entry->contains(keyHash)) {
+        hashIndex.emplace(std::stoull((*entry)[keyHash].get(), nullptr, 16), i);
+      } else {
+        entriesWithoutHash.push_back(i);
+      }
+    }
   } else {
     std::cout << "DBMatDatabase: json database is ill formated (does not contain key \"database\")!"
               << std::endl;
@@ -157,8 +181,12 @@ void DBMatDatabase::putDataMatrix(
     densityEstimationConfigEntry.addTextAttr(
         keyDecompositionType, sgpp::datadriven::MatrixDecompositionTypeParser::toString(
                                   densityEstimationConfig.decomposition_));
-    // Add the filepath
+    // Add the filepath and the hash of the configuration
     entry.addTextAttr(keyFilepath, filepath);
+    const uint64_t hash =
+        getConfigurationHash(gridConfig, regularizationConfig, densityEstimationConfig);
+    entry.addTextAttr(keyHash, hashToString(hash));
+    hashIndex.emplace(hash, database->size() - 1);
     // Serialize the entire database
     databaseRoot->serialize(databaseFilepath);
     std::cout << "Successfully added new matrix decomposition at \"" << filepath
@@ -312,6 +340,92 @@ bool DBMatDatabase::densityEstimationConfigurationMatches(
   return true;
 }
 
+std::string DBMatDatabase::getConfigurationDescription(
+    const sgpp::base::GeneralGridConfiguration& gridConfig,
+    const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  std::ostringstream stream;
+  stream.precision(std::numeric_limits<double>::max_digits10);
+  stream << keyGridType << "=" << GeneralGridTypeParser::toString(gridConfig.generalType_) << ";"
+         << keyGridDimension << "=" << gridConfig.dim_ << ";" << keyGridLevel << "=";
+  if (gridConfig.generalType_ == sgpp::base::GeneralGridType::ComponentGrid) {
+    for (size_t i = 0; i < gridConfig.levelVector_.size(); i++) {
+      stream << ((i > 0) ? "," : "") << gridConfig.levelVector_[i];
+    }
+  } else {
+    stream << gridConfig.level_;
+  }
+  stream << ";" << keyRegularizationStrength << "=" << regularizationConfig.lambda_ << ";"
+         << keyDecompositionType << "="
+         << MatrixDecompositionTypeParser::toString(densityEstimationConfig.decomposition_);
+  return stream.str();
+}
+
+uint64_t DBMatDatabase::getConfigurationHash(
+    const sgpp::base::GeneralGridConfiguration& gridConfig,
+    const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  const std::string description =
+      getConfigurationDescription(gridConfig, regularizationConfig, densityEstimationConfig);
+  return DBMatMappedFile::computeChecksum(description.data(), description.size());
+}
+
+bool DBMatDatabase::entryMatches(
+    size_t i, const sgpp::base::GeneralGridConfiguration& gridConfig,
+    const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+    bool findBaseConfig) {
+  json::DictNode* entry = dynamic_cast<json::DictNode*>(&((*database)[i]));
+  // Check if the entry matches the grid configuration
+  if (entry->contains(keyGridConfiguration)) {
+    json::DictNode* gridConfigNode =
+        dynamic_cast<json::DictNode*>(&(*entry)[keyGridConfiguration]);
+    if (findBaseConfig) {
+      if (!baseGridConfigurationMatches(gridConfigNode, gridConfig, i)) return false;
+    } else {
+      if (!gridConfigurationMatches(gridConfigNode, gridConfig, i)) return false;
+    }
+  } else {
+    std::cout << "DBMatDatabase: database entry # " << i << " does not contain a "
+              << "\"" << keyGridConfiguration << "\" key and therefore is ignored!" << std::endl;
+    return false;
+  }
+  // Check if the entry matches the regularization configuration
+  if (entry->contains(keyRegularizationConfiguration)) {
+    json::DictNode* regularizationConfigNode =
+        dynamic_cast<json::DictNode*>(&(*entry)[keyRegularizationConfiguration]);
+    if (!regularizationConfigurationMatches(regularizationConfigNode, regularizationConfig, i))
+      return false;
+  } else {
+    std::cout << "DBMatDatabase: database entry # " << i << " does not contain a "
+              << "\"" << keyRegularizationConfiguration << "\" key and therefore is ignored!"
+              << std::endl;
+    return false;
+  }
+  // Check if the entry matches the density estimation configuration
+  if (entry->contains(keyDensityEstimationConfiguration)) {
+    json::DictNode* densityEstimationConfiNode =
+        dynamic_cast<json::DictNode*>(&(*entry)[keyDensityEstimationConfiguration]);
+    if (!densityEstimationConfigurationMatches(densityEstimationConfiNode,
+                                               densityEstimationConfig, i))
+      return false;
+  } else {
+    std::cout << "DBMatDatabase: database entry # " << i << " does not contain a "
+              << "\"" << keyDensityEstimationConfiguration << "\" key and therefore is ignored!"
+              << std::endl;
+    return false;
+  }
+  // All three configurations match
+  if (entry->contains(keyFilepath)) {
+    return true;
+  } else {
+    std::cout << "DBMatDatabase: database entry # " << i << " matches but does not contain a "
+              << "\"" << keyFilepath << "\" key and therefore is ignored!" << std::endl;
+    return false;
+  }
+}
+
 int DBMatDatabase::entryIndexByConfiguration(
     const sgpp::base::GeneralGridConfiguration& gridConfig,
     const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
@@ -322,55 +436,36 @@ int DBMatDatabase::entryIndexByConfiguration(
     throw sgpp::base::algorithm_exception(
         "Base matrices can only be found for anisotrophic grids.");
   }
-  // Scan the entire database
-  for (size_t i = 0; i < database->size(); i++) {
-    json::DictNode* entry = dynamic_cast<json::DictNode*>(&((*database)[i]));
-    // Check if the entry matches the grid configuration
-    if (entry->contains(keyGridConfiguration)) {
-      json::DictNode* gridConfigNode =
-          dynamic_cast<json::DictNode*>(&(*entry)[keyGridConfiguration]);
-      if (findBaseConfig) {
-        if (!baseGridConfigurationMatches(gridConfigNode, gridConfig, i)) continue;
-      } else {
-        if (!gridConfigurationMatches(gridConfigNode, gridConfig, i)) continue;
-      }
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " does not contain a "
-                << "\"" << keyGridConfiguration << "\" key and therefore is ignored!" << std::endl;
-      continue;
-    }
-    // Check if the entry matches the regularization configuration
-    if (entry->contains(keyRegularizationConfiguration)) {
-      json::DictNode* regularizationConfigNode =
-          dynamic_cast<json::DictNode*>(&(*entry)[keyRegularizationConfiguration]);
-      if (!regularizationConfigurationMatches(regularizationConfigNode, regularizationConfig, i))
-        continue;
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " does not contain a "
-                << "\"" << keyRegularizationConfiguration << "\" key and therefore is ignored!"
-                << std::endl;
-      continue;
+
+  if (!findBaseConfig) {
+    // Look up the entries with the same hash (the configurations are compared to be safe against
+    // collisions), then the entries without hash
+    const uint64_t hash =
+        getConfigurationHash(gridConfig, regularizationConfig, densityEstimationConfig);
+    auto range = hashIndex.equal_range(hash);
+    std::vector<size_t> candidates;
+    for (auto it = range.first; it != range.second; ++it) {
+      candidates.push_back(it->second);
     }
-    // Check if the entry matches the density estimation configuration
-    if (entry->contains(keyDensityEstimationConfiguration)) {
-      json::DictNode* densityEstimationConfiNode =
-          dynamic_cast<json::DictNode*>(&(*entry)[keyDensityEstimationConfiguration]);
-      if (!densityEstimationConfigurationMatches(densityEstimationConfiNode,
-                                                 densityEstimationConfig, i))
-        continue;
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " does not contain a "
-                << "\"" << keyDensityEstimationConfiguration << "\" key and therefore is ignored!"
-                << std::endl;
-      continue;
+    std::sort(candidates.begin(), candidates.end());
+    candidates.insert(candidates.end(), entriesWithoutHash.begin(), entriesWithoutHash.end());
+
+    for (size_t i : candidates) {
+      if (entryMatches(i, gridConfig, adaptivityConfig, regularizationConfig,
+                       densityEstimationConfig, false)) {
+        std::cout << "config match" << std::endl;
+        return static_cast<int>(i);
+      }
     }
-    // All three configurations match -> return this entry
-    if (entry->contains(keyFilepath)) {
+    return -1;
+  }
+
+  // Scan the entire database
+  for (size_t i = 0; i < database->size(); i++) {
+    if (entryMatches(i, gridConfig, adaptivityConfig, regularizationConfig,
+                     densityEstimationConfig, true)) {
       std::cout << "config match" << std::endl;
-      return (static_cast<int>(i));
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " matches but does not contain a "
-                << "\"" << keyFilepath << "\" key and therefore is ignored!" << std::endl;
+      return static_cast<int>(i);
     }
   }
   return -1;
@@ -10,7 +10,11 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
+#include <stdint.h>
+
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -18,6 +22,9 @@ namespace datadriven {
 /**
  * A database class to store and retrieve online matrix decompositions for the sparse grid
  * density estimation. The class works on a json file.
+ * Entries carry a hash of their configuration (see getConfigurationHash), which is used to look
+ * them up without scanning the database. Entries without hash (written by older versions) are
+ * still found by comparing the configurations.
  */
 class DBMatDatabase {
  public:
@@ -111,6 +118,32 @@ class DBMatDatabase {
       const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       const std::string filepath, bool overwriteEntry = false);
 
+  /**
+   * Returns a text description of the part of a configuration that identifies a database entry
+   * (general grid type, dimension, level (vector), regularization strength and decomposition
+   * type). The description is also stored in the header of binary offline objects.
+   * @param gridConfig the grid configuration
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @return description of the configuration
+   */
+  static std::string getConfigurationDescription(
+      const sgpp::base::GeneralGridConfiguration& gridConfig,
+      const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
+  /**
+   * Returns the 64-bit hash of getConfigurationDescription().
+   * @param gridConfig the grid configuration
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @return hash of the configuration
+   */
+  static uint64_t getConfigurationHash(
+      const sgpp::base::GeneralGridConfiguration& gridConfig,
+      const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
  private:
   /**
    * Path to the json file containing the database
@@ -128,6 +161,34 @@ class DBMatDatabase {
    */
   std::unique_ptr<json::JSON> databaseRoot;
 
+  /**
+   * Index of the entries by the hash of their configuration
+   */
+  std::unordered_multimap<uint64_t, size_t> hashIndex;
+
+  /**
+   * Indices of the entries without configuration hash
+   */
+  std::vector<size_t> entriesWithoutHash;
+
+  /**
+   * Checks whether a database entry matches the configurations.
+   * @param entry_num the index of the entry
+   * @param gridConfig the grid configuration the matrix matches
+   * @param adaptivityConfig the adaptivity configuration the matrix matches
+   * @param regularizationConfig the regularization configuration the matrix matches
+   * @param densityEstimationConfig the density estimation configuration the matrix matches
+   * @param findBaseConfig Flag to specify whether it should be searched for a suitable base object
+   * for the permutation and blow-up approach
+   * @return whether the entry matches
+   */
+  bool entryMatches(
+      size_t entry_num, const sgpp::base::GeneralGridConfiguration& gridConfig,
+      const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+      const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+      bool findBaseConfig);
+
   /**
    * Scans the entire database and finds the first entry that matches the configurations. Returns
    * the index of the entry in the database ListNode or -1 if no entry matches.
@@ -0,0 +1,337 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatMappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::DataMatrix;
+using sgpp::base::file_exception;
+
+namespace {
+
+const char BINARY_MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'B', 'M', 'T'};
+const uint32_t BINARY_VERSION = 2;
+const uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+/// rounds up to the next multiple of 64 bytes (cache line and SIMD alignment of the matrices)
+inline uint64_t alignOffset(uint64_t offset) { return (offset + 63) & ~static_cast<uint64_t>(63); }
+
+/// pads the stream with zeros until position (relative to the beginning of the file)
+void writePadding(std::ostream& ostream, uint64_t& position, uint64_t targetPosition) {
+  const char zeros[64] = {0};
+  ostream.write(zeros, static_cast<std::streamsize>(targetPosition - position));
+  position = targetPosition;
+}
+
+}  // namespace
+
+uint64_t DBMatMappedFile::computeHeaderChecksum(const Header& fileHeader,
+                                                const char* configuration,
+                                                const SectionHeader* sectionHeaders) {
+  Header headerWithoutChecksum = fileHeader;
+  headerWithoutChecksum.checksum = 0;
+
+  uint64_t checksum = computeChecksum(&headerWithoutChecksum, sizeof(Header));
+  checksum = computeChecksum(configuration, fileHeader.configurationSize, checksum);
+  return computeChecksum(sectionHeaders, fileHeader.numberOfSections * sizeof(SectionHeader),
+                         checksum);
+}
+
+void DBMatMappedFile::write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                            uint64_t configurationHash, const std::string& configuration,
+                            const SectionList& sectionList) {
+  std::vector<SectionHeader> sectionHeaders(sectionList.size());
+  std::set<std::string> names;
+
+  Header fileHeader;
+  std::memset(&fileHeader, 0, sizeof(fileHeader));
+  std::memcpy(fileHeader.magic, BINARY_MAGIC, sizeof(fileHeader.magic));
+  fileHeader.version = BINARY_VERSION;
+  fileHeader.byteOrderMark = BYTE_ORDER_MARK;
+  fileHeader.decompositionType = static_cast<uint64_t>(decompositionType);
+  fileHeader.configurationHash = configurationHash;
+  fileHeader.configurationOffset = sizeof(Header);
+  fileHeader.configurationSize = configuration.size();
+  fileHeader.sectionTableOffset =
+      alignOffset(fileHeader.configurationOffset + fileHeader.configurationSize);
+  fileHeader.numberOfSections = sectionList.size();
+
+  uint64_t offset = alignOffset(fileHeader.sectionTableOffset +
+                                sectionList.size() * sizeof(SectionHeader));
+
+  for (size_t i = 0; i < sectionList.size(); i++) {
+    const std::string& name = sectionList[i].first;
+    const DataMatrix& matrix = *sectionList[i].second;
+
+    if ((name.size() >= sizeof(sectionHeaders[i].name)) || !names.insert(name).second) {
+      throw file_exception(("DBMatMappedFile::write: invalid section name " + name).c_str());
+    }
+
+    std::memset(&sectionHeaders[i], 0, sizeof(SectionHeader));
+    std::memcpy(sectionHeaders[i].name, name.data(), name.size());
+    sectionHeaders[i].rows = matrix.getNrows();
+    sectionHeaders[i].cols = matrix.getNcols();
+    sectionHeaders[i].offset = offset;
+    sectionHeaders[i].checksum =
+        computeChecksum(matrix.data(), matrix.getSize() * sizeof(double));
+    offset = alignOffset(offset + matrix.getSize() * sizeof(double));
+  }
+
+  fileHeader.fileSize = offset;
+  fileHeader.checksum =
+      computeHeaderChecksum(fileHeader, configuration.data(), sectionHeaders.data());
+
+  std::ofstream ostream(fileName, std::ios::binary | std::ios::trunc);
+
+  if (!ostream) {
+    throw file_exception(("DBMatMappedFile::write: could not open " + fileName).c_str());
+  }
+
+  uint64_t position = 0;
+  ostream.write(reinterpret_cast<const char*>(&fileHeader), sizeof(Header));
+  position += sizeof(Header);
+  ostream.write(configuration.data(), static_cast<std::streamsize>(configuration.size()));
+  position += configuration.size();
+
+  writePadding(ostream, position, fileHeader.sectionTableOffset);
+  ostream.write(reinterpret_cast<const char*>(sectionHeaders.data()),
+                static_cast<std::streamsize>(sectionHeaders.size() * sizeof(SectionHeader)));
+  position += sectionHeaders.size() * sizeof(SectionHeader);
+
+  for (size_t i = 0; i < sectionList.size(); i++) {
+    const DataMatrix& matrix = *sectionList[i].second;
+    writePadding(ostream, position, sectionHeaders[i].offset);
+    ostream.write(reinterpret_cast<const char*>(matrix.data()),
+                  static_cast<std::streamsize>(matrix.getSize() * sizeof(double)));
+    position += matrix.getSize() * sizeof(double);
+  }
+
+  writePadding(ostream, position, fileHeader.fileSize);
+
+  if (!ostream) {
+    throw file_exception(("DBMatMappedFile::write: could not write " + fileName).c_str());
+  }
+}
+
+bool DBMatMappedFile::isMappedFile(const std::string& fileName) {
+  std::ifstream istream(fileName, std::ios::binary);
+  char magic[sizeof(BINARY_MAGIC)];
+
+  return istream.read(magic, sizeof(magic)) &&
+         (std::memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0);
+}
+
+uint64_t DBMatMappedFile::computeChecksum(const void* data, size_t size, uint64_t seed) {
+  const uint64_t prime = 0x100000001b3ULL;
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  uint64_t result = seed;
+  size_t i = 0;
+
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(uint64_t));
+    result = (result ^ word) * prime;
+  }
+
+  for (; i < size; i++) {
+    result = (result ^ bytes[i]) * prime;
+  }
+
+  return result;
+}
+
+DBMatMappedFile::DBMatMappedFile(const std::string& fileName)
+    : data(nullptr),
+      dataSize(0),
+      isMapped(false),
+      buffer(),
+      header(nullptr),
+      sections(nullptr),
+      fileName(fileName) {
+#ifndef _WIN32
+  const int fd = open(fileName.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception(("DBMatMappedFile: could not open " + fileName).c_str());
+  }
+
+  struct stat fileStat;
+
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw file_exception(("DBMatMappedFile: could not stat " + fileName).c_str());
+  }
+
+  dataSize = static_cast<size_t>(fileStat.st_size);
+
+  if (dataSize > 0) {
+    void* mapped = mmap(nullptr, dataSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapped == MAP_FAILED) {
+      throw file_exception(("DBMatMappedFile: could not map " + fileName).c_str());
+    }
+
+    data = static_cast<const char*>(mapped);
+    isMapped = true;
+  } else {
+    close(fd);
+  }
+#else
+  std::ifstream file(fileName.c_str(), std::ios::binary);
+
+  if (!file) {
+    throw file_exception(("DBMatMappedFile: could not open " + fileName).c_str());
+  }
+
+  buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  data = buffer.data();
+  dataSize = buffer.size();
+#endif
+
+  try {
+    initialize();
+  } catch (...) {
+#ifndef _WIN32
+    if (isMapped) {
+      munmap(const_cast<char*>(data), dataSize);
+    }
+#endif
+    throw;
+  }
+}
+
+DBMatMappedFile::~DBMatMappedFile() {
+#ifndef _WIN32
+  if (isMapped) {
+    munmap(const_cast<char*>(data), dataSize);
+  }
+#endif
+}
+
+void DBMatMappedFile::initialize() {
+  if ((dataSize < sizeof(Header)) ||
+      (std::memcmp(data, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0)) {
+    throw file_exception(("DBMatMappedFile: " + fileName + " is not a binary offline object")
+                             .c_str());
+  }
+
+  header = reinterpret_cast<const Header*>(data);
+
+  if ((header->version != BINARY_VERSION) || (header->byteOrderMark != BYTE_ORDER_MARK)) {
+    throw file_exception(
+        ("DBMatMappedFile: unsupported version or byte order in " + fileName).c_str());
+  }
+
+  if ((header->fileSize > dataSize) || (header->configurationOffset > dataSize) ||
+      (header->configurationSize > dataSize - header->configurationOffset) ||
+      (header->sectionTableOffset > dataSize) ||
+      (header->sectionTableOffset % alignof(SectionHeader) != 0) ||
+      (header->numberOfSections > (dataSize - header->sectionTableOffset) / sizeof(SectionHeader))) {
+    throw file_exception(("DBMatMappedFile: " + fileName + " is truncated").c_str());
+  }
+
+  sections = reinterpret_cast<const SectionHeader*>(data + header->sectionTableOffset);
+
+  if (computeHeaderChecksum(*header, data + header->configurationOffset, sections) !=
+      header->checksum) {
+    throw file_exception(("DBMatMappedFile: checksum mismatch in header of " + fileName).c_str());
+  }
+
+  for (size_t i = 0; i < header->numberOfSections; i++) {
+    const SectionHeader& section = sections[i];
+
+    if ((section.name[sizeof(section.name) - 1] != '\0') || (section.offset > dataSize) ||
+        (section.offset % alignof(double) != 0) ||
+        ((section.cols > 0) && (section.rows > dataSize / sizeof(double) / section.cols)) ||
+        (section.rows * section.cols * sizeof(double) > dataSize - section.offset)) {
+      throw file_exception(("DBMatMappedFile: invalid section in " + fileName).c_str());
+    }
+  }
+}
+
+MatrixDecompositionType DBMatMappedFile::getDecompositionType() const {
+  return static_cast<MatrixDecompositionType>(header->decompositionType);
+}
+
+uint64_t DBMatMappedFile::getConfigurationHash() const { return header->configurationHash; }
+
+std::string DBMatMappedFile::getConfiguration() const {
+  return std::string(data + header->configurationOffset, header->configurationSize);
+}
+
+bool DBMatMappedFile::hasSection(const std::string& name) const {
+  for (size_t i = 0; i < header->numberOfSections; i++) {
+    if (name == sections[i].name) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+const DBMatMappedFile::SectionHeader& DBMatMappedFile::getSectionHeader(
+    const std::string& name) const {
+  for (size_t i = 0; i < header->numberOfSections; i++) {
+    if (name == sections[i].name) {
+      return sections[i];
+    }
+  }
+
+  throw file_exception(("DBMatMappedFile: " + fileName + " has no section " + name).c_str());
+}
+
+const double* DBMatMappedFile::getSectionData(const std::string& name) const {
+  return reinterpret_cast<const double*>(data + getSectionHeader(name).offset);
+}
+
+void DBMatMappedFile::copySection(const std::string& name, DataMatrix& matrix,
+                                  bool verify) const {
+  const SectionHeader& section = getSectionHeader(name);
+  const double* sectionData = reinterpret_cast<const double*>(data + section.offset);
+  const size_t size = section.rows * section.cols;
+
+  if (verify && (computeChecksum(sectionData, size * sizeof(double)) != section.checksum)) {
+    throw file_exception(
+        ("DBMatMappedFile: checksum mismatch in section " + name + " of " + fileName).c_str());
+  }
+
+  matrix.resize(section.rows, section.cols);
+  std::memcpy(matrix.data(), sectionData, size * sizeof(double));
+}
+
+bool DBMatMappedFile::verify() const {
+  for (size_t i = 0; i < header->numberOfSections; i++) {
+    const SectionHeader& section = sections[i];
+
+    if (computeChecksum(data + section.offset, section.rows * section.cols * sizeof(double)) !=
+        section.checksum) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,225 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Self-describing binary container for serialized offline objects (DBMatOffline), which is
+ * written by DBMatOffline::storeMapped.
+ *
+ * File layout (native byte order):
+ *   - header (DBMatMappedFile::Header)
+ *   - configuration: text description of the configuration the decomposition was computed for
+ *     (grid, regularization and density estimation configuration)
+ *   - section table: one DBMatMappedFile::SectionHeader per stored matrix
+ *   - matrix data of the sections (row-major doubles, each section aligned to 64 bytes)
+ *
+ * The file is mapped read-only into memory with mmap (on Windows, it is read into a buffer).
+ * Opening a file only validates the header and the section table, the pages of the matrices are
+ * read when they are accessed. The checksums of the sections are verified when a section is
+ * copied into a DataMatrix (or with verify()).
+ *
+ * The format is meant for fast loading: the offline objects copy the sections into their own
+ * matrices (the online objects update the decompositions in place), so the memory of loaded
+ * objects is not shared between processes. Only getSectionData() reads the mapping directly.
+ */
+class DBMatMappedFile {
+ public:
+  /// list of named matrices, which form the sections of a file
+  typedef std::vector<std::pair<std::string, const sgpp::base::DataMatrix*>> SectionList;
+
+  /**
+   * Header of the binary format.
+   */
+  struct Header {
+    /// magic bytes "SGPPDBMT"
+    char magic[8];
+    /// version of the format
+    uint32_t version;
+    /// byte order mark (0x01020304 in the byte order of the writing machine)
+    uint32_t byteOrderMark;
+    /// decomposition type (MatrixDecompositionType)
+    uint64_t decompositionType;
+    /// hash of the configuration (see DBMatDatabase::getConfigurationHash)
+    uint64_t configurationHash;
+    /// offset of the configuration description in bytes
+    uint64_t configurationOffset;
+    /// size of the configuration description in bytes
+    uint64_t configurationSize;
+    /// offset of the section table in bytes
+    uint64_t sectionTableOffset;
+    /// number of sections
+    uint64_t numberOfSections;
+    /// total size of the file in bytes
+    uint64_t fileSize;
+    /// checksum of the header (with this field set to zero), the configuration description
+    /// and the section table
+    uint64_t checksum;
+  };
+
+  /**
+   * Entry of the section table.
+   */
+  struct SectionHeader {
+    /// name of the section (zero-terminated)
+    char name[32];
+    /// number of rows of the matrix
+    uint64_t rows;
+    /// number of columns of the matrix
+    uint64_t cols;
+    /// offset of the matrix data in bytes
+    uint64_t offset;
+    /// checksum of the matrix data
+    uint64_t checksum;
+  };
+
+  /**
+   * Writes matrices in the binary format.
+   *
+   * @param fileName          path of the file
+   * @param decompositionType decomposition type of the offline object
+   * @param configurationHash hash of the configuration
+   * @param configuration     text description of the configuration
+   * @param sections          named matrices to store (names must be unique and shorter than 32
+   *                          characters)
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    uint64_t configurationHash, const std::string& configuration,
+                    const SectionList& sections);
+
+  /**
+   * Checks (by the magic bytes) whether a file is in the binary format.
+   *
+   * @param fileName  path of the file
+   * @return whether the file is in the binary format
+   */
+  static bool isMappedFile(const std::string& fileName);
+
+  /**
+   * Fast 64-bit checksum (FNV-1a applied to 64-bit words, remaining bytes are processed
+   * individually).
+   *
+   * @param data  pointer to the data
+   * @param size  size of the data in bytes
+   * @param seed  initial value (e.g., the checksum of preceding data)
+   * @return checksum
+   */
+  static uint64_t computeChecksum(const void* data, size_t size,
+                                  uint64_t seed = 0xcbf29ce484222325ULL);
+
+  /**
+   * Opens and maps a file in the binary format.
+   *
+   * @param fileName  path of the file
+   */
+  explicit DBMatMappedFile(const std::string& fileName);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~DBMatMappedFile();
+
+  DBMatMappedFile(const DBMatMappedFile&) = delete;
+  DBMatMappedFile& operator=(const DBMatMappedFile&) = delete;
+
+  /**
+   * @return decomposition type of the stored offline object
+   */
+  MatrixDecompositionType getDecompositionType() const;
+
+  /**
+   * @return hash of the configuration
+   */
+  uint64_t getConfigurationHash() const;
+
+  /**
+   * @return text description of the configuration
+   */
+  std::string getConfiguration() const;
+
+  /**
+   * @param name  name of the section
+   * @return whether the file contains the section
+   */
+  bool hasSection(const std::string& name) const;
+
+  /**
+   * @param name  name of the section
+   * @return header of the section (throws if there is no such section)
+   */
+  const SectionHeader& getSectionHeader(const std::string& name) const;
+
+  /**
+   * @param name  name of the section
+   * @return pointer to the (mapped) row-major data of the section, which is valid as long as
+   *         this object exists (the checksum is not verified)
+   */
+  const double* getSectionData(const std::string& name) const;
+
+  /**
+   * Copies a section into a matrix.
+   *
+   * @param name      name of the section
+   * @param[out] matrix  matrix (will be resized)
+   * @param verify    whether the checksum of the section should be verified
+   */
+  void copySection(const std::string& name, sgpp::base::DataMatrix& matrix,
+                   bool verify = true) const;
+
+  /**
+   * Verifies the checksums of all sections (reads the whole file).
+   *
+   * @return whether all checksums are correct
+   */
+  bool verify() const;
+
+ protected:
+  /// mapped file (or buffer on Windows)
+  const char* data;
+  /// size of the mapped file in bytes
+  size_t dataSize;
+  /// whether data has been mapped with mmap
+  bool isMapped;
+  /// buffer if the file could not be mapped
+  std::vector<char> buffer;
+  /// header of the file
+  const Header* header;
+  /// section table of the file
+  const SectionHeader* sections;
+  /// path of the file (for error messages)
+  std::string fileName;
+
+  /**
+   * Validates the header and the section table.
+   */
+  void initialize();
+
+  /**
+   * Computes the checksum stored in the header, which covers the fields of the header itself
+   * (except the checksum), the configuration description and the section table.
+   *
+   * @param fileHeader      header
+   * @param configuration   configuration description (of fileHeader.configurationSize bytes)
+   * @param sectionHeaders  section table (of fileHeader.numberOfSections entries)
+   * @return checksum
+   */
+  static uint64_t computeHeaderChecksum(const Header& fileHeader, const char* configuration,
+                                        const SectionHeader* sectionHeaders);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
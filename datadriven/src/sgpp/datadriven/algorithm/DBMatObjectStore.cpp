@@ -6,78 +6,240 @@
 #include <assert.h>
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMappedFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatObjectStore.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
 
+#include <cstdio>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
-DBMatObjectStore::DBMatObjectStore() : hasDatabase(false) {}
+DBMatObjectStore::DBMatObjectStore() : nextId(0), nextSpillId(0), memoryLimit(0) {}
 
 DBMatObjectStore::DBMatObjectStore(const std::string& filePath)
-    : dbFilePath(filePath), hasDatabase(true) {}
+    : nextId(0), nextSpillId(0), memoryLimit(0), database(new DBMatDatabase(filePath)) {}
 
-size_t DBMatObjectStore::getObjectContainerIndex(
+DBMatObjectStore::~DBMatObjectStore() {
+  for (const ObjectContainer& container : this->spilledObjects) {
+    std::remove(container.getSpillFile().c_str());
+  }
+}
+
+DBMatObjectStore::ContainerList::iterator DBMatObjectStore::findObjectContainer(
     const sgpp::base::GeneralGridConfiguration& gridConfig,
     const sgpp::datadriven::GeometryConfiguration& geometryConfig,
     const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
     const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
     bool searchBase) {
-  // Iterate over objects to find match
-  for (size_t i = 0; i < this->objects.size(); i++) {
-    // Check whether configuration of the container matches
-    if (this->objects[i].configMatches(gridConfig, geometryConfig, adaptivityConfig,
-                                       regularizationConfig, densityEstimationConfig, searchBase))
-      return i;
+  // Take the matching container that was stored first (in memory or spilled)
+  ContainerList::iterator result;
+  bool found = false;
+  auto update = [&](ContainerList::iterator container) {
+    if ((!found || (container->getId() < result->getId())) &&
+        container->configMatches(gridConfig, geometryConfig, adaptivityConfig,
+                                 regularizationConfig, densityEstimationConfig, searchBase)) {
+      result = container;
+      found = true;
+    }
+  };
+
+  if (!searchBase) {
+    // Only the containers with the same hash can match
+    auto range = this->objectIndex.equal_range(
+        getConfigurationHash(gridConfig, densityEstimationConfig));
+    for (auto it = range.first; it != range.second; ++it) {
+      update(it->second);
+    }
+  } else {
+    // Iterate over objects to find match
+    for (auto it = this->objects.begin(); it != this->objects.end(); ++it) {
+      update(it);
+    }
+    for (auto it = this->spilledObjects.begin(); it != this->spilledObjects.end(); ++it) {
+      update(it);
+    }
   }
-  // If no object matches, return SIZQE_MAX
-  return SIZE_MAX;
+
+  return found ? result : this->objects.end();
 }
 
-const DBMatObjectStore::ObjectContainer& DBMatObjectStore::getObjectContainer(size_t index) const {
-  return this->objects.at(index);
+std::shared_ptr<const DBMatOffline> DBMatObjectStore::acquireObject(
+    std::unique_lock<std::mutex>& lock, ContainerList::iterator container) {
+  std::vector<SpillJob> spillJobs;
+  std::shared_ptr<const DBMatOffline> object = container->getOfflineObject();
+
+  if (object != nullptr) {
+    if (!container->getSpillFile().empty()) {
+      // The object is still being written to disk, keep it in memory
+      container->cancelSpill();
+      this->statistics.memorySize += container->getMemorySize();
+      this->objects.splice(this->objects.begin(), this->spilledObjects, container);
+      this->evictObjects(spillJobs);
+    } else {
+      // Mark container as most recently used
+      this->objects.splice(this->objects.begin(), this->objects, container);
+    }
+    lock.unlock();
+    this->performSpills(spillJobs);
+    return object;
+  }
+
+  // Reload the spilled object (or wait for the thread that is already reloading it)
+  const size_t id = container->getId();
+  const std::string fileName = container->getSpillFile();
+  std::promise<std::shared_ptr<const DBMatOffline>> promise;
+  LoadFuture future;
+  const bool isLoader = this->startLoad(fileName, promise, future);
+  lock.unlock();
+
+  if (!isLoader) {
+    return future.get();
+  }
+
+  try {
+    object.reset(DBMatOfflineFactory::buildFromFile(fileName));
+  } catch (const std::exception&) {
+    // The container is dropped below if the file cannot be read anymore
+  }
+
+  lock.lock();
+  this->pendingLoads.erase(fileName);
+  container = this->findSpilledContainer(id, fileName);
+  if (container != this->spilledObjects.end()) {
+    if (object != nullptr) {
+      container->reload(object);
+      this->statistics.reloads++;
+      this->statistics.memorySize += container->getMemorySize();
+      this->objects.splice(this->objects.begin(), this->spilledObjects, container);
+      this->evictObjects(spillJobs);
+    } else {
+      this->removeFromIndex(container);
+      this->spilledObjects.erase(container);
+    }
+  }
+  lock.unlock();
+
+  std::remove(fileName.c_str());
+  promise.set_value(object);
+  this->performSpills(spillJobs);
+  return object;
 }
 
-const DBMatOffline* DBMatObjectStore::getObject(
+bool DBMatObjectStore::startLoad(const std::string& fileName,
+                                 std::promise<std::shared_ptr<const DBMatOffline>>& promise,
+                                 LoadFuture& future) {
+  auto pendingLoad = this->pendingLoads.find(fileName);
+  if (pendingLoad != this->pendingLoads.end()) {
+    future = pendingLoad->second;
+    return false;
+  }
+  future = promise.get_future().share();
+  this->pendingLoads.emplace(fileName, future);
+  return true;
+}
+
+std::shared_ptr<const DBMatOffline> DBMatObjectStore::getObject(
     const sgpp::base::GeneralGridConfiguration& gridConfig,
     const sgpp::datadriven::GeometryConfiguration& geometryConfig,
     const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
     const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  std::unique_lock<std::mutex> lock(this->mutex);
   // Search for suitable offline object
-  size_t index = this->getObjectContainerIndex(gridConfig, geometryConfig, adaptivityConfig,
-                                            regularizationConfig, densityEstimationConfig);
-  // If no suitable object is found, return nullptr
-  if (index == SIZE_MAX) {
+  ContainerList::iterator container =
+      this->findObjectContainer(gridConfig, geometryConfig, adaptivityConfig,
+                                regularizationConfig, densityEstimationConfig);
+  if (container != this->objects.end()) {
+    std::shared_ptr<const DBMatOffline> object = this->acquireObject(lock, container);
+    lock.lock();
+    if (object != nullptr) {
+      this->statistics.hits++;
+      return object;
+    }
+  }
+  this->statistics.misses++;
+  // If no suitable object is found, try to load it from the database
+  if ((this->database == nullptr) ||
+      !this->database->hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                     densityEstimationConfig)) {
+    // If no suitable object is found, return nullptr
     return nullptr;
-  } else {  // If suitable object is found, return pointer to the object
-    return &this->getObjectContainer(index).getOfflineObject();
   }
+
+  // Load the object once, concurrent requests for the same file wait for the load
+  const std::string fileName = this->database->getDataMatrix(
+      gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig);
+  std::promise<std::shared_ptr<const DBMatOffline>> promise;
+  LoadFuture future;
+  const bool isLoader = this->startLoad(fileName, promise, future);
+  lock.unlock();
+
+  if (!isLoader) {
+    return future.get();
+  }
+
+  std::shared_ptr<const DBMatOffline> object;
+  try {
+    object.reset(DBMatOfflineFactory::buildFromFile(fileName));
+  } catch (...) {
+    lock.lock();
+    this->pendingLoads.erase(fileName);
+    lock.unlock();
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+
+  std::vector<SpillJob> spillJobs;
+  lock.lock();
+  this->pendingLoads.erase(fileName);
+  this->statistics.databaseLoads++;
+  this->insertObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+                     densityEstimationConfig, object, spillJobs);
+  lock.unlock();
+
+  promise.set_value(object);
+  this->performSpills(spillJobs);
+  return object;
 }
 
-const DBMatOfflinePermutable* DBMatObjectStore::getBaseObject(
+std::shared_ptr<const DBMatOfflinePermutable> DBMatObjectStore::getBaseObject(
     const sgpp::base::GeneralGridConfiguration& gridConfig,
     const sgpp::datadriven::GeometryConfiguration& geometryConfig,
     const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
     const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
     sgpp::base::GeneralGridConfiguration& baseGridConfig) {
+  std::unique_lock<std::mutex> lock(this->mutex);
   // Search for suitable base offline object
-  size_t index = this->getObjectContainerIndex(gridConfig, geometryConfig, adaptivityConfig,
-                                            regularizationConfig, densityEstimationConfig, true);
-  // If no suitable base object is found, return nullptr
-  if (index == SIZE_MAX) {
-    return nullptr;
-  } else {  // If suitable base object is found, return pointer to the object and base config
-    const DBMatObjectStore::ObjectContainer& result = this->getObjectContainer(index);
-    baseGridConfig = result.getGridConfig();
-    return dynamic_cast<const DBMatOfflinePermutable*>(&result.getOfflineObject());
+  ContainerList::iterator container =
+      this->findObjectContainer(gridConfig, geometryConfig, adaptivityConfig,
+                                regularizationConfig, densityEstimationConfig, true);
+  if (container != this->objects.end()) {
+    const sgpp::base::GeneralGridConfiguration containerGridConfig = container->getGridConfig();
+    std::shared_ptr<const DBMatOffline> object = this->acquireObject(lock, container);
+    lock.lock();
+    // If suitable base object is found, return pointer to the object and base config
+    if (object != nullptr) {
+      this->statistics.hits++;
+      baseGridConfig = containerGridConfig;
+      return std::dynamic_pointer_cast<const DBMatOfflinePermutable>(object);
+    }
   }
+  // If no suitable base object is found, return nullptr
+  this->statistics.misses++;
+  return nullptr;
 }
 
 void DBMatObjectStore::putObject(
@@ -87,10 +249,163 @@ void DBMatObjectStore::putObject(
     const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
     const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
     const DBMatOffline* object) {
-  // Add a new object container to stored containers
-  this->objects.push_back(ObjectContainer{gridConfig, geometryConfig, adaptivityConfig,
-                                          regularizationConfig, densityEstimationConfig,
-                                          std::unique_ptr<const DBMatOffline>(object)});
+  this->putObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+                  densityEstimationConfig, std::shared_ptr<const DBMatOffline>(object));
+}
+
+void DBMatObjectStore::putObject(
+    const sgpp::base::GeneralGridConfiguration& gridConfig,
+    const sgpp::datadriven::GeometryConfiguration& geometryConfig,
+    const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+    std::shared_ptr<const DBMatOffline> object) {
+  std::vector<SpillJob> spillJobs;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->insertObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+                       densityEstimationConfig, std::move(object), spillJobs);
+  }
+  this->performSpills(spillJobs);
+}
+
+void DBMatObjectStore::insertObject(
+    const sgpp::base::GeneralGridConfiguration& gridConfig,
+    const sgpp::datadriven::GeometryConfiguration& geometryConfig,
+    const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+    std::shared_ptr<const DBMatOffline> object, std::vector<SpillJob>& spillJobs) {
+  // Add a new object container in front of the stored containers
+  this->objects.emplace_front(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+                              densityEstimationConfig, std::move(object), this->nextId++);
+  this->objectIndex.emplace(getConfigurationHash(gridConfig, densityEstimationConfig),
+                            this->objects.begin());
+  this->statistics.memorySize += this->objects.front().getMemorySize();
+  this->evictObjects(spillJobs);
+}
+
+void DBMatObjectStore::evictObjects(std::vector<SpillJob>& spillJobs) {
+  if (this->memoryLimit == 0) {
+    return;
+  }
+
+  while ((this->statistics.memorySize > this->memoryLimit) && (this->objects.size() > 1)) {
+    ContainerList::iterator container = std::prev(this->objects.end());
+    this->statistics.memorySize -= container->getMemorySize();
+    this->statistics.evictions++;
+
+    if (this->spillDirectory.empty()) {
+      this->removeFromIndex(container);
+      this->objects.erase(container);
+      continue;
+    }
+
+    // The file is written by the caller after releasing the lock
+    std::ostringstream fileName;
+    fileName << this->spillDirectory << "/DBMatObjectStore_" << static_cast<const void*>(this)
+             << "_" << this->nextSpillId++ << ".bin";
+    container->startSpill(fileName.str());
+    spillJobs.push_back(
+        SpillJob{container->getId(), fileName.str(), container->getOfflineObject()});
+    this->spilledObjects.splice(this->spilledObjects.end(), this->objects, container);
+  }
+}
+
+void DBMatObjectStore::performSpills(std::vector<SpillJob>& spillJobs) {
+  for (SpillJob& spillJob : spillJobs) {
+    bool written = true;
+    try {
+      spillJob.object->storeMapped(spillJob.fileName);
+    } catch (const std::exception&) {
+      written = false;
+    }
+    spillJob.object.reset();
+
+    bool keepFile = false;
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      ContainerList::iterator container = this->findSpilledContainer(spillJob.id,
+                                                                     spillJob.fileName);
+      // The spill has been canceled if the object was requested in the meantime
+      if (container != this->spilledObjects.end()) {
+        if (written) {
+          container->finishSpill();
+          this->statistics.spills++;
+          keepFile = true;
+        } else {
+          // Objects that cannot be serialized are discarded
+          this->removeFromIndex(container);
+          this->spilledObjects.erase(container);
+        }
+      }
+    }
+
+    if (!keepFile) {
+      std::remove(spillJob.fileName.c_str());
+    }
+  }
+}
+
+DBMatObjectStore::ContainerList::iterator DBMatObjectStore::findSpilledContainer(
+    size_t id, const std::string& fileName) {
+  for (auto it = this->spilledObjects.begin(); it != this->spilledObjects.end(); ++it) {
+    if ((it->getId() == id) && (it->getSpillFile() == fileName)) {
+      return it;
+    }
+  }
+  return this->spilledObjects.end();
+}
+
+void DBMatObjectStore::removeFromIndex(ContainerList::iterator container) {
+  auto range = this->objectIndex.equal_range(
+      getConfigurationHash(container->getGridConfig(), container->getDensityEstimationConfig()));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == container) {
+      this->objectIndex.erase(it);
+      return;
+    }
+  }
+}
+
+void DBMatObjectStore::setMemoryLimit(size_t memoryLimit) {
+  std::vector<SpillJob> spillJobs;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->memoryLimit = memoryLimit;
+    this->evictObjects(spillJobs);
+  }
+  this->performSpills(spillJobs);
+}
+
+size_t DBMatObjectStore::getMemoryLimit() const {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->memoryLimit;
+}
+
+void DBMatObjectStore::setSpillDirectory(const std::string& spillDirectory) {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->spillDirectory = spillDirectory;
+}
+
+DBMatObjectStore::Statistics DBMatObjectStore::getStatistics() const {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  Statistics result = this->statistics;
+  result.numberOfObjects = this->objects.size();
+  result.numberOfSpilledObjects = this->spilledObjects.size();
+  return result;
+}
+
+uint64_t DBMatObjectStore::getConfigurationHash(
+    const sgpp::base::GeneralGridConfiguration& gridConfig,
+    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  std::vector<uint64_t> key{static_cast<uint64_t>(gridConfig.type_),
+                            static_cast<uint64_t>(gridConfig.dim_),
+                            static_cast<uint64_t>(gridConfig.level_),
+                            static_cast<uint64_t>(gridConfig.boundaryLevel_),
+                            static_cast<uint64_t>(densityEstimationConfig.decomposition_)};
+  key.insert(key.end(), gridConfig.levelVector_.begin(), gridConfig.levelVector_.end());
+  return DBMatMappedFile::computeChecksum(key.data(), key.size() * sizeof(uint64_t));
 }
 
 DBMatObjectStore::ObjectContainer::ObjectContainer(
@@ -99,17 +414,20 @@ DBMatObjectStore::ObjectContainer::ObjectContainer(
     const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
     const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
-    std::unique_ptr<const DBMatOffline> offlineObject)
+    std::shared_ptr<const DBMatOffline> offlineObject, size_t id)
     : gridConfig(gridConfig),
       geometryConfig(geometryConfig),
       adaptivityConfig(adaptivityConfig),
       regularizationConfig(regularizationConfig),
       densityEstimationConfig(densityEstimationConfig),
-      // Transfers ownership to container
-      offlineObject(std::move(offlineObject)) {}
+      // Shares ownership with container
+      offlineObject(std::move(offlineObject)),
+      id(id),
+      memorySize(this->offlineObject->getMemorySize()) {}
 
-const DBMatOffline& DBMatObjectStore::ObjectContainer::getOfflineObject() const {
-  return *(this->offlineObject);
+const std::shared_ptr<const DBMatOffline>& DBMatObjectStore::ObjectContainer::getOfflineObject()
+    const {
+  return this->offlineObject;
 }
 
 const sgpp::base::GeneralGridConfiguration& DBMatObjectStore::ObjectContainer::getGridConfig()
@@ -117,6 +435,33 @@ const sgpp::base::GeneralGridConfiguration& DBMatObjectStore::ObjectContainer::g
   return this->gridConfig;
 }
 
+const sgpp::datadriven::DensityEstimationConfiguration&
+DBMatObjectStore::ObjectContainer::getDensityEstimationConfig() const {
+  return this->densityEstimationConfig;
+}
+
+size_t DBMatObjectStore::ObjectContainer::getId() const { return this->id; }
+
+size_t DBMatObjectStore::ObjectContainer::getMemorySize() const { return this->memorySize; }
+
+void DBMatObjectStore::ObjectContainer::startSpill(const std::string& fileName) {
+  this->spillFile = fileName;
+}
+
+void DBMatObjectStore::ObjectContainer::finishSpill() { this->offlineObject.reset(); }
+
+void DBMatObjectStore::ObjectContainer::cancelSpill() { this->spillFile.clear(); }
+
+void DBMatObjectStore::ObjectContainer::reload(std::shared_ptr<const DBMatOffline> offlineObject) {
+  this->offlineObject = std::move(offlineObject);
+  this->spillFile.clear();
+  this->memorySize = this->offlineObject->getMemorySize();
+}
+
+const std::string& DBMatObjectStore::ObjectContainer::getSpillFile() const {
+  return this->spillFile;
+}
+
 bool DBMatObjectStore::ObjectContainer::configMatches(
     const sgpp::base::GeneralGridConfiguration& gridConfig,
     const sgpp::datadriven::GeometryConfiguration& geometryConfig,
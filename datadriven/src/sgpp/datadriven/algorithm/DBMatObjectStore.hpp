@@ -11,14 +11,57 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflinePermutable.hpp>
 #include <sgpp/datadriven/configuration/GeometryConfiguration.hpp>
 
+#include <stdint.h>
+
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
+/**
+ * @brief Thread-safe cache of offline objects (DBMatOffline), which are identified by their
+ * configuration. The objects are evicted in least recently used order if the memory occupied by
+ * the stored objects exceeds a given limit. Evicted objects are either discarded or, if a spill
+ * directory is set, written to disk in the binary format of DBMatMappedFile and reloaded when
+ * they are requested again.
+ *
+ * The objects are handed out as shared pointers, i.e. an object that is used by a caller remains
+ * valid even if it is evicted concurrently. Objects are loaded (from the database or the spill
+ * directory) and spilled without holding the lock of the store. Concurrent requests for an object
+ * that is being loaded wait for this load instead of loading the object again.
+ */
 class DBMatObjectStore {
  public:
+  /**
+   * @brief Statistics of the object store.
+   */
+  struct Statistics {
+    // Number of requests that were answered from the store (including reloaded objects)
+    size_t hits = 0;
+    // Number of requests without a suitable object in the store
+    size_t misses = 0;
+    // Number of objects that were evicted from memory
+    size_t evictions = 0;
+    // Number of evicted objects that were written to the spill directory
+    size_t spills = 0;
+    // Number of spilled objects that were reloaded
+    size_t reloads = 0;
+    // Number of objects that were loaded from the database
+    size_t databaseLoads = 0;
+    // Memory occupied by the objects in memory in bytes (see DBMatOffline::getMemorySize)
+    size_t memorySize = 0;
+    // Number of objects in memory
+    size_t numberOfObjects = 0;
+    // Number of spilled objects
+    size_t numberOfSpilledObjects = 0;
+  };
+
   /**
    * @brief Default constructor.
    *
@@ -26,14 +69,26 @@ class DBMatObjectStore {
   DBMatObjectStore();
 
   /**
-   * @brief Constructor with path to database file.
+   * @brief Constructor with path to database file. Objects that are not in the store are loaded
+   * from the database (DBMatDatabase) when they are requested with getObject(). The database is
+   * parsed once in the constructor, i.e. entries that are added to the file later are not found.
    *
    * @param fileName
    */
   explicit DBMatObjectStore(const std::string& fileName);
 
+  /**
+   * @brief Destructor, removes the spilled files.
+   *
+   */
+  ~DBMatObjectStore();
+
+  DBMatObjectStore(const DBMatObjectStore&) = delete;
+  DBMatObjectStore& operator=(const DBMatObjectStore&) = delete;
+
   /**
    * @brief Stores a given offline object together with its configuration in the object store.
+   * The store takes ownership of the object.
    *
    * @param gridConfig Grid configuration
    * @param geometryConfig Geometry configuration for geometry aware sparse grids
@@ -48,6 +103,25 @@ class DBMatObjectStore {
                  const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
                  const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
                  const DBMatOffline* object);
+
+  /**
+   * @brief Stores a given offline object together with its configuration in the object store.
+   * The ownership of the object is shared with the store.
+   *
+   * @param gridConfig Grid configuration
+   * @param geometryConfig Geometry configuration for geometry aware sparse grids
+   * @param adaptivityConfig Adaptivity configuration
+   * @param regularizationConfig Regularization configuration
+   * @param densityEstimationConfig Density estimation configuration
+   * @param object The object to be stored
+   */
+  void putObject(const sgpp::base::GeneralGridConfiguration& gridConfig,
+                 const sgpp::datadriven::GeometryConfiguration& geometryConfig,
+                 const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+                 const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+                 const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+                 std::shared_ptr<const DBMatOffline> object);
+
   /**
    * @brief Returns a suitable base object for the permutation and blow-up approach.
    * The grid configuration of the stored base object is returned in baseGridConfig.
@@ -60,9 +134,9 @@ class DBMatObjectStore {
    * @param densityEstimationConfig Density estimation configuration
    * @param baseGridConfig Reference to a grid configuration. Gets overridden by the grid
    * configuration of the returned base object
-   * @return const DBMatOfflinePermutable*
+   * @return std::shared_ptr<const DBMatOfflinePermutable>
    */
-  const DBMatOfflinePermutable* getBaseObject(
+  std::shared_ptr<const DBMatOfflinePermutable> getBaseObject(
       const sgpp::base::GeneralGridConfiguration& gridConfig,
       const sgpp::datadriven::GeometryConfiguration& geometryConfig,
       const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
@@ -72,22 +146,55 @@ class DBMatObjectStore {
 
   /**
    * @brief Returns an identical offline object to the specified configuration.
-   * If no such object exits, a nullptr is returned
+   * If no such object exits, it is loaded from the database (if the store has one and the
+   * database contains a matching entry). Otherwise, a nullptr is returned. If the object cannot
+   * be built from the file of the database entry, the exception is passed on to the caller (and
+   * to all callers that waited for the same load).
    *
    * @param gridConfig Grid configuration
    * @param geometryConfig Geometry configuration for geometry aware sparse grids
    * @param adaptivityConfig Adaptivity configuration
    * @param regularizationConfig Regularization configuration
    * @param densityEstimationConfig Density estimation configuration
-   * @return const DBMatOffline*
+   * @return std::shared_ptr<const DBMatOffline>
    */
-  const DBMatOffline* getObject(
+  std::shared_ptr<const DBMatOffline> getObject(
       const sgpp::base::GeneralGridConfiguration& gridConfig,
       const sgpp::datadriven::GeometryConfiguration& geometryConfig,
       const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
       const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
       const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
+  /**
+   * @brief Sets the maximal memory of the objects in memory. If the limit is exceeded, the least
+   * recently used objects are evicted (the most recently stored object is always kept).
+   *
+   * @param memoryLimit Limit in bytes (0 means no limit, which is the default)
+   */
+  void setMemoryLimit(size_t memoryLimit);
+
+  /**
+   * @brief Returns the maximal memory of the objects in memory.
+   *
+   * @return size_t Limit in bytes (0 means no limit)
+   */
+  size_t getMemoryLimit() const;
+
+  /**
+   * @brief Sets the directory evicted objects are written to. If the directory is empty (the
+   * default), evicted objects are discarded.
+   *
+   * @param spillDirectory Path of an existing directory
+   */
+  void setSpillDirectory(const std::string& spillDirectory);
+
+  /**
+   * @brief Returns the statistics of the object store.
+   *
+   * @return Statistics
+   */
+  Statistics getStatistics() const;
+
  protected:
   /**
    * @brief Datastructure to store offline objects together with their configuration.
@@ -97,16 +204,16 @@ class DBMatObjectStore {
    public:
     /**
      * @brief Public constructor. Gets initialized with the offline object and the correspoding
-     * configuration. Note that ownership of the given offline object get transfered to the
-     * container. I.e. if the container is deleted, its offline object is deleted as well.
+     * configuration. Note that the ownership of the given offline object is shared with the
+     * container.
      *
      * @param gridConfig Grid configuration
      * @param geometryConfig Geometry configuration for geometry aware sparse grids
      * @param adaptivityConfig Adaptivity configuration
      * @param regularizationConfig Regularization configuration
      * @param densityEstimationConfig Density estimation configuration
-     * @param offlineObject Unique pointer to an offline object. Ownership of this object gets
-     * transfered to the container
+     * @param offlineObject Shared pointer to an offline object
+     * @param id Sequence number of the container (determines the order of the search results)
      */
     explicit ObjectContainer(
         const sgpp::base::GeneralGridConfiguration& gridConfig,
@@ -114,14 +221,14 @@ class DBMatObjectStore {
         const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
         const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
         const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
-        std::unique_ptr<const DBMatOffline> offlineObject);
+        std::shared_ptr<const DBMatOffline> offlineObject, size_t id);
 
     /**
-     * @brief Returns a read-only reference to the containers offline object.
+     * @brief Returns the containers offline object (nullptr if the object has been spilled).
      *
-     * @return const DBMatOffline&
+     * @return const std::shared_ptr<const DBMatOffline>&
      */
-    const DBMatOffline& getOfflineObject() const;
+    const std::shared_ptr<const DBMatOffline>& getOfflineObject() const;
 
     /**
      * @brief Returns a read-only reference to the containers grid configuration.
@@ -130,6 +237,63 @@ class DBMatObjectStore {
      */
     const sgpp::base::GeneralGridConfiguration& getGridConfig() const;
 
+    /**
+     * @brief Returns a read-only reference to the containers density estimation configuration.
+     *
+     * @return const sgpp::datadriven::DensityEstimationConfiguration&
+     */
+    const sgpp::datadriven::DensityEstimationConfiguration& getDensityEstimationConfig() const;
+
+    /**
+     * @brief Returns the sequence number of the container.
+     *
+     * @return size_t
+     */
+    size_t getId() const;
+
+    /**
+     * @brief Returns the memory size of the offline object when it was stored.
+     *
+     * @return size_t
+     */
+    size_t getMemorySize() const;
+
+    /**
+     * @brief Marks the container as being spilled to a file. The offline object is kept until
+     * finishSpill() is called, i.e. until the file has been written.
+     *
+     * @param fileName Path of the file
+     */
+    void startSpill(const std::string& fileName);
+
+    /**
+     * @brief Releases the offline object after it has been written to the spill file.
+     *
+     */
+    void finishSpill();
+
+    /**
+     * @brief Cancels a spill that has not been finished, i.e. the offline object stays in
+     * memory (the file is removed by the thread writing it).
+     *
+     */
+    void cancelSpill();
+
+    /**
+     * @brief Replaces the released offline object by the object reloaded from the spill file.
+     *
+     * @param offlineObject Reloaded offline object
+     */
+    void reload(std::shared_ptr<const DBMatOffline> offlineObject);
+
+    /**
+     * @brief Returns the path of the file the object is spilled to (empty if the object has not
+     * been spilled).
+     *
+     * @return const std::string&
+     */
+    const std::string& getSpillFile() const;
+
     /**
      * @brief Checks wheter the configuration of a container matches a given configuration.
      * If searcBase = true, it is checked wheter the offline object is a suitable base object for
@@ -160,19 +324,57 @@ class DBMatObjectStore {
     sgpp::base::AdaptivityConfiguration adaptivityConfig;
     RegularizationConfiguration regularizationConfig;
     DensityEstimationConfiguration densityEstimationConfig;
-    std::unique_ptr<const DBMatOffline> offlineObject;
+    std::shared_ptr<const DBMatOffline> offlineObject;
+    size_t id;
+    size_t memorySize;
+    std::string spillFile;
   };
-  // Vector with stored object containers.
-  std::vector<ObjectContainer> objects;
-  // Optional path to a database file
-  std::string dbFilePath;
-  // True if database file is given
-  bool hasDatabase;
+
+  typedef std::list<ObjectContainer> ContainerList;
+
+  /**
+   * @brief Offline object of an evicted container that has to be written to the spill directory
+   * (after the lock of the store has been released).
+   */
+  struct SpillJob {
+    // Sequence number of the container
+    size_t id;
+    // Path of the spill file
+    std::string fileName;
+    // The object to write
+    std::shared_ptr<const DBMatOffline> object;
+  };
+
+  typedef std::shared_future<std::shared_ptr<const DBMatOffline>> LoadFuture;
+
+  // Object containers in memory, the most recently used container first
+  ContainerList objects;
+  // Object containers whose offline objects have been spilled to disk
+  ContainerList spilledObjects;
+  // Containers (in memory or spilled) by the hash of their configuration (see
+  // getConfigurationHash)
+  std::unordered_multimap<uint64_t, ContainerList::iterator> objectIndex;
+  // Loads in progress (from the database or the spill directory) by the path of the file
+  std::unordered_map<std::string, LoadFuture> pendingLoads;
+  // Sequence number of the next container
+  size_t nextId;
+  // Sequence number of the next spill file
+  size_t nextSpillId;
+  // Maximal memory of the objects in memory in bytes (0 means no limit)
+  size_t memoryLimit;
+  // Directory to spill evicted objects to (empty if evicted objects are discarded)
+  std::string spillDirectory;
+  // Statistics of the store
+  Statistics statistics;
+  // Guards all members of the store
+  mutable std::mutex mutex;
+  // Optional database (parsed once on construction, read-only afterwards)
+  std::unique_ptr<DBMatDatabase> database;
 
   /**
-   * @brief Returns the index to a suitable offline object.
-   * If searchBase = true, a suitable base object for the permutation and blow-up approach is
-   * searched for. If no suitable object exists, SIZE_MAX is returned.
+   * @brief Returns a suitable object container (in memory or spilled). If searchBase = true, a
+   * suitable base object for the permutation and blow-up approach is searched for. If no suitable
+   * object exists, objects.end() is returned. The mutex has to be locked by the caller.
    *
    * @param gridConfig Grid configuration
    * @param geometryConfig Geometry configuration for geometry aware sparse grids
@@ -181,9 +383,9 @@ class DBMatObjectStore {
    * @param densityEstimationConfig Density estimation configuration
    * @param searchBase Flag to specify whether an identical offline object or a suitable base object
    * is to be searched
-   * @return int
+   * @return ContainerList::iterator
    */
-  size_t getObjectContainerIndex(
+  ContainerList::iterator findObjectContainer(
       const sgpp::base::GeneralGridConfiguration& gridConfig,
       const sgpp::datadriven::GeometryConfiguration& geometryConfig,
       const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
@@ -192,12 +394,97 @@ class DBMatObjectStore {
       bool searchBase = false);
 
   /**
-   * @brief Returns the object container for the given index.
+   * @brief Returns the offline object of a container found by findObjectContainer() and moves the
+   * container to the front of the containers in memory. A spilled object is reloaded from its file
+   * after the lock has been released. The lock is released when the function returns.
+   *
+   * @param lock Lock of the mutex (has to be locked)
+   * @param container Iterator to the container
+   * @return std::shared_ptr<const DBMatOffline> (nullptr if the spill file cannot be read)
+   */
+  std::shared_ptr<const DBMatOffline> acquireObject(std::unique_lock<std::mutex>& lock,
+                                                    ContainerList::iterator container);
+
+  /**
+   * @brief Registers a load of a file or returns the load that is already in progress for the
+   * file. The mutex has to be locked by the caller.
+   *
+   * @param fileName Path of the file
+   * @param promise Promise that is registered if no load is in progress
+   * @param future Future of the load
+   * @return true if the caller has to load the file and fulfill the promise
+   */
+  bool startLoad(const std::string& fileName,
+                 std::promise<std::shared_ptr<const DBMatOffline>>& promise, LoadFuture& future);
+
+  /**
+   * @brief Stores an offline object in front of the containers in memory and evicts the least
+   * recently used containers if the memory limit is exceeded. The mutex has to be locked by the
+   * caller, which has to perform the returned spill jobs after releasing the lock.
    *
-   * @param index Index of the object container
-   * @return const ObjectContainer&
+   * @param gridConfig Grid configuration
+   * @param geometryConfig Geometry configuration for geometry aware sparse grids
+   * @param adaptivityConfig Adaptivity configuration
+   * @param regularizationConfig Regularization configuration
+   * @param densityEstimationConfig Density estimation configuration
+   * @param object The object to be stored
+   * @param spillJobs Objects to write to the spill directory (appended to)
+   */
+  void insertObject(const sgpp::base::GeneralGridConfiguration& gridConfig,
+                    const sgpp::datadriven::GeometryConfiguration& geometryConfig,
+                    const sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+                    const sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+                    const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+                    std::shared_ptr<const DBMatOffline> object, std::vector<SpillJob>& spillJobs);
+
+  /**
+   * @brief Evicts the least recently used containers (except for the most recently used one)
+   * until the memory limit is met. If a spill directory is set, the evicted containers are moved
+   * to the spilled containers and the objects are returned as spill jobs, otherwise they are
+   * discarded. The mutex has to be locked by the caller.
+   *
+   * @param spillJobs Objects to write to the spill directory (appended to)
+   */
+  void evictObjects(std::vector<SpillJob>& spillJobs);
+
+  /**
+   * @brief Writes the objects of evicted containers to the spill directory and releases them
+   * (unless they have been requested again in the meantime). Objects that cannot be written are
+   * discarded. The mutex must not be locked by the caller.
+   *
+   * @param spillJobs Objects to write to the spill directory
+   */
+  void performSpills(std::vector<SpillJob>& spillJobs);
+
+  /**
+   * @brief Returns the spilled container with the given sequence number and spill file
+   * (spilledObjects.end() if there is no such container). The mutex has to be locked by the
+   * caller.
+   *
+   * @param id Sequence number of the container
+   * @param fileName Path of the spill file
+   * @return ContainerList::iterator
+   */
+  ContainerList::iterator findSpilledContainer(size_t id, const std::string& fileName);
+
+  /**
+   * @brief Removes a container from the hash index. The mutex has to be locked by the caller.
+   *
+   * @param container Iterator to the container
    */
-  const ObjectContainer& getObjectContainer(size_t index) const;
+  void removeFromIndex(ContainerList::iterator container);
+
+  /**
+   * @brief Returns a hash of the part of the configuration that is compared for identical offline
+   * objects (the grid and the decomposition type), which is used to look up the object containers.
+   *
+   * @param gridConfig Grid configuration
+   * @param densityEstimationConfig Density estimation configuration
+   * @return uint64_t
+   */
+  static uint64_t getConfigurationHash(
+      const sgpp::base::GeneralGridConfiguration& gridConfig,
+      const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 };
 
 }  // namespace datadriven
@@ -208,6 +208,68 @@ void DBMatOffline::store(const std::string& fileName) {
 #endif /* USE_GSL */
 }
 
+void DBMatOffline::storeMapped(const std::string& fileName, uint64_t configurationHash,
+                               const std::string& configuration) const {
+  if (!isDecomposed) {
+    throw algorithm_exception("Matrix not decomposed yet");
+  }
+
+  DBMatMappedFile::SectionList sections;
+  std::list<DataMatrix> temporaries;
+  getMappedSections(sections, temporaries);
+  DBMatMappedFile::write(fileName, getDecompositionType(), configurationHash, configuration,
+                         sections);
+}
+
+void DBMatOffline::loadMapped(const DBMatMappedFile& file) {
+  if (file.getDecompositionType() != getDecompositionType()) {
+    throw algorithm_exception("DBMatOffline::loadMapped: decomposition type does not match");
+  }
+
+  loadMappedSections(file);
+  isConstructed = true;
+  isDecomposed = true;
+}
+
+void DBMatOffline::getMappedSections(DBMatMappedFile::SectionList& sections,
+                                     std::list<DataMatrix>& temporaries) const {
+  sections.emplace_back("lhs", &lhsMatrix);
+
+  // interactions as one row: number of terms, then size and dimensions of every term
+  std::vector<double> inter{static_cast<double>(interactions.size())};
+  for (const std::set<size_t>& i : interactions) {
+    inter.push_back(static_cast<double>(i.size()));
+    for (size_t j : i) {
+      inter.push_back(static_cast<double>(j));
+    }
+  }
+  temporaries.emplace_back(inter.data(), 1, inter.size());
+  sections.emplace_back("interactions", &temporaries.back());
+
+  if (lhsInverse.getSize() > 0) {
+    sections.emplace_back("inverse", &lhsInverse);
+  }
+}
+
+void DBMatOffline::loadMappedSections(const DBMatMappedFile& file) {
+  file.copySection("lhs", lhsMatrix);
+
+  DataMatrix inter;
+  file.copySection("interactions", inter);
+  interactions.clear();
+  for (size_t i = 1; i < inter.getSize(); i += static_cast<size_t>(inter[i]) + 1) {
+    std::set<size_t> term;
+    for (size_t j = 1; j <= static_cast<size_t>(inter[i]); j++) {
+      term.insert(static_cast<size_t>(inter[i + j]));
+    }
+    interactions.insert(term);
+  }
+
+  if (file.hasSection("inverse")) {
+    file.copySection("inverse", lhsInverse);
+  }
+}
+
 void DBMatOffline::decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
                                            DensityEstimationConfiguration& densityEstimationConfig,
                                            std::shared_ptr<BlacsProcessGrid> processGrid,
@@ -281,6 +343,10 @@ void sgpp::datadriven::DBMatOffline::parseInter(
 
 size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
 
+size_t DBMatOffline::getMemorySize() const {
+  return sizeof(*this) + (lhsMatrix.getSize() + lhsInverse.getSize()) * sizeof(double);
+}
+
 sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() { return this->lhsMatrix; }
 
 }  // namespace datadriven
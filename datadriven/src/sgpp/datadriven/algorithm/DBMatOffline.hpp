@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMappedFile.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
@@ -195,17 +196,42 @@ class DBMatOffline {
    */
   virtual void store(const std::string& fileName);
 
+  /**
+   * Serialize the DBMatOffline Object in the binary format of DBMatMappedFile, which can be
+   * mapped into memory and does not require GSL.
+   * @param fileName path where to store the file.
+   * @param configurationHash hash of the configuration (see DBMatDatabase::getConfigurationHash)
+   * @param configuration text description of the configuration
+   */
+  void storeMapped(const std::string& fileName, uint64_t configurationHash = 0,
+                   const std::string& configuration = "") const;
+
+  /**
+   * Loads the decomposition from a file in the binary format of DBMatMappedFile.
+   * The decomposition type of the file has to match the type of this object.
+   * The matrices are copied out of the mapping, the file can be closed afterwards.
+   * @param file the mapped file
+   */
+  void loadMapped(const DBMatMappedFile& file);
+
   /**
    * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
    * @return the grid size
    */
   virtual size_t getGridSize();
 
+  /**
+   * Returns the approximate number of bytes occupied by the matrices of the object (used to
+   * bound the memory of DBMatObjectStore)
+   * @return memory size in bytes
+   */
+  virtual size_t getMemorySize() const;
+
   /**
    * Returns the decomposition type of the DBMatOffline object
    * @return the type of matrix decomposition
    */
-  virtual sgpp::datadriven::MatrixDecompositionType getDecompositionType() = 0;
+  virtual sgpp::datadriven::MatrixDecompositionType getDecompositionType() const = 0;
 
  protected:
   DBMatOffline();
@@ -230,6 +256,21 @@ class DBMatOffline {
    */
   void parseInter(const std::string& fileName,
                   std::set<std::set<size_t>>& interactions) const;
+
+  /**
+   * Collects the matrices which are stored by storeMapped() (the decomposed matrix, the interaction
+   * terms and the inverse if it has been computed). Override if more matrices have to be stored.
+   * @param sections list of named matrices to append to
+   * @param temporaries storage for matrices that are created only for serialization
+   */
+  virtual void getMappedSections(DBMatMappedFile::SectionList& sections,
+                                 std::list<DataMatrix>& temporaries) const;
+
+  /**
+   * Restores the matrices stored by getMappedSections().
+   * @param file the mapped file
+   */
+  virtual void loadMappedSections(const DBMatMappedFile& file);
 };
 
 }  // namespace datadriven
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <list>
 #include <string>
@@ -41,7 +42,6 @@ bool DBMatOfflineChol::isRefineable() { return true; }
 void DBMatOfflineChol::decomposeMatrix(
     const RegularizationConfiguration& regularizationConfig,
     const DensityEstimationConfiguration& densityEstimationConfig) {
-#ifdef USE_GSL
   if (isConstructed) {
     if (isDecomposed) {
       // Already decomposed => Do nothing
@@ -49,21 +49,9 @@ void DBMatOfflineChol::decomposeMatrix(
     } else {
       // auto begin = std::chrono::high_resolution_clock::now();
 
-      size_t n = lhsMatrix.getNrows();
-      gsl_matrix_view m = gsl_matrix_view_array(lhsMatrix.getPointer(), n,
-                                                n);  // Create GSL matrix view for decomposition
-
-      // Perform Cholesky decomposition
-      gsl_linalg_cholesky_decomp(&m.matrix);
+      // Perform Cholesky decomposition, the result is the lower triangular matrix
+      choleskyBlocked(lhsMatrix);
 
-      // Isolate lower triangular matrix
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          if (i < j) {
-            lhsMatrix.set(i, j, 0);
-          }
-        }
-      }
       isDecomposed = true;
       // auto end = std::chrono::high_resolution_clock::now();
       // std::cout << "Chol decomp took "
@@ -73,10 +61,92 @@ void DBMatOfflineChol::decomposeMatrix(
   } else {
     throw algorithm_exception("Matrix has to be constructed before it can be decomposed");
   }
+}
 
-#else
-  throw algorithm_exception("built without GSL");
-#endif /*USE_GSL*/
+void DBMatOfflineChol::choleskyBlocked(DataMatrix& matrix, size_t blockSize) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("DBMatOfflineChol::choleskyBlocked: matrix has to be quadratic");
+  }
+
+  blockSize = std::max<size_t>(blockSize, 1);
+  double* a = matrix.getPointer();
+
+  for (size_t k0 = 0; k0 < n; k0 += blockSize) {
+    const size_t k1 = std::min(k0 + blockSize, n);
+
+    // factorize the diagonal block (the updates of the previous block columns have already
+    // been applied)
+    for (size_t j = k0; j < k1; j++) {
+      const double* rowJ = a + j * n;
+
+      for (size_t i = j; i < k1; i++) {
+        double* rowI = a + i * n;
+        double sum = rowI[j];
+
+        for (size_t p = k0; p < j; p++) {
+          sum -= rowI[p] * rowJ[p];
+        }
+
+        if (i == j) {
+          if (sum <= 0.0) {
+            throw algorithm_exception(
+                "DBMatOfflineChol::choleskyBlocked: matrix is not positive definite");
+          }
+
+          rowI[j] = std::sqrt(sum);
+        } else {
+          rowI[j] = sum / rowJ[j];
+        }
+      }
+    }
+
+    if (k1 == n) {
+      break;
+    }
+
+    // panel: solve L_ik L_kk^T = A_ik for the rows below the diagonal block
+#pragma omp parallel for schedule(static)
+    for (size_t i = k1; i < n; i++) {
+      double* rowI = a + i * n;
+
+      for (size_t j = k0; j < k1; j++) {
+        const double* rowJ = a + j * n;
+        double sum = rowI[j];
+
+        for (size_t p = k0; p < j; p++) {
+          sum -= rowI[p] * rowJ[p];
+        }
+
+        rowI[j] = sum / rowJ[j];
+      }
+    }
+
+    // trailing update A_ij -= L_ik L_jk^T of the lower triangle, the rows have different
+    // lengths, hence the dynamic schedule
+#pragma omp parallel for schedule(dynamic, 8)
+    for (size_t i = k1; i < n; i++) {
+      double* rowI = a + i * n;
+
+      for (size_t j = k1; j <= i; j++) {
+        const double* rowJ = a + j * n;
+        double sum = 0.0;
+
+        for (size_t p = k0; p < k1; p++) {
+          sum += rowI[p] * rowJ[p];
+        }
+
+        rowI[j] -= sum;
+      }
+    }
+  }
+
+  // isolate lower triangular matrix
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    std::fill(a + i * n + i + 1, a + (i + 1) * n, 0.0);
+  }
 }
 
 void DBMatOfflineChol::decomposeMatrixParallel(
@@ -436,7 +506,7 @@ void DBMatOfflineChol::choleskyPermutation(size_t k, size_t l, size_t job) {
 #endif /*USE_GSL*/
 }
 
-sgpp::datadriven::MatrixDecompositionType DBMatOfflineChol::getDecompositionType() {
+sgpp::datadriven::MatrixDecompositionType DBMatOfflineChol::getDecompositionType() const {
   return sgpp::datadriven::MatrixDecompositionType::Chol;
 }
 }  // namespace datadriven
@@ -33,7 +33,7 @@ class DBMatOfflineChol : public DBMatOfflineGE {
    * Returns the decomposition type of the DBMatOffline object
    * @return the type of matrix decomposition
    */
-  sgpp::datadriven::MatrixDecompositionType getDecompositionType() override;
+  sgpp::datadriven::MatrixDecompositionType getDecompositionType() const override;
 
   /**
    * Decomposes the matrix according to the chosen decomposition type.
@@ -86,6 +86,16 @@ class DBMatOfflineChol : public DBMatOfflineGE {
   void compute_inverse_parallel(std::shared_ptr<BlacsProcessGrid> processGrid,
                                 const ParallelConfiguration& parallelConfig) override;
 
+  /**
+   * Blocked (right-looking) Cholesky decomposition of a symmetric positive definite matrix.
+   * The panel solves and the trailing update of every block column are parallelized with OpenMP.
+   * Only the lower triangle of the matrix is read. This is an in place operation, afterwards the
+   * matrix holds the lower triangular factor (its upper triangle is set to zero).
+   * @param matrix the matrix to be decomposed
+   * @param blockSize number of columns per block
+   */
+  static void choleskyBlocked(DataMatrix& matrix, size_t blockSize = 64);
+
  protected:
   /**
    * Permutes the rows of the cholesky factor based on permutations
@@ -193,7 +193,7 @@ void sgpp::datadriven::DBMatOfflineDenseIChol::ichol(const DataMatrix& matrix, D
   }
 } /* omp parallel */
 
-sgpp::datadriven::MatrixDecompositionType DBMatOfflineDenseIChol::getDecompositionType() {
+sgpp::datadriven::MatrixDecompositionType DBMatOfflineDenseIChol::getDecompositionType() const {
   return sgpp::datadriven::MatrixDecompositionType::DenseIchol;
 }
 } /* namespace datadriven */
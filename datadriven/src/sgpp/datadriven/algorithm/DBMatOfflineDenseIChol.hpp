@@ -31,7 +31,7 @@ class DBMatOfflineDenseIChol : public DBMatOfflineChol {
    * Returns the decomposition type of the DBMatOffline object
    * @return the type of matrix decomposition
    */
-  sgpp::datadriven::MatrixDecompositionType getDecompositionType() override;
+  sgpp::datadriven::MatrixDecompositionType getDecompositionType() const override;
 
   /**
    * Decomposes the matrix according to the chosen decomposition type.
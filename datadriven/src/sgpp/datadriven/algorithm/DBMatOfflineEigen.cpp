@@ -114,7 +114,7 @@ void DBMatOfflineEigen::decomposeMatrix(
   }
 }
 
-sgpp::datadriven::MatrixDecompositionType DBMatOfflineEigen::getDecompositionType() {
+sgpp::datadriven::MatrixDecompositionType DBMatOfflineEigen::getDecompositionType() const {
   return sgpp::datadriven::MatrixDecompositionType::Eigen;
 }
 
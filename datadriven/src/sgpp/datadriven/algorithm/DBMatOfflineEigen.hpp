@@ -33,7 +33,7 @@ class DBMatOfflineEigen : public DBMatOffline {
    * Returns the decomposition type of the DBMatOffline object
    * @return the type of matrix decomposition
    */
-  sgpp::datadriven::MatrixDecompositionType getDecompositionType() override;
+  sgpp::datadriven::MatrixDecompositionType getDecompositionType() const override;
 
   /**
    * This decomposition type is not refineable.
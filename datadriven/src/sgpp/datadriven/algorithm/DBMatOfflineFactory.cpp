@@ -13,6 +13,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -68,6 +69,11 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 }
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
+  if (DBMatMappedFile::isMappedFile(fileName)) {
+    DBMatMappedFile file(fileName);
+    return buildFromMappedFile(file);
+  }
+
 #ifdef USE_GSL
   std::ifstream file(fileName, std::istream::in);
 
@@ -113,5 +119,36 @@ DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
 #endif /* USE_GSL */
 }
 
+DBMatOffline* DBMatOfflineFactory::buildFromMappedFile(const DBMatMappedFile& file) {
+  std::unique_ptr<DBMatOffline> object;
+
+  switch (file.getDecompositionType()) {
+    case (MatrixDecompositionType::Chol):
+    case (MatrixDecompositionType::SMW_chol):
+      object.reset(new DBMatOfflineChol());
+      break;
+    case (MatrixDecompositionType::DenseIchol):
+      object.reset(new DBMatOfflineDenseIChol());
+      break;
+#ifdef USE_GSL
+    case (MatrixDecompositionType::Eigen):
+      object.reset(new DBMatOfflineEigen());
+      break;
+    case (MatrixDecompositionType::LU):
+      object.reset(new DBMatOfflineLU());
+      break;
+    case (MatrixDecompositionType::OrthoAdapt):
+    case (MatrixDecompositionType::SMW_ortho):
+      object.reset(new DBMatOfflineOrthoAdapt());
+      break;
+#endif /* USE_GSL */
+    default:
+      throw factory_exception("Cannot build offline object of this decomposition type from file");
+  }
+
+  object->loadMapped(file);
+  return object.release();
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
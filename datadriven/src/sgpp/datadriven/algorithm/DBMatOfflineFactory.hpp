@@ -33,11 +33,21 @@ DBMatOffline* buildOfflineObject(
 
 /**
  * Read a serialized DBMatOffline object and construct a new object with the information.
+ * Both the text/GSL format of DBMatOffline::store and the binary format of
+ * DBMatOffline::storeMapped are supported (the latter does not require GSL for Cholesky based
+ * decompositions).
  * @param fname Path to the serialized DBMatOffline object.
  * @return new instance of DBMatOffline implementor owned by caller.
  */
 DBMatOffline* buildFromFile(const std::string& fname);
 
+/**
+ * Construct a new object from a file in the binary format of DBMatOffline::storeMapped.
+ * @param file the mapped file
+ * @return new instance of DBMatOffline implementor owned by caller.
+ */
+DBMatOffline* buildFromMappedFile(const DBMatMappedFile& file);
+
 } /* namespace DBMatOfflineFactory */
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -81,20 +81,16 @@ void DBMatOfflineGE::buildMatrix(Grid* grid,
   // then add regularization term
   auto size = grid->getStorage().getSize();
 
-  // Construct matrix lambda * C (just use identity for C)
-  DataMatrix lambdaC(size, size);
+  // Compute A + lambda * C (just use identity for C), C is only added to the diagonal to
+  // avoid a second dense matrix
   if (regularizationConfig.type_ == RegularizationType::Identity) {
-    lambdaC.setAll(0.);
     for (size_t i = 0; i < size; i++) {
-      lambdaC.set(i, i, regularizationConfig.lambda_);
+      lhsMatrix.set(i, i, lhsMatrix.get(i, i) + regularizationConfig.lambda_);
     }
   } else {
     throw operation_exception("Unsupported regularization type");
   }
 
-  // Compute A + lambda * C:
-  lhsMatrix.add(lambdaC);
-
   isConstructed = true;
 }
 
@@ -15,6 +15,7 @@
 #include <gsl/gsl_permutation.h>
 #include <gsl/gsl_permute.h>
 
+#include <list>
 #include <string>
 #include <vector>
 
@@ -139,7 +140,27 @@ void DBMatOfflineLU::store(const std::string& fileName) {
   fclose(outputCFile);
 }
 
-sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() {
+void DBMatOfflineLU::getMappedSections(DBMatMappedFile::SectionList& sections,
+                                       std::list<DataMatrix>& temporaries) const {
+  DBMatOffline::getMappedSections(sections, temporaries);
+  temporaries.emplace_back(1, permutation->size);
+  for (size_t i = 0; i < permutation->size; i++) {
+    temporaries.back()[i] = static_cast<double>(permutation->data[i]);
+  }
+  sections.emplace_back("permutation", &temporaries.back());
+}
+
+void DBMatOfflineLU::loadMappedSections(const DBMatMappedFile& file) {
+  DBMatOffline::loadMappedSections(file);
+  DataMatrix perm;
+  file.copySection("permutation", perm);
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(perm.getSize())};
+  for (size_t i = 0; i < perm.getSize(); i++) {
+    permutation->data[i] = static_cast<size_t>(perm[i]);
+  }
+}
+
+sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() const {
   return sgpp::datadriven::MatrixDecompositionType::LU;
 }
 } /* namespace datadriven */
@@ -41,7 +41,7 @@ class DBMatOfflineLU : public DBMatOfflineGE {
    * Returns the decomposition type of the DBMatOffline object
    * @return the type of matrix decomposition
    */
-  sgpp::datadriven::MatrixDecompositionType getDecompositionType() override;
+  sgpp::datadriven::MatrixDecompositionType getDecompositionType() const override;
 
   /**
    * This decomposition type is not refineable.
@@ -67,6 +67,21 @@ class DBMatOfflineLU : public DBMatOfflineGE {
 
   void store(const std::string& fname) override;
 
+ protected:
+  /**
+   * Additionally stores the permutation in the binary format
+   * @param sections list of named matrices to append to
+   * @param temporaries storage for matrices that are created only for serialization
+   */
+  void getMappedSections(DBMatMappedFile::SectionList& sections,
+                         std::list<DataMatrix>& temporaries) const override;
+
+  /**
+   * Additionally restores the permutation from the binary format
+   * @param file the mapped file
+   */
+  void loadMappedSections(const DBMatMappedFile& file) override;
+
  private:
   /**
    * Stores the permutation that was applied on the matrix during decomposition for stability
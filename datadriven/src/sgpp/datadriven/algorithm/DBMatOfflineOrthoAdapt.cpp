@@ -9,6 +9,7 @@
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
 #include <sgpp/datadriven/scalapack/DataVectorDistributed.hpp>
 
+#include <list>
 #include <string>
 #include <vector>
 
@@ -326,6 +327,19 @@ void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
 #endif /* USE_GSL */
 }
 
+void DBMatOfflineOrthoAdapt::getMappedSections(DBMatMappedFile::SectionList& sections,
+                                               std::list<DataMatrix>& temporaries) const {
+  DBMatOffline::getMappedSections(sections, temporaries);
+  sections.emplace_back("q", &q_ortho_matrix_);
+  sections.emplace_back("tInv", &t_tridiag_inv_matrix_);
+}
+
+void DBMatOfflineOrthoAdapt::loadMappedSections(const DBMatMappedFile& file) {
+  DBMatOffline::loadMappedSections(file);
+  file.copySection("q", q_ortho_matrix_);
+  file.copySection("tInv", t_tridiag_inv_matrix_);
+}
+
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
     std::shared_ptr<BlacsProcessGrid> processGrid, const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
@@ -412,8 +426,13 @@ void DBMatOfflineOrthoAdapt::compute_inverse_parallel(std::shared_ptr<BlacsProce
 #endif /* USE_SCALAPACK */
 }
 
-sgpp::datadriven::MatrixDecompositionType DBMatOfflineOrthoAdapt::getDecompositionType() {
+sgpp::datadriven::MatrixDecompositionType DBMatOfflineOrthoAdapt::getDecompositionType() const {
   return sgpp::datadriven::MatrixDecompositionType::OrthoAdapt;
 }
+
+size_t DBMatOfflineOrthoAdapt::getMemorySize() const {
+  return DBMatOffline::getMemorySize() +
+         (q_ortho_matrix_.getSize() + t_tridiag_inv_matrix_.getSize()) * sizeof(double);
+}
 }  // namespace datadriven
 }  // namespace sgpp
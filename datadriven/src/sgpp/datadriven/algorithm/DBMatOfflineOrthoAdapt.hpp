@@ -45,7 +45,9 @@ class DBMatOfflineOrthoAdapt : public DBMatOfflinePermutable {
    * Returns the decomposition type of the DBMatOffline object
    * @return the type of matrix decomposition
    */
-  sgpp::datadriven::MatrixDecompositionType getDecompositionType() override;
+  sgpp::datadriven::MatrixDecompositionType getDecompositionType() const override;
+
+  size_t getMemorySize() const override;
 
   /**
    * Builds the left hand side matrix without the regularization term
@@ -151,6 +153,20 @@ class DBMatOfflineOrthoAdapt : public DBMatOfflinePermutable {
   DataMatrixDistributed& getTinvDistributed() { return this->t_tridiag_inv_matrix_distributed_; }
 
  protected:
+  /**
+   * Additionally stores q_ortho_matrix_ and t_tridiag_inv_matrix_ in the binary format
+   * @param sections list of named matrices to append to
+   * @param temporaries storage for matrices that are created only for serialization
+   */
+  void getMappedSections(DBMatMappedFile::SectionList& sections,
+                         std::list<DataMatrix>& temporaries) const override;
+
+  /**
+   * Additionally restores q_ortho_matrix_ and t_tridiag_inv_matrix_ from the binary format
+   * @param file the mapped file
+   */
+  void loadMappedSections(const DBMatMappedFile& file) override;
+
   sgpp::base::DataMatrix q_ortho_matrix_;        // orthogonal matrix of decomposition
   sgpp::base::DataMatrix t_tridiag_inv_matrix_;  // inverse of the tridiag matrix of decomposition
 
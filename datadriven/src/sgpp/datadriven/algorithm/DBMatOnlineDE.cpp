@@ -50,6 +50,9 @@ DBMatOnlineDE::DBMatOnlineDE(DBMatOffline& offline, Grid& grid, double lambda, d
 }
 
 void DBMatOnlineDE::updateRhs(size_t gridSize, std::list<size_t>* deletedPoints) {
+  // the grid has been refined or coarsened
+  evaluationCache.invalidate();
+
   if (functionComputed) {
     // Coarsening -> remove all idx in deletedPoints
     if (deletedPoints != nullptr && deletedPoints->size() > 0) {
@@ -369,12 +372,7 @@ double DBMatOnlineDE::eval(DataVector& alpha, const DataVector& p, Grid& grid, b
 void DBMatOnlineDE::eval(DataVector& alpha, DataMatrix& values, DataVector& results, Grid& grid,
                          bool force) {
   if (functionComputed || force == true) {
-    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
-        (offlineObject.interactions.size() == 0)
-            ? sgpp::op_factory::createOperationMultipleEval(grid, values)
-            : sgpp::op_factory::createOperationMultipleEvalInter(grid, values,
-                                                                 offlineObject.interactions));
-    opEval->eval(alpha, results);
+    evaluationCache.eval(grid, alpha, values, results, &offlineObject.interactions);
     results.mult(normFactor);
   } else {
     throw algorithm_exception("Density function not computed, yet!");
@@ -407,6 +405,8 @@ void DBMatOnlineDE::setBeta(double newBeta) { beta = newBeta; }
 
 double DBMatOnlineDE::getBeta() { return beta; }
 
+double DBMatOnlineDE::getNormFactor() const { return normFactor; }
+
 double DBMatOnlineDE::normalize(DataVector& alpha, Grid& grid, size_t samples) {
   this->normFactor = 1.;
   double sum = 0.;
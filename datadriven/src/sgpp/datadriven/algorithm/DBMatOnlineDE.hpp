@@ -7,6 +7,7 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnline.hpp>
+#include <sgpp/datadriven/algorithm/MultipleEvalCache.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
@@ -176,6 +177,11 @@ class DBMatOnlineDE : public DBMatOnline {
    */
   double getBeta();
 
+  /**
+   * Returns the factor the density function is scaled with in the evaluation (set by normalize)
+   */
+  double getNormFactor() const;
+
   /**
    * Normalize the Density
    *
@@ -233,6 +239,9 @@ class DBMatOnlineDE : public DBMatOnline {
   double normFactor;
   double lambda;
   size_t oDim;
+
+  // evaluation operation that is kept between calls of eval as long as the grid is unchanged
+  MultipleEvalCache evaluationCache;
 };
 
 }  // namespace datadriven
@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/algorithm/DBMatPermutationFactory.hpp>
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
 
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -31,7 +32,7 @@ DBMatOfflinePermutable* DBMatPermutationFactory::getPermutedObject(
   // grid configuration of the base object
   sgpp::base::GeneralGridConfiguration baseGridConfig;
   // base object that will be transformed
-  const DBMatOfflinePermutable* baseObject =
+  std::shared_ptr<const DBMatOfflinePermutable> baseObject =
       this->store->getBaseObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
                                  densityEstimationConfig, baseGridConfig);
 
@@ -48,8 +49,8 @@ DBMatOfflinePermutable* DBMatPermutationFactory::getPermutedObject(
             db.getBaseDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
                                  densityEstimationConfig, dbGridConfig);
         // build offline object
-        DBMatOfflinePermutable* newBaseObject =
-            dynamic_cast<DBMatOfflinePermutable*>(DBMatOfflineFactory::buildFromFile(objectFile));
+        std::shared_ptr<DBMatOfflinePermutable> newBaseObject(
+            dynamic_cast<DBMatOfflinePermutable*>(DBMatOfflineFactory::buildFromFile(objectFile)));
         // grid config with 1 elemts remove from level vector                    onst must be
         baseGridConfig = PermutationUtil::getNormalizedConfig(dbGridConfig);
         // permutate base object to match cleaned level vec
@@ -57,7 +58,7 @@ DBMatOfflinePermutable* DBMatPermutationFactory::getPermutedObject(
 
         baseObject = newBaseObject;
 
-        // store base objects. Ownership gets transfered to the object's ObjectContainer
+        // store base objects. Ownership gets shared with the object's ObjectContainer
         this->store->putObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
                                densityEstimationConfig, baseObject);
       }
@@ -70,9 +71,9 @@ DBMatOfflinePermutable* DBMatPermutationFactory::getPermutedObject(
         baseGridConfig = gridConfig;
       }
       // Instanciate base offline object
-      DBMatOfflinePermutable* newBaseObject =
+      std::shared_ptr<DBMatOfflinePermutable> newBaseObject(
           dynamic_cast<DBMatOfflinePermutable*>(DBMatOfflineFactory::buildOfflineObject(
-              baseGridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig));
+              baseGridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig)));
 
       // build grid with geometry config
       std::unique_ptr<Grid> grid;
@@ -95,7 +96,7 @@ DBMatOfflinePermutable* DBMatPermutationFactory::getPermutedObject(
 
       baseObject = newBaseObject;
 
-      // store base objects, ownership gets transfered to the object's ObjectContainer
+      // store base objects, ownership gets shared with the object's ObjectContainer
       this->store->putObject(baseGridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
                              densityEstimationConfig, baseObject);
     }
@@ -0,0 +1,112 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/MultipleEvalCache.hpp>
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+
+#include <algorithm>
+#include <set>
+
+namespace sgpp {
+namespace datadriven {
+
+const size_t MultipleEvalCache::defaultBatchSize;
+
+MultipleEvalCache::MultipleEvalCache(const OperationMultipleEvalConfiguration& configuration,
+                                     size_t batchSize)
+    : configuration(configuration),
+      batchSize(std::max<size_t>(batchSize, 1)),
+      operation(nullptr),
+      buffer(new DataMatrix()),
+      cachedGrid(nullptr),
+      cachedGridSize(0),
+      numberOfCreatedOperations(0) {}
+
+void MultipleEvalCache::eval(Grid& grid, DataVector& alpha, const DataMatrix& samples,
+                             DataVector& results,
+                             const std::set<std::set<size_t>>* interactions) {
+  const size_t numberOfSamples = samples.getNrows();
+  DataVector chunkResults;
+
+  results.resize(numberOfSamples);
+
+  for (size_t start = 0; start < numberOfSamples; start += batchSize) {
+    const size_t end = std::min(start + batchSize, numberOfSamples);
+    loadChunk(grid, samples, start, end, interactions);
+
+    // some kernels expect the result vector to have the size of the data set
+    chunkResults.resize(end - start);
+    operation->eval(alpha, chunkResults);
+    std::copy(chunkResults.data(), chunkResults.data() + (end - start), results.data() + start);
+  }
+}
+
+void MultipleEvalCache::eval(Grid& grid, const DataMatrix& alpha, const DataMatrix& samples,
+                             DataMatrix& results,
+                             const std::set<std::set<size_t>>* interactions) {
+  const size_t numberOfSamples = samples.getNrows();
+  const size_t m = alpha.getNcols();
+  DataMatrix chunkResults;
+
+  results.resize(numberOfSamples, m);
+
+  for (size_t start = 0; start < numberOfSamples; start += batchSize) {
+    const size_t end = std::min(start + batchSize, numberOfSamples);
+    loadChunk(grid, samples, start, end, interactions);
+
+    chunkResults.resize(end - start, m);
+    operation->multMatrix(alpha, chunkResults);
+    std::copy(chunkResults.data(), chunkResults.data() + (end - start) * m,
+              results.data() + start * m);
+  }
+}
+
+void MultipleEvalCache::invalidate() {
+  operation.reset();
+  cachedGrid = nullptr;
+  cachedGridSize = 0;
+}
+
+void MultipleEvalCache::setConfiguration(const OperationMultipleEvalConfiguration& configuration) {
+  this->configuration = configuration;
+  invalidate();
+}
+
+size_t MultipleEvalCache::getNumberOfCreatedOperations() const {
+  return numberOfCreatedOperations;
+}
+
+void MultipleEvalCache::loadChunk(Grid& grid, const DataMatrix& samples, size_t start,
+                                  size_t end, const std::set<std::set<size_t>>* interactions) {
+  if ((cachedGrid != &grid) || (cachedGridSize != grid.getSize())) {
+    invalidate();
+  }
+
+  const size_t dim = samples.getNcols();
+  buffer->resize(end - start, dim);
+  std::copy(samples.data() + start * dim, samples.data() + end * dim, buffer->data());
+
+  if ((operation == nullptr) || !operation->updateDataset()) {
+    createOperation(grid, interactions);
+  }
+}
+
+void MultipleEvalCache::createOperation(Grid& grid,
+                                        const std::set<std::set<size_t>>* interactions) {
+  if ((interactions != nullptr) && !interactions->empty()) {
+    operation.reset(op_factory::createOperationMultipleEvalInter(grid, *buffer, *interactions));
+  } else {
+    operation.reset(op_factory::createOperationMultipleEval(grid, *buffer, configuration));
+  }
+
+  cachedGrid = &grid;
+  cachedGridSize = grid.getSize();
+  numberOfCreatedOperations++;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
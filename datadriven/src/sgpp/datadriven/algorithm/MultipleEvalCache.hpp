@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <memory>
+#include <set>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+/**
+ * Persistent evaluation operation of a model, which evaluates sparse grid functions at
+ * arbitrary batches of data points.
+ *
+ * The OperationMultipleEval is created once for a grid and bound to an internal buffer.
+ * The data points of every call are streamed through this buffer in chunks of at most
+ * batchSize points and only the data-dependent part of the operation is updated
+ * (OperationMultipleEval::updateDataset), such that grid-dependent data structures
+ * (e.g., level and index arrays of the streaming kernels or the sorted grid of the B-spline
+ * kernels) are kept between calls. Kernels that do not support updating the data set are
+ * recreated for every chunk.
+ *
+ * The cache has to be invalidated (invalidate()) if the grid is refined or coarsened; this
+ * is also detected automatically if the grid object or its size has changed.
+ * The cache must not be used by multiple threads at once.
+ */
+class MultipleEvalCache {
+ public:
+  /// default number of data points per chunk
+  static const size_t defaultBatchSize = 4096;
+
+  /**
+   * Constructor.
+   *
+   * @param configuration   configuration of the evaluation operation
+   * @param batchSize       maximal number of data points that are evaluated at once
+   */
+  explicit MultipleEvalCache(const OperationMultipleEvalConfiguration& configuration =
+                                 OperationMultipleEvalConfiguration(),
+                             size_t batchSize = defaultBatchSize);
+
+  MultipleEvalCache(const MultipleEvalCache&) = delete;
+  MultipleEvalCache& operator=(const MultipleEvalCache&) = delete;
+  MultipleEvalCache(MultipleEvalCache&&) = default;
+  MultipleEvalCache& operator=(MultipleEvalCache&&) = default;
+
+  /**
+   * Evaluates the sparse grid function at the data points.
+   *
+   * @param grid            sparse grid
+   * @param alpha           coefficients of the grid points
+   * @param samples         data points (row-wise)
+   * @param[out] results    values at the data points
+   * @param interactions    if not null or empty, the grid is evaluated with interaction terms
+   *                        (the interactions must not change while the cache is valid)
+   */
+  void eval(Grid& grid, DataVector& alpha, const DataMatrix& samples, DataVector& results,
+            const std::set<std::set<size_t>>* interactions = nullptr);
+
+  /**
+   * Evaluates multiple sparse grid functions on the same grid at the data points
+   * (see OperationMultipleEval::multMatrix).
+   *
+   * @param grid            sparse grid
+   * @param alpha           coefficients of the grid points (each column is a coefficient vector)
+   * @param samples         data points (row-wise)
+   * @param[out] results    entry (i, k) is the value of function k at data point i
+   * @param interactions    if not null or empty, the grid is evaluated with interaction terms
+   */
+  void eval(Grid& grid, const DataMatrix& alpha, const DataMatrix& samples, DataMatrix& results,
+            const std::set<std::set<size_t>>* interactions = nullptr);
+
+  /**
+   * Discards the evaluation operation, has to be called if the grid was changed.
+   */
+  void invalidate();
+
+  /**
+   * Sets the configuration of the evaluation operation (invalidates the cache).
+   *
+   * @param configuration   configuration of the evaluation operation
+   */
+  void setConfiguration(const OperationMultipleEvalConfiguration& configuration);
+
+  /**
+   * @return number of evaluation operations that have been created so far
+   */
+  size_t getNumberOfCreatedOperations() const;
+
+ protected:
+  /// configuration of the evaluation operation
+  OperationMultipleEvalConfiguration configuration;
+  /// maximal number of data points per chunk
+  size_t batchSize;
+  /// evaluation operation bound to buffer (null if invalid)
+  std::unique_ptr<base::OperationMultipleEval> operation;
+  /// buffer for the data points of the current chunk (the operation holds a reference to it)
+  std::unique_ptr<DataMatrix> buffer;
+  /// grid for which the operation has been created
+  const Grid* cachedGrid;
+  /// size of the grid when the operation has been created
+  size_t cachedGridSize;
+  /// number of evaluation operations that have been created so far
+  size_t numberOfCreatedOperations;
+
+  /**
+   * Copies the data points [start, end) to the buffer and updates or recreates the operation.
+   */
+  void loadChunk(Grid& grid, const DataMatrix& samples, size_t start, size_t end,
+                 const std::set<std::set<size_t>>* interactions);
+
+  /**
+   * Creates the evaluation operation for the current contents of the buffer.
+   */
+  void createOperation(Grid& grid, const std::set<std::set<size_t>>* interactions);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -15,6 +15,8 @@
 #include <sgpp/optimization/optimizer/unconstrained/NelderMead.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <omp.h>
+
 #include <map>
 #include <cstdlib>
 #include <fstream>
@@ -28,6 +30,246 @@
 namespace sgpp {
 namespace datadriven {
 
+// -------------------------------- kd-tree -----------------------------------
+/**
+ * Kd-tree over the (weighted) samples of a KernelDensityEstimator.
+ * Every node stores the bounding box and the sum of the conditionalization factors of its
+ * samples. As the tree does not depend on the bandwidths, it can be reused when they change.
+ *
+ * The evaluation descends the tree and approximates the contribution of a node by the mean of
+ * the upper and the lower bound of its kernel values if the resulting error is small compared
+ * to a lower bound of the total density (single-tree algorithm of Gray and Moore).
+ */
+class KernelDensityEstimator::KDTree {
+ public:
+  KDTree(const std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+         const base::DataVector& cond, size_t leafSize = 32);
+
+  /**
+   * @param x           evaluation point
+   * @param kernel      kernel (has to decrease monotonically with the distance)
+   * @param bandwidths  bandwidths
+   * @param norm        normalization factors of the 1d kernels
+   * @param tolerance   bound for the relative error
+   * @return approximation of the weighted sum of all kernels centered at the samples
+   */
+  double eval(const base::DataVector& x, Kernel& kernel, const base::DataVector& bandwidths,
+              const base::DataVector& norm, double tolerance) const;
+
+ private:
+  struct Node {
+    /// range of the samples of the node in points and weights
+    size_t begin;
+    size_t end;
+    /// indices of the children (zero for leaves, as the root cannot be a child)
+    size_t left;
+    size_t right;
+    /// sum of the conditionalization factors
+    double weight;
+  };
+
+  struct Query {
+    const double* x;
+    Kernel& kernel;
+    const double* bandwidths;
+    const double* norm;
+    double tolerance;
+    /// lower bound of the kernel sum, increases while descending the tree
+    double lowerBound;
+  };
+
+  size_t numDims;
+  std::vector<Node> nodes;
+  /// lower and upper corners of the bounding boxes (row-major, one row per node)
+  std::vector<double> lower;
+  std::vector<double> upper;
+  /// samples sorted by the leaves they are contained in (row-major)
+  std::vector<double> points;
+  /// conditionalization factors of the sorted samples
+  std::vector<double> weights;
+
+  size_t build(std::vector<size_t>& permutation, size_t begin, size_t end, size_t leafSize,
+               const std::vector<double>& unsortedPoints, const base::DataVector& cond);
+  void bounds(size_t node, const Query& query, double& kMin, double& kMax) const;
+  double visit(size_t node, double kMin, double kMax, Query& query) const;
+};
+
+KernelDensityEstimator::KDTree::KDTree(
+    const std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+    const base::DataVector& cond, size_t leafSize)
+    : numDims(samplesVec.size()) {
+  const size_t numSamples = cond.getSize();
+  std::vector<double> unsortedPoints(numSamples * numDims);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t idim = 0; idim < numDims; idim++) {
+      unsortedPoints[i * numDims + idim] = samplesVec[idim]->get(i);
+    }
+  }
+
+  std::vector<size_t> permutation(numSamples);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    permutation[i] = i;
+  }
+
+  build(permutation, 0, numSamples, std::max<size_t>(leafSize, 1), unsortedPoints, cond);
+
+  points.resize(numSamples * numDims);
+  weights.resize(numSamples);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    std::copy(unsortedPoints.begin() + permutation[i] * numDims,
+              unsortedPoints.begin() + (permutation[i] + 1) * numDims,
+              points.begin() + i * numDims);
+    weights[i] = cond[permutation[i]];
+  }
+}
+
+size_t KernelDensityEstimator::KDTree::build(std::vector<size_t>& permutation, size_t begin,
+                                             size_t end, size_t leafSize,
+                                             const std::vector<double>& unsortedPoints,
+                                             const base::DataVector& cond) {
+  const size_t node = nodes.size();
+  nodes.push_back(Node{begin, end, 0, 0, 0.0});
+  lower.resize(lower.size() + numDims, std::numeric_limits<double>::infinity());
+  upper.resize(upper.size() + numDims, -std::numeric_limits<double>::infinity());
+
+  double* nodeLower = &lower[node * numDims];
+  double* nodeUpper = &upper[node * numDims];
+  double weight = 0.0;
+
+  for (size_t i = begin; i < end; i++) {
+    const double* point = &unsortedPoints[permutation[i] * numDims];
+
+    for (size_t idim = 0; idim < numDims; idim++) {
+      nodeLower[idim] = std::min(nodeLower[idim], point[idim]);
+      nodeUpper[idim] = std::max(nodeUpper[idim], point[idim]);
+    }
+
+    weight += cond[permutation[i]];
+  }
+
+  nodes[node].weight = weight;
+
+  if (end - begin <= leafSize) {
+    return node;
+  }
+
+  // split at the median of the dimension with the largest extent
+  size_t splitDim = 0;
+
+  for (size_t idim = 1; idim < numDims; idim++) {
+    if (nodeUpper[idim] - nodeLower[idim] > nodeUpper[splitDim] - nodeLower[splitDim]) {
+      splitDim = idim;
+    }
+  }
+
+  if (nodeUpper[splitDim] == nodeLower[splitDim]) {
+    // all samples coincide
+    return node;
+  }
+
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(permutation.begin() + begin, permutation.begin() + middle,
+                   permutation.begin() + end, [&](size_t i, size_t j) {
+                     return unsortedPoints[i * numDims + splitDim] <
+                            unsortedPoints[j * numDims + splitDim];
+                   });
+
+  // nodes may be reallocated by the recursive calls
+  const size_t left = build(permutation, begin, middle, leafSize, unsortedPoints, cond);
+  const size_t right = build(permutation, middle, end, leafSize, unsortedPoints, cond);
+  nodes[node].left = left;
+  nodes[node].right = right;
+  return node;
+}
+
+void KernelDensityEstimator::KDTree::bounds(size_t node, const Query& query, double& kMin,
+                                            double& kMax) const {
+  const double* nodeLower = &lower[node * numDims];
+  const double* nodeUpper = &upper[node * numDims];
+  kMin = 1.0;
+  kMax = 1.0;
+
+  for (size_t idim = 0; idim < numDims; idim++) {
+    const double x = query.x[idim];
+    double minDistance = 0.0;
+
+    if (x < nodeLower[idim]) {
+      minDistance = nodeLower[idim] - x;
+    } else if (x > nodeUpper[idim]) {
+      minDistance = x - nodeUpper[idim];
+    }
+
+    const double maxDistance = std::max(x - nodeLower[idim], nodeUpper[idim] - x);
+    kMax *= query.norm[idim] * query.kernel.eval(minDistance / query.bandwidths[idim]);
+    kMin *= query.norm[idim] * query.kernel.eval(maxDistance / query.bandwidths[idim]);
+  }
+}
+
+double KernelDensityEstimator::KDTree::visit(size_t node, double kMin, double kMax,
+                                             Query& query) const {
+  const Node& curNode = nodes[node];
+
+  // The error of the approximation weight * (kMin + kMax) / 2 is at most
+  // weight * (kMax - kMin) / 2. Accepting it only if this is at most
+  // tolerance * weight / totalWeight * lowerBound bounds the total relative error.
+  if ((kMax - kMin) * nodes[0].weight <= 2.0 * query.tolerance * query.lowerBound) {
+    return curNode.weight * (kMin + kMax) / 2.0;
+  }
+
+  if (curNode.left == 0) {
+    double res = 0.0;
+
+    for (size_t i = curNode.begin; i < curNode.end; i++) {
+      const double* point = &points[i * numDims];
+      double value = weights[i];
+
+      for (size_t idim = 0; idim < numDims; idim++) {
+        value *= query.norm[idim] *
+                 query.kernel.eval((query.x[idim] - point[idim]) / query.bandwidths[idim]);
+      }
+
+      res += value;
+    }
+
+    query.lowerBound += res - curNode.weight * kMin;
+    return res;
+  }
+
+  double kMinLeft, kMaxLeft, kMinRight, kMaxRight;
+  bounds(curNode.left, query, kMinLeft, kMaxLeft);
+  bounds(curNode.right, query, kMinRight, kMaxRight);
+  query.lowerBound += nodes[curNode.left].weight * kMinLeft +
+                      nodes[curNode.right].weight * kMinRight - curNode.weight * kMin;
+
+  // visit the closer child first, as this increases the lower bound faster
+  if (kMaxLeft >= kMaxRight) {
+    const double res = visit(curNode.left, kMinLeft, kMaxLeft, query);
+    return res + visit(curNode.right, kMinRight, kMaxRight, query);
+  } else {
+    const double res = visit(curNode.right, kMinRight, kMaxRight, query);
+    return res + visit(curNode.left, kMinLeft, kMaxLeft, query);
+  }
+}
+
+double KernelDensityEstimator::KDTree::eval(const base::DataVector& x, Kernel& kernel,
+                                            const base::DataVector& bandwidths,
+                                            const base::DataVector& norm,
+                                            double tolerance) const {
+  if (nodes.empty()) {
+    return 0.0;
+  }
+
+  Query query{x.getPointer(), kernel, bandwidths.getPointer(), norm.getPointer(), tolerance,
+              0.0};
+  double kMin, kMax;
+  bounds(0, query, kMin, kMax);
+  query.lowerBound = nodes[0].weight * kMin;
+  return visit(0, kMin, kMax, query);
+}
+
 // -------------------- constructors and desctructors --------------------
 KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
                                                BandwidthOptimizationType bandwidthOptimizationType)
@@ -37,7 +279,9 @@ KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
       norm(0),
       cond(0),
       sumCondInv(1.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationType(KernelEvaluationType::EXACT),
+      evaluationTolerance(0.0) {
   initializeKernel(kernelType);
 }
 
@@ -50,7 +294,9 @@ KernelDensityEstimator::KernelDensityEstimator(
       norm(samplesVec.size()),
       cond(0.0),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationType(KernelEvaluationType::EXACT),
+      evaluationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samplesVec);
 }
@@ -63,7 +309,9 @@ KernelDensityEstimator::KernelDensityEstimator(base::DataMatrix& samples, Kernel
       norm(samples.getNcols()),
       cond(samples.getNrows()),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationType(KernelEvaluationType::EXACT),
+      evaluationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samples);
 }
@@ -77,6 +325,9 @@ KernelDensityEstimator::KernelDensityEstimator(const KernelDensityEstimator& kde
   cond = base::DataVector(kde.cond);
   sumCondInv = kde.sumCondInv;
   bandwidthOptimizationType = kde.bandwidthOptimizationType;
+  evaluationType = kde.evaluationType;
+  evaluationTolerance = kde.evaluationTolerance;
+  tree = kde.tree;
 
   initializeKernel(kde.kernel->getType());
 }
@@ -100,6 +351,7 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
   nsamples = samples.getNrows();
 
   samples.transpose();
+  tree.reset();
 
   if (ndim > 0) {
     if (nsamples > 1) {
@@ -138,6 +390,7 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
 
 void KernelDensityEstimator::initialize(std::vector<std::shared_ptr<base::DataVector>>& samples) {
   ndim = samples.size();
+  tree.reset();
 
   if (ndim > 0) {
     nsamples = samples[0]->getSize();
@@ -218,25 +471,44 @@ void KernelDensityEstimator::setBandwidths(const base::DataVector& sigma) {
 }
 
 void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
-  // init variables
-  base::DataVector x(ndim);
-
   // resize result vector
   res.resize(data.getNrows());
   res.setAll(0.0);
 
+  // build the tree before the parallel region
+  std::shared_ptr<const KDTree> curTree =
+      (evaluationType == KernelEvaluationType::KDTREE) ? getTree() : nullptr;
+
   // run over all data points
-  for (size_t idata = 0; idata < data.getNrows(); idata++) {
-    // copy samples
-    for (size_t idim = 0; idim < ndim; idim++) {
-      x[idim] = data.get(idata, idim);
-    }
+#pragma omp parallel
+  {
+    base::DataVector x(ndim);
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t idata = 0; idata < data.getNrows(); idata++) {
+      // copy samples
+      for (size_t idim = 0; idim < ndim; idim++) {
+        x[idim] = data.get(idata, idim);
+      }
 
-    res[idata] = pdf(x);
+      if (curTree) {
+        res[idata] = curTree->eval(x, *kernel, bandwidths, norm, evaluationTolerance) * sumCondInv;
+      } else {
+        res[idata] = evalExact(x);
+      }
+    }
   }
 }
 
 double KernelDensityEstimator::pdf(base::DataVector& x) {
+  if (evaluationType == KernelEvaluationType::KDTREE) {
+    return getTree()->eval(x, *kernel, bandwidths, norm, evaluationTolerance) * sumCondInv;
+  } else {
+    return evalExact(x);
+  }
+}
+
+double KernelDensityEstimator::evalExact(base::DataVector& x) {
   // init variables
   double res = 0.0;
 
@@ -248,6 +520,31 @@ double KernelDensityEstimator::pdf(base::DataVector& x) {
   return res * sumCondInv;
 }
 
+void KernelDensityEstimator::setEvaluationType(KernelEvaluationType evaluationType,
+                                               double tolerance) {
+  if (tolerance < 0.0) {
+    throw base::data_exception(
+        "KernelDensityEstimator::setEvaluationType : tolerance has to be non-negative");
+  }
+
+  this->evaluationType = evaluationType;
+  evaluationTolerance = tolerance;
+}
+
+KernelEvaluationType KernelDensityEstimator::getEvaluationType() const { return evaluationType; }
+
+double KernelDensityEstimator::getEvaluationTolerance() const { return evaluationTolerance; }
+
+std::shared_ptr<const KernelDensityEstimator::KDTree> KernelDensityEstimator::getTree() {
+  std::lock_guard<std::mutex> lock(treeMutex);
+
+  if (!tree) {
+    tree = std::make_shared<const KDTree>(samplesVec, cond);
+  }
+
+  return tree;
+}
+
 double KernelDensityEstimator::evalSubset(base::DataVector& x, std::vector<size_t> skipElements) {
   // init variables
   double res = 0.0;
@@ -407,6 +704,9 @@ void KernelDensityEstimator::setConditionalizationFactor(base::DataVector& pcond
   }
 
   sumCondInv = 1. / sumCond;
+
+  // the node weights of the kd-tree depend on the conditionalization factors
+  tree.reset();
 }
 
 void KernelDensityEstimator::updateConditionalizationFactors(base::DataVector& x,
@@ -650,6 +950,28 @@ KDEMaximumLikelihoodCrossValidation::KDEMaximumLikelihoodCrossValidation(
       }
     }
   }
+
+  // the estimators (and their kd-trees) do not depend on the bandwidths,
+  // therefore they are created only once
+  localKDEs.resize(kfold);
+
+  for (size_t i = 0; i < kfold; i++) {
+    localKDEs[i].reset(new KernelDensityEstimator(*strain[i], kde.getKernel().getType(),
+                                                  BandwidthOptimizationType::NONE));
+    localKDEs[i]->setEvaluationType(kde.getEvaluationType(), kde.getEvaluationTolerance());
+  }
+}
+
+KDEMaximumLikelihoodCrossValidation::KDEMaximumLikelihoodCrossValidation(
+    const KDEMaximumLikelihoodCrossValidation& other)
+    : sgpp::base::ScalarFunction(other.getNumberOfParameters()),
+      kde(other.kde),
+      strain(other.strain),
+      stest(other.stest),
+      localKDEs(other.localKDEs.size()) {
+  for (size_t i = 0; i < localKDEs.size(); i++) {
+    localKDEs[i].reset(new KernelDensityEstimator(*other.localKDEs[i]));
+  }
 }
 
 void MaximumLikelihoodCrossValidation::optimizeBandwidths(KernelDensityEstimator* kde,
@@ -669,16 +991,10 @@ double KDEMaximumLikelihoodCrossValidation::eval(const base::DataVector& x) {
   double result = 0.0;
   // do the k-fold cross validation
   for (size_t k = 0; k < strain.size(); k++) {
-    // load the data set
-    auto trainSamples = strain[k];
-    auto testSamples = stest[k];
-
-    KernelDensityEstimator localKDE(*trainSamples, kde.getKernel().getType(),
-                                    BandwidthOptimizationType::NONE);
-    localKDE.setBandwidths(x);
+    localKDEs[k]->setBandwidths(x);
 
     // compute the cross entropy
-    result += localKDE.crossEntropy(*testSamples);
+    result += localKDEs[k]->crossEntropy(*stest[k]);
   }
 
   return result / static_cast<double>(strain.size());
@@ -12,6 +12,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <random>
 
@@ -23,6 +25,14 @@ enum class KernelType { GAUSSIAN, EPANECHNIKOV };
 
 enum class BandwidthOptimizationType { NONE, SILVERMANSRULE, SCOTTSRULE, MAXIMUMLIKELIHOOD };
 
+/**
+ * Evaluation method of the kernel sums.
+ * EXACT evaluates every kernel; point sets are evaluated in parallel with OpenMP.
+ * KDTREE prunes groups of samples with a kd-tree whose contribution is bounded tightly enough
+ * (the relative error of the density is bounded by a user-specified tolerance).
+ */
+enum class KernelEvaluationType { EXACT, KDTREE };
+
 #ifndef M_SQRT2PI
 #define M_SQRT2PI 2.506628274631000241612355239340 /* sqrt(2*pi) */
 #endif
@@ -97,6 +107,19 @@ class KernelDensityEstimator : public DensityEstimator {
 
   double evalSubset(base::DataVector& x, std::vector<size_t> skipElements);
 
+  /**
+   * Selects how the kernel sums in pdf() are evaluated.
+   * The kd-tree is only valid for kernels that decrease monotonically with the distance
+   * (as GaussianKernel and EpanechnikovKernel do) and non-negative conditionalization factors.
+   *
+   * @param evaluationType  evaluation method
+   * @param tolerance       bound for the relative error of the density for KDTREE
+   *                        (zero gives exact results up to rounding)
+   */
+  void setEvaluationType(KernelEvaluationType evaluationType, double tolerance = 1e-4);
+  KernelEvaluationType getEvaluationType() const;
+  double getEvaluationTolerance() const;
+
   /// getter and setter functions
   void getConditionalizationFactor(base::DataVector& pcond);
   void setConditionalizationFactor(base::DataVector& pcond);
@@ -117,7 +140,15 @@ class KernelDensityEstimator : public DensityEstimator {
   size_t getNsamples() override;
 
  private:
+  class KDTree;
+
   double evalKernel(base::DataVector& x, size_t i);
+  double evalExact(base::DataVector& x);
+
+  /**
+   * @return the kd-tree of the samples, which is built if it does not exist yet
+   */
+  std::shared_ptr<const KDTree> getTree();
 
   /// samples
   std::vector<std::shared_ptr<base::DataVector>> samplesVec;
@@ -139,6 +170,15 @@ class KernelDensityEstimator : public DensityEstimator {
   /// bandwith optimization type
   BandwidthOptimizationType bandwidthOptimizationType;
 
+  /// evaluation method of the kernel sums
+  KernelEvaluationType evaluationType;
+  /// relative error tolerance of the kd-tree evaluation
+  double evaluationTolerance;
+  /// kd-tree of the samples (independent of the bandwidths, built on demand)
+  std::shared_ptr<const KDTree> tree;
+  /// mutex for building the kd-tree
+  std::mutex treeMutex;
+
   void computeAndSetOptKDEbdwth();
   void computeNormalizationFactors();
 };
@@ -153,6 +193,12 @@ class KDEMaximumLikelihoodCrossValidation : public sgpp::base::ScalarFunction {
       KernelDensityEstimator& kde, size_t kfold = 10,
       std::uint64_t seedValue = std::mt19937_64::default_seed);
 
+  /**
+   * Copy constructor, copies the estimators of the folds so that clones can be evaluated
+   * independently.
+   */
+  KDEMaximumLikelihoodCrossValidation(const KDEMaximumLikelihoodCrossValidation& other);
+
   double eval(const sgpp::base::DataVector& x);
 
   /**
@@ -167,6 +213,8 @@ class KDEMaximumLikelihoodCrossValidation : public sgpp::base::ScalarFunction {
   KernelDensityEstimator& kde;
   std::vector<std::shared_ptr<base::DataMatrix>> strain;
   std::vector<std::shared_ptr<base::DataMatrix>> stest;
+  /// estimators of the training sets (kept to reuse their kd-trees for all bandwidths)
+  std::vector<std::unique_ptr<KernelDensityEstimator>> localKDEs;
 };
 
 // --------------------------------------------------------------------------------
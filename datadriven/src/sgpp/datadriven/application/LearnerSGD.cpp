@@ -14,14 +14,20 @@
 #include <sgpp/base/grid/generation/refinement_strategy/PredictiveRefinement.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitor.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp>
 #include <sgpp/datadriven/application/LearnerSGD.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <cmath>
 #include <string>
 #include <algorithm>
+#include <vector>
 
 using sgpp::base::GridStorage;
 using sgpp::base::HashRefinement;
@@ -59,7 +65,8 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
       gamma(gamma),
       currentGamma(gamma),
       batchSize(batchSize),
-      useValidData(useValidData) {
+      useValidData(useValidData),
+      samplesPerSecond(0.0) {
 
   // if no validation data is provided -> create buffer
   // which contains already processed data points
@@ -118,18 +125,11 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
 
   // refinement variables
   size_t refNum = adaptivityConfig.numRefinements_;
-  size_t numPoints = adaptivityConfig.noPoints_;
   size_t refCnt = 0;
-  double threshold = adaptivityConfig.threshold_;
   double currentBatchError = 0.0;
   double currentTrainError = 0.0;
-  RefinementMonitor *monitor = nullptr;
-  if (refMonitor == "periodic") {
-    monitor = new RefinementMonitorPeriodic(refPeriod);
-  } else if (refMonitor == "convergence") {
-    monitor = new RefinementMonitorConvergence(
-            errorDeclineThreshold, errorDeclineBufferSize, minRefInterval);
-  }
+  std::unique_ptr<RefinementMonitor> monitor = createRefinementMonitor(
+      refMonitor, refPeriod, errorDeclineThreshold, errorDeclineBufferSize, minRefInterval);
 
   // reduction factor for addaptive learning rate
   // double lGamma = 0.001;
@@ -147,6 +147,8 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
 
   // counts total number of processed data points
   size_t processedPoints = 0;
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
   // main loop which performs the learning process
   while (cntDataPasses < maxDataPasses) {
     for (size_t currIt = 0; currIt < trainData.getNrows(); currIt++) {
@@ -239,46 +241,10 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
         refinementsNecessary = monitor->refinementsNecessary();
       }
 
-      while (refinementsNecessary > 0) {
-        // acc = getAccuracy(testData, testLabels, 0.0);
-        // avgErrors.append(1.0 - acc);
-        std::cout << "refinement at iteration: " << processedPoints + 1
-                  << std::endl;
-
-        base::GridStorage& gridStorage = grid->getStorage();
-
-        HashRefinement refinement;
-
-        if (refType == "predictive") {
-          // predictive refinement based on error contributions
-          PredictiveRefinement decorator(&refinement);
-          getBatchError(*batchData, *batchLabels);
-          PredictiveRefinementIndicator indicator(*grid, *batchData,
-                                                  batchError, numPoints);
-          decorator.free_refine(gridStorage, indicator);
-        } else if (refType == "impurity") {
-          // impurity-based refinement
-          ImpurityRefinement decorator(&refinement);
-          sgpp::base::DataVector predictedLabels(batchData->getNrows());
-          predict(*batchData, predictedLabels);
-          ImpurityRefinementIndicator indicator(
-              *grid, *batchData, nullptr, nullptr, nullptr, predictedLabels,
-              threshold, numPoints);
-          decorator.free_refine(gridStorage, indicator);
-        }
-        alpha.resizeZero(grid->getSize());
-        alphaAvg.resizeZero(grid->getSize());
-
-        // required for ADAM
-        // m.resizeZero(grid->getSize());
-        // v.resizeZero(grid->getSize());
-
-        std::cout << "refinement step: " << refCnt + 1 << std::endl;
-        std::cout << "new grid size: " << grid->getSize() << std::endl;
-
-        refCnt++;
-        refinementsNecessary--;
-      }
+      // required for ADAM
+      // m.resizeZero(grid->getSize());
+      // v.resizeZero(grid->getSize());
+      performRefinements(refType, refinementsNecessary, refCnt, processedPoints);
 
       // save current error
       if ((processedPoints + 1) % 10 == 0) {
@@ -290,14 +256,251 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
     }
     cntDataPasses++;
   }
+  samplesPerSecond = static_cast<double>(processedPoints) / stopwatch.stop();
   std::cout << "# Training finished" << std::endl;
   std::cout << "final grid size: " << grid->getSize() << std::endl;
+  std::cout << "samples per second: " << samplesPerSecond << std::endl;
   // double mse = getError(testData, testLabels, "MSE");
   // std::cout << "MSE: " << mse << std::endl;
 
   error = 1.0 - getAccuracy(testData, testLabels, 0.0);
 }
 
+void LearnerSGD::trainMiniBatch(size_t maxDataPasses, size_t miniBatchSize, bool asynchronous,
+                                std::string refType, std::string refMonitor, size_t refPeriod,
+                                double errorDeclineThreshold, size_t errorDeclineBufferSize,
+                                size_t minRefInterval) {
+  if (miniBatchSize == 0) {
+    throw base::application_exception(
+        "LearnerSGD::trainMiniBatch : mini-batch size must be positive");
+  }
+
+  size_t dim = trainData.getNcols();
+  size_t numData = trainData.getNrows();
+  size_t numBatches = (numData + miniBatchSize - 1) / miniBatchSize;
+
+  // number of mini-batches which are processed concurrently
+  size_t numWorkers = 1;
+#ifdef _OPENMP
+  if (asynchronous) {
+    numWorkers = static_cast<size_t>(omp_get_max_threads());
+  }
+#endif
+
+  // refinement variables
+  size_t refNum = adaptivityConfig.numRefinements_;
+  size_t refCnt = 0;
+  double currentBatchError = 0.0;
+  double currentTrainError = 0.0;
+  std::unique_ptr<RefinementMonitor> monitor = createRefinementMonitor(
+      refMonitor, refPeriod, errorDeclineThreshold, errorDeclineBufferSize, minRefInterval);
+
+  // auxiliary variable for accuracy (error) measurement
+  double acc = getAccuracy(testData, testLabels, 0.0);
+  avgErrors.append(1.0 - acc);
+
+  // data points and evaluation operation of every worker
+  std::vector<MiniBatchWorkspace> workspaces(numWorkers);
+
+  // counts total number of processed data points and update rounds
+  size_t processedPoints = 0;
+  size_t steps = 0;
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
+  for (size_t cntDataPasses = 0; cntDataPasses < maxDataPasses; cntDataPasses++) {
+    for (size_t firstBatch = 0; firstBatch < numBatches; firstBatch += numWorkers) {
+      size_t lastBatch = std::min(firstBatch + numWorkers, numBatches);
+      bool concurrent = (lastBatch - firstBatch > 1);
+      double stepGamma = currentGamma;
+
+#pragma omp parallel for schedule(dynamic) if (concurrent)
+      for (size_t batch = firstBatch; batch < lastBatch; batch++) {
+#ifdef _OPENMP
+        const size_t worker = static_cast<size_t>(omp_get_thread_num());
+#else
+        const size_t worker = 0;
+#endif
+        size_t firstRow = batch * miniBatchSize;
+        miniBatchStep(firstRow, std::min(miniBatchSize, numData - firstRow), stepGamma,
+                      concurrent, workspaces[worker]);
+      }
+
+      size_t firstRow = firstBatch * miniBatchSize;
+      size_t endRow = std::min(lastBatch * miniBatchSize, numData);
+
+      // store data points in batch dataset used for checking
+      // predictive refinement criterion
+      if (!useValidData) {
+        sgpp::base::DataVector x(dim);
+
+        for (size_t i = firstRow; i < endRow; i++) {
+          trainData.getRow(i, x);
+          pushToBatch(x, trainLabels.get(i));
+        }
+      }
+
+      // learning rate according to L. Bottou
+      currentGamma =
+          gamma * std::pow((1 + gamma * lambda * static_cast<double>(processedPoints + endRow -
+                                                                     firstRow)),
+                           -0.75);
+
+      // smoothing according to L. Bottou (in terms of update rounds)
+      size_t roundsPerPass = (numBatches + numWorkers - 1) / numWorkers;
+      size_t t1 = (steps > dim + 1) ? steps - dim : 1;
+      size_t t2 = (steps > roundsPerPass + 1) ? steps - roundsPerPass : 1;
+      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
+      mu = 1.0 / mu;
+
+      alphaAvg.mult(1 - mu);
+      alphaAvg.axpy(mu, alpha);
+
+      size_t refinementsNecessary = 0;
+      if (refCnt < refNum && processedPoints > 0 && monitor) {
+        // check if refinement should be performed
+        currentBatchError = getError(*batchData, *batchLabels, "MSE");
+        currentTrainError = getError(trainData, trainLabels, "MSE");
+        monitor->pushToBuffer(endRow - firstRow, currentBatchError, currentTrainError);
+        refinementsNecessary = monitor->refinementsNecessary();
+      }
+
+      performRefinements(refType, refinementsNecessary, refCnt, processedPoints);
+
+      // save current error
+      if ((steps + 1) % 10 == 0) {
+        acc = getAccuracy(testData, testLabels, 0.0);
+        avgErrors.append(1.0 - acc);
+      }
+
+      processedPoints += endRow - firstRow;
+      steps++;
+    }
+  }
+
+  samplesPerSecond = static_cast<double>(processedPoints) / stopwatch.stop();
+  std::cout << "# Training finished" << std::endl;
+  std::cout << "final grid size: " << grid->getSize() << std::endl;
+  std::cout << "samples per second: " << samplesPerSecond << std::endl;
+
+  error = 1.0 - getAccuracy(testData, testLabels, 0.0);
+}
+
+double LearnerSGD::getSamplesPerSecond() const { return samplesPerSecond; }
+
+std::unique_ptr<RefinementMonitor> LearnerSGD::createRefinementMonitor(
+    std::string refMonitor, size_t refPeriod, double errorDeclineThreshold,
+    size_t errorDeclineBufferSize, size_t minRefInterval) {
+  std::unique_ptr<RefinementMonitor> monitor;
+  if (refMonitor == "periodic") {
+    monitor.reset(new RefinementMonitorPeriodic(refPeriod));
+  } else if (refMonitor == "convergence") {
+    monitor.reset(new RefinementMonitorConvergence(
+            errorDeclineThreshold, errorDeclineBufferSize, minRefInterval));
+  }
+  return monitor;
+}
+
+void LearnerSGD::performRefinements(const std::string& refType, size_t refinementsNecessary,
+                                    size_t& refCnt, size_t processedPoints) {
+  size_t numPoints = adaptivityConfig.noPoints_;
+  double threshold = adaptivityConfig.threshold_;
+
+  while (refinementsNecessary > 0) {
+    // acc = getAccuracy(testData, testLabels, 0.0);
+    // avgErrors.append(1.0 - acc);
+    std::cout << "refinement at iteration: " << processedPoints + 1
+              << std::endl;
+
+    base::GridStorage& gridStorage = grid->getStorage();
+
+    HashRefinement refinement;
+
+    if (refType == "predictive") {
+      // predictive refinement based on error contributions
+      PredictiveRefinement decorator(&refinement);
+      getBatchError(*batchData, *batchLabels);
+      PredictiveRefinementIndicator indicator(*grid, *batchData,
+                                              batchError, numPoints);
+      decorator.free_refine(gridStorage, indicator);
+    } else if (refType == "impurity") {
+      // impurity-based refinement
+      ImpurityRefinement decorator(&refinement);
+      sgpp::base::DataVector predictedLabels(batchData->getNrows());
+      predict(*batchData, predictedLabels);
+      ImpurityRefinementIndicator indicator(
+          *grid, *batchData, nullptr, nullptr, nullptr, predictedLabels,
+          threshold, numPoints);
+      decorator.free_refine(gridStorage, indicator);
+    }
+    alpha.resizeZero(grid->getSize());
+    alphaAvg.resizeZero(grid->getSize());
+
+    std::cout << "refinement step: " << refCnt + 1 << std::endl;
+    std::cout << "new grid size: " << grid->getSize() << std::endl;
+
+    refCnt++;
+    refinementsNecessary--;
+  }
+}
+
+void LearnerSGD::miniBatchStep(size_t firstRow, size_t numRows, double stepGamma,
+                               bool concurrent, MiniBatchWorkspace& workspace) {
+  size_t dim = trainData.getNcols();
+  size_t gridSize = alpha.getSize();
+
+  // copy the mini-batch into the dataset of the evaluation operation
+  sgpp::base::DataMatrix& batch = *workspace.batch;
+  batch.resize(numRows, dim);
+  std::copy(trainData.getPointer() + firstRow * dim,
+            trainData.getPointer() + (firstRow + numRows) * dim, batch.getPointer());
+
+  // the operation is recreated after refinements or if it cannot update its dataset
+  if ((workspace.multEval == nullptr) || (workspace.gridSize != grid->getSize()) ||
+      !workspace.multEval->updateDataset()) {
+    workspace.multEval.reset(op_factory::createOperationMultipleEval(*grid, batch));
+    workspace.gridSize = grid->getSize();
+  }
+
+  // consistent snapshot of the surpluses, as other threads might update them
+  sgpp::base::DataVector currentAlpha(gridSize);
+  if (concurrent) {
+    double* alphaPtr = alpha.getPointer();
+    for (size_t i = 0; i < gridSize; i++) {
+#pragma omp atomic read
+      currentAlpha[i] = alphaPtr[i];
+    }
+  } else {
+    currentAlpha = alpha;
+  }
+
+  // residuals and gradient of the squared error on the mini-batch
+  base::OperationMultipleEval& multEval = *workspace.multEval;
+  sgpp::base::DataVector residuals(numRows);
+  multEval.mult(currentAlpha, residuals);
+
+  for (size_t i = 0; i < numRows; i++) {
+    residuals[i] -= trainLabels.get(firstRow + i);
+  }
+
+  sgpp::base::DataVector delta(gridSize);
+  multEval.multTranspose(residuals, delta);
+
+  // SGD
+  double scale = stepGamma / static_cast<double>(numRows);
+  if (concurrent) {
+    double* alphaPtr = alpha.getPointer();
+    for (size_t i = 0; i < gridSize; i++) {
+      double update = -stepGamma * lambda * currentAlpha[i] - scale * delta[i];
+#pragma omp atomic
+      alphaPtr[i] += update;
+    }
+  } else {
+    alpha.mult(1 - stepGamma * lambda);
+    alpha.axpy(-scale, delta);
+  }
+}
+
 void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
   base::DataVector predictedLabels(testDataset.getNrows());
   predict(testDataset, predictedLabels);
@@ -355,14 +558,12 @@ void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
   // evaluate learned function at all points from values
   // and write result to csv file
   output.open("ASGD_fun_evals.csv");
-  std::unique_ptr<base::OperationEval> opEval(
-      op_factory::createOperationEval(*grid));
-  for (size_t i = 0; i < values.getNrows(); i++) {
-    // get next test sample x
-    base::DataVector x(2);
-    values.getRow(i, x);
-    double res = opEval->eval(alphaAvg, x);
-    output << res << ";" << std::endl;
+  base::DataVector evals(values.getNrows());
+  std::unique_ptr<base::OperationMultipleEval> opEval(
+      op_factory::createOperationMultipleEval(*grid, values));
+  opEval->mult(alphaAvg, evals);
+  for (size_t i = 0; i < evals.getSize(); i++) {
+    output << evals[i] << ";" << std::endl;
   }
   output.close();
 }
@@ -8,9 +8,12 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/algorithm/RefinementMonitor.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -84,6 +87,46 @@ class LearnerSGD {
              size_t refPeriod, double errorDeclineThreshold,
              size_t errorDeclineBufferSize, size_t minRefInterval);
 
+  /**
+   * Implements online learning using mini-batch stochastic gradient descent.
+   * The gradient of a mini-batch is computed with a single OperationMultipleEval
+   * (mult for the residuals, multTranspose for the gradient).
+   * If asynchronous updates are enabled, each OpenMP thread processes its own
+   * mini-batch and applies its update to the shared surpluses with atomic operations
+   * without waiting for the other threads (Hogwild). The averaging, the adaption
+   * of the learning rate, the refinement and the error measurements are performed
+   * after every round of concurrently processed mini-batches.
+   * In this case, the result depends on the scheduling of the threads.
+   * For miniBatchSize = 1 and synchronous updates, the updates are the same as in train().
+   *
+   * @param maxDataPasses The number of passes over the whole training data
+   * @param miniBatchSize The number of data points per gradient step
+   * @param asynchronous Specifies if mini-batches should be processed concurrently
+   * @param refType The refinement indicator (surplus, zero-crossings or
+   * data-based)
+   * @param refMonitor The refinement strategy (periodic or convergence-based)
+   * @param refPeriod The refinement interval (if periodic refinement is chosen)
+   * @param errorDeclineThreshold The convergence threshold
+   *        (if convergence-based refinement is chosen)
+   * @param errorDeclineBufferSize The number of error measurements which are
+   * used to check
+   *        convergence (if convergence-based refinement is chosen)
+   * @param minRefInterval The minimum number of data points which have to be
+   *        processed before next refinement can be scheduled (if
+   * convergence-based refinement
+   *        is chosen)
+   */
+  void trainMiniBatch(size_t maxDataPasses, size_t miniBatchSize, bool asynchronous,
+                      std::string refType, std::string refMonitor, size_t refPeriod,
+                      double errorDeclineThreshold, size_t errorDeclineBufferSize,
+                      size_t minRefInterval);
+
+  /**
+   * @return The number of processed training samples per second
+   * during the last call of train() or trainMiniBatch()
+   */
+  double getSamplesPerSecond() const;
+
   /**
    * Computes the classification accuracy on the given dataset.
    *
@@ -158,6 +201,62 @@ class LearnerSGD {
   void predict(base::DataMatrix& testData,
                base::DataVector& predictedLabels);
 
+  /**
+   * Creates the refinement monitor.
+   *
+   * @param refMonitor The refinement strategy (periodic or convergence-based)
+   * @param refPeriod The refinement interval (if periodic refinement is chosen)
+   * @param errorDeclineThreshold The convergence threshold
+   * @param errorDeclineBufferSize The number of error measurements used to check convergence
+   * @param minRefInterval The minimum number of data points between two refinements
+   * @return The refinement monitor (nullptr if refMonitor is unknown)
+   */
+  std::unique_ptr<RefinementMonitor> createRefinementMonitor(std::string refMonitor,
+                                                             size_t refPeriod,
+                                                             double errorDeclineThreshold,
+                                                             size_t errorDeclineBufferSize,
+                                                             size_t minRefInterval);
+
+  /**
+   * Refines the grid and resizes the surplus vectors.
+   *
+   * @param refType The refinement indicator
+   * @param refinementsNecessary The number of refinement steps to perform
+   * @param refCnt The number of refinement steps so far (is incremented)
+   * @param processedPoints The number of processed data points
+   */
+  void performRefinements(const std::string& refType, size_t refinementsNecessary,
+                          size_t& refCnt, size_t processedPoints);
+
+  /**
+   * Data points and evaluation operation of the mini-batches of one worker,
+   * which are kept across the gradient steps.
+   */
+  struct MiniBatchWorkspace {
+    MiniBatchWorkspace() : batch(new base::DataMatrix(0, 0)), multEval(nullptr), gridSize(0) {}
+
+    /// data points of the current mini-batch (the operation holds a reference to it)
+    std::unique_ptr<base::DataMatrix> batch;
+    /// evaluation operation bound to batch (null if it has to be created)
+    std::unique_ptr<base::OperationMultipleEval> multEval;
+    /// size of the grid when multEval has been created
+    size_t gridSize;
+  };
+
+  /**
+   * Performs a gradient step for a mini-batch of training data points.
+   * The evaluation operation of the workspace is reused if the grid has not changed
+   * and the operation supports updating its data set.
+   *
+   * @param firstRow The index of the first data point of the mini-batch
+   * @param numRows The number of data points of the mini-batch
+   * @param stepGamma The learning rate
+   * @param concurrent Specifies if other threads update the surpluses at the same time
+   * @param workspace The data points and evaluation operation of the calling worker
+   */
+  void miniBatchStep(size_t firstRow, size_t numRows, double stepGamma, bool concurrent,
+                     MiniBatchWorkspace& workspace);
+
   /**
    * Stores the last 'batchSize' processed data points
    * if no validation data is provided.
@@ -188,6 +287,8 @@ class LearnerSGD {
   size_t batchSize;
 
   bool useValidData;
+
+  double samplesPerSecond;
 };
 
 }  // namespace datadriven
@@ -31,6 +31,10 @@ struct CrossvalidationConfiguration {
   // must be > 1
   size_t lambdaSteps_ = 0;
   bool logScale_ = false;  // search the optimization interval on a log-scale
+
+  // parallelization of k-fold cross-validation
+  size_t parallelFolds_ = 1;  // number of folds trained concurrently (0: one per thread)
+  size_t threadBudget_ = 0;   // total number of threads (0: maximal number of OpenMP threads)
 };
 
 }  // namespace datadriven
@@ -37,6 +37,11 @@ struct DensityEstimationConfiguration {
   size_t iCholSweepsRefine_ = 4;
   size_t iCholSweepsUpdateLambda_ = 2;
   size_t iCholSweepsSolver_ = 2;
+
+  // Combination technique: number of component grids fitted concurrently (0: one per thread)
+  size_t parallelComponents_ = 1;
+  // Combination technique: total number of threads (0: maximal number of OpenMP threads)
+  size_t threadBudget_ = 0;
 };
 
 }  // namespace datadriven
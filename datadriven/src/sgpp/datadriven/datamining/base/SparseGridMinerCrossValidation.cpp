@@ -7,8 +7,10 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -36,101 +38,19 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   const CrossvalidationConfiguration& crossValidationConfig =
       dataSource->getCrossValidationConfig();
 
-  std::vector<double> scores;
-  scores.reserve(crossValidationConfig.kfold_);
+  std::vector<double> scores(crossValidationConfig.kfold_);
 
-  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
-    dataSource->setFold(fold);
+  // train the folds concurrently if workers are available
+  const size_t requestedWorkers =
+      TrialScheduler(crossValidationConfig.parallelFolds_, crossValidationConfig.threadBudget_)
+          .getNumberOfWorkers();
+  TrialScheduler scheduler(std::min(requestedWorkers, workers.size() + 1),
+                           crossValidationConfig.threadBudget_);
 
-    // todo(fuchsgdk):
-    // This is the kind of cv implemented by Lettrich in the scorer class and it was
-    // merely moved to fit into the data source. Conceptual changes might be done in order to
-    // really support batch based learning with cv and not only regression.
-    // What should be done is reimplementing the data source such that it provides batches
-
-    std::ostringstream out;
-    out << "###############"
-        << "Fold #" << fold;
-    print(out);
-
-    // Create a refinement monitor for this fold
-    RefinementMonitorFactory monitorFactory;
-    RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-        fitter->getFitterConfiguration().getRefinementConfig());
-
-    // Reset the fitter
-    fitter->reset();
-
-    for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
-      if (verbose) {
-        std::ostringstream out;
-        out << "###############"
-            << "Starting training epoch #" << epoch;
-        print(out);
-      }
-      dataSource->reset();
-      Dataset* validationData = dataSource->getValidationData();
-      size_t validationSize = validationData->getNumberInstances();
-
-      if (verbose) {
-        std::ostringstream out;
-        out << "Validation data size: " << validationSize;
-        print(out);
-      }
-      // Process dataset iteratively
-      size_t iteration = 0;
-      while (true) {
-        std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
-        size_t numInstances = dataset->getNumberInstances();
-        if (numInstances == 0) {
-          // The source does not provide any more samples
-          break;
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration #" << (iteration) << std::endl
-              << "Batch size: " << numInstances;
-          print(out);
-        }
-
-        // Train model on new batch
-        fitter->update(*dataset);
-
-        // Evaluate the score on the training and validation data
-        double scoreTrain = scorer->test(*fitter, *dataset);
-        double scoreVal = scorer->test(*fitter, *validationData);
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "Score on batch: " << scoreTrain << std::endl
-              << "Score on validation data: " << scoreVal;
-          print(out);
-        }
-
-        visualizer->runVisualization(*fitter, *dataSource, fold, iteration);
-        // Refine the model if neccessary
-        monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
-        size_t refinements = monitor->refinementsNecessary();
-        while (refinements--) {
-          fitter->refine();
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration finished.";
-          print(out);
-        }
-        iteration++;
-      }
-    }
-    // Evaluate the final score on the validation data
-    dataSource->reset();
-    Dataset* validationData = dataSource->getValidationData();
-    scores.push_back(scorer->test(*fitter, *validationData));
-  }
+  scheduler.run(crossValidationConfig.kfold_, [this, &scores, verbose](size_t worker, size_t fold) {
+    SparseGridMinerCrossValidation& miner = ((worker == 0) ? *this : *workers[worker - 1]);
+    scores[fold] = miner.learnFold(fold, verbose);
+  });
 
   // Calculate mean score and std deviation
   double meanScore = 0.0;
@@ -151,5 +71,103 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   print(out);
   return meanScore;
 }
+
+double SparseGridMinerCrossValidation::learnFold(size_t fold, bool verbose) {
+  dataSource->setFold(fold);
+
+  // todo(fuchsgdk):
+  // This is the kind of cv implemented by Lettrich in the scorer class and it was
+  // merely moved to fit into the data source. Conceptual changes might be done in order to
+  // really support batch based learning with cv and not only regression.
+  // What should be done is reimplementing the data source such that it provides batches
+
+  std::ostringstream out;
+  out << "###############"
+      << "Fold #" << fold;
+  print(out);
+
+  // Create a refinement monitor for this fold
+  RefinementMonitorFactory monitorFactory;
+  RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
+      fitter->getFitterConfiguration().getRefinementConfig());
+
+  // Reset the fitter
+  fitter->reset();
+
+  for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
+    if (verbose) {
+      std::ostringstream out;
+      out << "###############"
+          << "Starting training epoch #" << epoch;
+      print(out);
+    }
+    dataSource->reset();
+    Dataset* validationData = dataSource->getValidationData();
+    size_t validationSize = validationData->getNumberInstances();
+
+    if (verbose) {
+      std::ostringstream out;
+      out << "Validation data size: " << validationSize;
+      print(out);
+    }
+    // Process dataset iteratively
+    size_t iteration = 0;
+    while (true) {
+      std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
+      size_t numInstances = dataset->getNumberInstances();
+      if (numInstances == 0) {
+        // The source does not provide any more samples
+        break;
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Iteration #" << (iteration) << std::endl
+            << "Batch size: " << numInstances;
+        print(out);
+      }
+
+      // Train model on new batch
+      fitter->update(*dataset);
+
+      // Evaluate the score on the training and validation data
+      double scoreTrain = scorer->test(*fitter, *dataset);
+      double scoreVal = scorer->test(*fitter, *validationData);
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "Score on batch: " << scoreTrain << std::endl
+            << "Score on validation data: " << scoreVal;
+        print(out);
+      }
+
+      visualizer->runVisualization(*fitter, *dataSource, fold, iteration);
+      // Refine the model if neccessary
+      monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
+      size_t refinements = monitor->refinementsNecessary();
+      while (refinements--) {
+        fitter->refine();
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Iteration finished.";
+        print(out);
+      }
+      iteration++;
+    }
+  }
+  // Evaluate the final score on the validation data
+  dataSource->reset();
+  Dataset* validationData = dataSource->getValidationData();
+  return scorer->test(*fitter, *validationData);
+}
+
+void SparseGridMinerCrossValidation::addWorker(SparseGridMinerCrossValidation* worker) {
+  workers.emplace_back(worker);
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -9,6 +9,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -72,12 +73,35 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
    */
   double learn(bool verbose) override;
 
+  /**
+   * Adds a worker that trains folds concurrently to this miner (see
+   * CrossvalidationConfiguration::parallelFolds_). The worker has to be configured like this miner,
+   * but with its own data source, fitter, scorer, and visualizer. The fitter of this miner
+   * contains the model of the last fold after learn() has been called.
+   * @param worker miner for the worker. The miner instance will take ownership of the passed
+   * object.
+   */
+  void addWorker(SparseGridMinerCrossValidation* worker);
+
  private:
+  /**
+   * Trains the model on one fold and evaluates it on the validation data of the fold.
+   * @param fold index of the fold
+   * @param verbose whether to print information about the training
+   * @return score on the validation data
+   */
+  double learnFold(size_t fold, bool verbose);
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
    */
   std::unique_ptr<DataSourceCrossValidation> dataSource;
+
+  /**
+   * Miners that train further folds concurrently.
+   */
+  std::vector<std::unique_ptr<SparseGridMinerCrossValidation>> workers;
 };
 
 } /* namespace datadriven */
@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+TrialScheduler::TrialScheduler(size_t numWorkers, size_t threadBudget)
+    : numWorkers(numWorkers), threadsPerWorker(1), hasThreadBudget(threadBudget > 0) {
+  size_t budget = threadBudget;
+
+  if (budget == 0) {
+#ifdef _OPENMP
+    budget = static_cast<size_t>(omp_get_max_threads());
+#else
+    budget = 1;
+#endif
+  }
+
+  if (this->numWorkers == 0) {
+    this->numWorkers = budget;
+  }
+
+  threadsPerWorker = std::max<size_t>(budget / this->numWorkers, 1);
+}
+
+size_t TrialScheduler::getNumberOfWorkers() const { return numWorkers; }
+
+size_t TrialScheduler::getThreadsPerWorker() const { return threadsPerWorker; }
+
+void TrialScheduler::run(size_t numTrials,
+                         const std::function<void(size_t worker, size_t trial)>& trial) const {
+  const size_t curNumWorkers = std::min(numWorkers, numTrials);
+
+  if (curNumWorkers <= 1) {
+    // serial execution in the calling thread
+#ifdef _OPENMP
+    const int maxThreads = omp_get_max_threads();
+
+    if (hasThreadBudget) {
+      omp_set_num_threads(static_cast<int>(threadsPerWorker));
+    }
+#endif
+
+    for (size_t i = 0; i < numTrials; i++) {
+      trial(0, i);
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif
+    return;
+  }
+
+  std::vector<std::exception_ptr> exceptions(numTrials);
+
+  auto runWorker = [&](size_t worker) {
+    for (size_t i = 0; i < numTrials; i++) {
+      if ((numTrials - 1 - i) % curNumWorkers == worker) {
+        try {
+          trial(worker, i);
+        } catch (...) {
+          exceptions[i] = std::current_exception();
+        }
+      }
+    }
+  };
+
+#ifdef _OPENMP
+  // allow the workers to open parallel regions themselves
+  const int maxActiveLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(maxActiveLevels, omp_get_level() + 2));
+
+#pragma omp parallel num_threads(static_cast<int>(curNumWorkers))
+  {
+    omp_set_num_threads(static_cast<int>(threadsPerWorker));
+
+    // the team might be smaller than requested
+    for (size_t worker = static_cast<size_t>(omp_get_thread_num()); worker < curNumWorkers;
+         worker += static_cast<size_t>(omp_get_num_threads())) {
+      runWorker(worker);
+    }
+  }
+
+  omp_set_max_active_levels(maxActiveLevels);
+#else
+  for (size_t worker = 0; worker < curNumWorkers; worker++) {
+    runWorker(worker);
+  }
+#endif
+
+  for (size_t i = 0; i < numTrials; i++) {
+    if (exceptions[i]) {
+      std::rethrow_exception(exceptions[i]);
+    }
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * TrialScheduler runs independent trials (e.g., the folds of a cross-validation or the
+ * configurations of a hyperparameter optimization) concurrently. A thread budget is split between
+ * the outer parallelism (workers that run one trial at a time) and the inner parallelism (OpenMP
+ * threads of the operations used by each trial).
+ *
+ * Every worker owns its own resources (e.g., miners with cloned data sources and fitters), which
+ * are identified by the worker index passed to the trial function. The assignment of trials to
+ * workers is static and the last trial is always run by worker 0, which uses the resources of the
+ * caller. Results should be stored per trial index, which makes them independent of the number of
+ * workers.
+ */
+class TrialScheduler {
+ public:
+  /**
+   * Constructor
+   * @param numWorkers number of trials that are run concurrently (0: one worker per thread of the
+   * thread budget)
+   * @param threadBudget total number of threads (0: maximal number of OpenMP threads)
+   */
+  explicit TrialScheduler(size_t numWorkers = 1, size_t threadBudget = 0);
+
+  /**
+   * @return number of workers
+   */
+  size_t getNumberOfWorkers() const;
+
+  /**
+   * @return number of threads each worker uses for its inner parallel regions
+   */
+  size_t getThreadsPerWorker() const;
+
+  /**
+   * Runs trial(worker, i) for all trials i = 0, ..., numTrials - 1. Worker w runs the trials i
+   * with (numTrials - 1 - i) mod numWorkers = w in increasing order. If trials throw exceptions,
+   * the exception of the trial with the smallest index is rethrown after all trials are finished.
+   * @param numTrials number of trials
+   * @param trial function that runs a trial with the resources of the given worker
+   */
+  void run(size_t numTrials, const std::function<void(size_t worker, size_t trial)>& trial) const;
+
+ private:
+  /**
+   * Number of workers
+   */
+  size_t numWorkers;
+  /**
+   * Number of threads per worker
+   */
+  size_t threadsPerWorker;
+  /**
+   * Whether the thread budget has been specified explicitly
+   */
+  bool hasThreadBudget;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -14,6 +14,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorFactory.hpp>
 
 #include <algorithm>
@@ -31,6 +32,11 @@ DataSourceBuilder& DataSourceBuilder::withFileType(DataSourceFileType fileType)
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withStreaming(bool isStreaming) {
+  config.isStreaming = isStreaming;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::inBatches(size_t howMany) {
   config.numBatches = howMany;
   return *this;
@@ -69,7 +75,11 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
 
   SampleProvider* sampleProvider = nullptr;
 
-  if (config.fileType == DataSourceFileType::ARFF) {
+  if (config.isStreaming || (config.fileType == DataSourceFileType::BINARY)) {
+    // the samples are provided in the order of the file
+    delete shuffling;
+    sampleProvider = new StreamingFileSampleProvider(config.fileType);
+  } else if (config.fileType == DataSourceFileType::ARFF) {
     sampleProvider = new ArffFileSampleProvider(shuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(shuffling);
@@ -99,6 +109,10 @@ DataSourceSplitting* DataSourceBuilder::splittingFromConfig(const DataSourceConf
 }
 
 DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
+  if (config.isStreaming || (config.fileType == DataSourceFileType::BINARY)) {
+    throw data_exception("Cross validation is not supported for streaming data sources");
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor *shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -50,6 +50,15 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withFileType(DataSourceFileType fileType);
 
+  /**
+   * Optionally specify if the samples should be read lazily from disk (see
+   * #sgpp::datadriven::StreamingFileSampleProvider). This is set to false by default.
+   * Shuffling and cross validation are not supported for streaming data sources.
+   * @param isStreaming true if the samples should be streamed, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withStreaming(bool isStreaming);
+
   /**
    * Optionally Specify the amount of batches if batch learning is used. If no batch learning is
    * used, all data is returned as a single batch (same as howMany=1).
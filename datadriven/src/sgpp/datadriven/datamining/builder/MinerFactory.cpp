@@ -8,6 +8,7 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMinerCrossValidation.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMinerSplitting.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 #include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
 #include <sgpp/datadriven/datamining/builder/ScorerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfiguration.hpp>
@@ -16,6 +17,7 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
+#include <algorithm>
 #include <string>
 
 namespace sgpp {
@@ -25,9 +27,26 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
   DataMiningConfigParser parser(path);
 
   if (parser.hasFitterConfigCrossValidation()) {
-     return new SparseGridMinerCrossValidation(createDataSourceCrossValidation(parser),
-                                               createFitter(parser), createScorer(parser),
-                                               createVisualizer(parser));
+    auto miner = new SparseGridMinerCrossValidation(createDataSourceCrossValidation(parser),
+                                                    createFitter(parser), createScorer(parser),
+                                                    createVisualizer(parser));
+
+    // every worker that trains folds concurrently needs its own data source and fitter
+    CrossvalidationConfiguration crossValidationConfig{};
+    parser.getFitterCrossvalidationConfig(crossValidationConfig, crossValidationConfig);
+    const size_t numWorkers = std::min(
+        TrialScheduler(crossValidationConfig.parallelFolds_, crossValidationConfig.threadBudget_)
+            .getNumberOfWorkers(),
+        crossValidationConfig.kfold_);
+
+    for (size_t worker = 1; worker < numWorkers; worker++) {
+      miner->addWorker(new SparseGridMinerCrossValidation(createDataSourceCrossValidation(parser),
+                                                          createFitter(parser),
+                                                          createScorer(parser),
+                                                          createVisualizer(parser)));
+    }
+
+    return miner;
   } else {
      return new SparseGridMinerSplitting(createDataSourceSplitting(parser), createFitter(parser),
                                          createScorer(parser),
@@ -37,11 +56,22 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
+  HyperparameterOptimizer* hpo;
+
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    hpo = new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
+                                               parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    hpo = new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+  }
+
+  addWorkerMiners(*hpo, path);
+  return hpo;
+}
+
+void MinerFactory::addWorkerMiners(HyperparameterOptimizer& hpo, const std::string& path) const {
+  for (size_t worker = 1; worker < hpo.getNumberOfWorkers(); worker++) {
+    hpo.addWorkerMiner(buildMiner(path));
   }
 }
 
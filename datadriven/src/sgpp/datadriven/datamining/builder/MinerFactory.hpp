@@ -85,6 +85,13 @@ class MinerFactory {
    * @return the scorer instance
    */
   virtual Visualizer* createVisualizer(const DataMiningConfigParser& parser) const = 0;
+
+  /**
+   * Adds miners for the workers of a hyperparameter optimizer that run trials concurrently.
+   * @param hpo the hyperparameter optimizer
+   * @param path Path to the configuration file the miners are built from
+   */
+  void addWorkerMiners(HyperparameterOptimizer& hpo, const std::string& path) const;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -123,6 +123,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath = parseString(*dataSourceConfig, "filePath", defaults.filePath, "dataSource");
     config.isCompressed =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed, "dataSource");
+    config.isStreaming =
+        parseBool(*dataSourceConfig, "streaming", defaults.isStreaming, "dataSource");
     config.numBatches =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches, "dataSource");
     config.batchSize = parseUInt(*dataSourceConfig, "batchSize", defaults.batchSize, "dataSource");
@@ -397,6 +399,10 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseUInt(*crossvalidationConfig, "lambdaSteps", defaults.lambdaSteps_, "crossValidation");
     config.logScale_ =
         parseBool(*crossvalidationConfig, "logScale", defaults.logScale_, "crossValidation");
+    config.parallelFolds_ = parseUInt(*crossvalidationConfig, "parallelFolds",
+                                      defaults.parallelFolds_, "crossValidation");
+    config.threadBudget_ = parseUInt(*crossvalidationConfig, "threadBudget",
+                                     defaults.threadBudget_, "crossValidation");
   } else {
     std::cout << "# Could not find specification  of fitter[crossvalidationConfig]. Falling "
                  "Back to default values."
@@ -432,6 +438,12 @@ bool DataMiningConfigParser::getFitterDensityEstimationConfig(
         parseBool(*densityEstimationConfig, "useOfflinePermutation", defaults.useOfflinePermutation,
                   "densityEstimationConfig");
 
+    config.parallelComponents_ =
+        parseUInt(*densityEstimationConfig, "parallelComponents", defaults.parallelComponents_,
+                  "densityEstimationConfig");
+    config.threadBudget_ = parseUInt(*densityEstimationConfig, "threadBudget",
+                                     defaults.threadBudget_, "densityEstimationConfig");
+
     // parse  density estimation type
     if (densityEstimationConfig->contains("densityEstimationType")) {
       config.type_ = DensityEstimationTypeParser::parse(
@@ -933,6 +945,9 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setParallelTrials(
+        parseInt(*node, "parallelTrials", config.getParallelTrials(), "hpo"));
+    config.setThreadBudget(parseInt(*node, "threadBudget", config.getThreadBudget(), "hpo"));
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
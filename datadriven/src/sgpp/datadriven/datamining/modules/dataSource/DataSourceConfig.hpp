@@ -15,8 +15,9 @@ namespace datadriven {
 
 /**
  * Supported file types for sgpp::datadriven::FileSampleProvider
+ * (BINARY is the columnar format of sgpp::datadriven::StreamingFileSampleProvider)
  */
-enum class DataSourceFileType { NONE, ARFF, CSV };
+enum class DataSourceFileType { NONE, ARFF, CSV, BINARY };
 
 /**
  * Enumeration of all supported shuffling types used to permute samples in a dataset. An entry
@@ -42,6 +43,11 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed = false;
+  /**
+   * Read the batches lazily from disk (see #sgpp::datadriven::StreamingFileSampleProvider)
+   * instead of loading the whole dataset into memory. Always true for binary files.
+   */
+  bool isStreaming = false;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
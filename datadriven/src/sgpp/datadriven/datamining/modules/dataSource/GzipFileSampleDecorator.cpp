@@ -9,6 +9,7 @@
 
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
 
 #include <zlib.h>
 #include <string>
@@ -29,6 +30,15 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
                                        size_t readinCutoff,
                                        std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
+  // streaming providers decompress the file lazily
+  auto streamingProvider = dynamic_cast<StreamingFileSampleProvider*>(fileSampleProvider.get());
+
+  if (streamingProvider != nullptr) {
+    streamingProvider->readCompressedFile(fileName, hasTargets, readinCutoff, readinColumns,
+                                          readinClasses);
+    return;
+  }
+
   gzFile inFileZ = gzopen(fileName.c_str(), "rb");
 
   if (inFileZ == nullptr) {
@@ -57,8 +67,7 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
     readinCutoff, readinColumns, readinClasses);
 }
 
-void GzipFileSampleDecorator::reset() {
-}
+void GzipFileSampleDecorator::reset() { fileSampleProvider->reset(); }
 
 } /* namespace datadriven */
 } /* namespace sgpp */
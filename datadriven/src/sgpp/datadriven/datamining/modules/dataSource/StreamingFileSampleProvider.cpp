@@ -0,0 +1,708 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef ZLIB
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// number of characters read at once
+const size_t readBlockSize = 1 << 22;
+
+/// magic string at the beginning of binary files
+const char binaryMagic[8] = {'S', 'G', 'P', 'P', 'D', 'S', '0', '1'};
+
+class FileReader : public StreamingFileSampleProvider::Reader {
+ public:
+  explicit FileReader(const std::string& filePath)
+      : stream(filePath.c_str(), std::ios::in | std::ios::binary) {
+    if (!stream) {
+      throw base::file_exception(("Unable to open file: " + filePath).c_str());
+    }
+  }
+
+  size_t read(char* buffer, size_t size) override {
+    stream.read(buffer, static_cast<std::streamsize>(size));
+    return static_cast<size_t>(stream.gcount());
+  }
+
+ private:
+  std::ifstream stream;
+};
+
+#ifdef ZLIB
+class GzipReader : public StreamingFileSampleProvider::Reader {
+ public:
+  explicit GzipReader(const std::string& filePath) : file(gzopen(filePath.c_str(), "rb")) {
+    if (file == nullptr) {
+      throw base::file_exception("failed to open Gzip compressed file.");
+    }
+  }
+
+  ~GzipReader() override { gzclose(file); }
+
+  size_t read(char* buffer, size_t size) override {
+    const int numberOfBytes = gzread(
+        file, buffer,
+        static_cast<unsigned int>(std::min<size_t>(size, std::numeric_limits<int>::max())));
+
+    if (numberOfBytes < 0) {
+      throw base::file_exception("failed to read Gzip compressed file.");
+    }
+
+    return static_cast<size_t>(numberOfBytes);
+  }
+
+ private:
+  gzFile file;
+};
+#endif
+
+class StringReader : public StreamingFileSampleProvider::Reader {
+ public:
+  explicit StringReader(std::shared_ptr<const std::string> content)
+      : content(content), position(0) {}
+
+  size_t read(char* buffer, size_t size) override {
+    const size_t numberOfBytes = std::min(size, content->size() - position);
+    std::memcpy(buffer, content->data() + position, numberOfBytes);
+    position += numberOfBytes;
+    return numberOfBytes;
+  }
+
+ private:
+  std::shared_ptr<const std::string> content;
+  size_t position;
+};
+
+/**
+ * @param dataset   dataset
+ * @param begin     first row
+ * @param count     number of rows
+ * @return new dataset with the given rows
+ */
+Dataset* copyRows(const Dataset& dataset, size_t begin, size_t count) {
+  const size_t dim = dataset.getDimension();
+  Dataset* result = new Dataset(count, dim);
+  std::copy(dataset.getData().data() + begin * dim, dataset.getData().data() + (begin + count) * dim,
+            result->getData().data());
+  std::copy(dataset.getTargets().data() + begin, dataset.getTargets().data() + begin + count,
+            result->getTargets().data());
+  return result;
+}
+
+/**
+ * @param first   first dataset (may be empty)
+ * @param second  second dataset (may be empty)
+ * @return dataset with the rows of both datasets
+ */
+std::unique_ptr<Dataset> concatenate(std::unique_ptr<Dataset> first,
+                                     std::unique_ptr<Dataset> second) {
+  if (!first || (first->getNumberInstances() == 0)) {
+    return second;
+  } else if (!second || (second->getNumberInstances() == 0)) {
+    return first;
+  }
+
+  const size_t dim = first->getDimension();
+  const size_t firstSize = first->getNumberInstances();
+  const size_t secondSize = second->getNumberInstances();
+  std::unique_ptr<Dataset> result(new Dataset(firstSize + secondSize, dim));
+  std::copy(first->getData().data(), first->getData().data() + firstSize * dim,
+            result->getData().data());
+  std::copy(second->getData().data(), second->getData().data() + secondSize * dim,
+            result->getData().data() + firstSize * dim);
+  std::copy(first->getTargets().data(), first->getTargets().data() + firstSize,
+            result->getTargets().data());
+  std::copy(second->getTargets().data(), second->getTargets().data() + secondSize,
+            result->getTargets().data() + firstSize);
+  return result;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------------
+
+struct StreamingFileSampleProvider::Input {
+  std::unique_ptr<Reader> reader;
+  /// characters that have been read, but not yet parsed
+  std::vector<char> pending;
+  bool isEndOfInput = false;
+
+  /// binary format: header
+  size_t numberInstances = 0;
+  size_t numberOfColumns = 0;
+  bool hasTargets = false;
+  size_t rowsPerBlock = 0;
+  /// binary format: number of rows of all read blocks
+  size_t readRows = 0;
+  /// binary format: current block
+  std::vector<double> block;
+  size_t blockRows = 0;
+  size_t blockPosition = 0;
+
+  /**
+   * Appends the next characters of the input to pending.
+   *
+   * @return whether characters could be read
+   */
+  bool fill() {
+    if (isEndOfInput) {
+      return false;
+    }
+
+    const size_t oldSize = pending.size();
+    pending.resize(oldSize + readBlockSize);
+    const size_t numberOfBytes = reader->read(pending.data() + oldSize, readBlockSize);
+    pending.resize(oldSize + numberOfBytes);
+    isEndOfInput = (numberOfBytes == 0);
+    return !isEndOfInput;
+  }
+
+  /**
+   * @return number of characters of pending that belong to complete lines
+   */
+  size_t getCompleteLength() const {
+    if (isEndOfInput) {
+      return pending.size();
+    }
+
+    for (size_t i = pending.size(); i > 0; i--) {
+      if (pending[i - 1] == '\n') {
+        return i;
+      }
+    }
+
+    return 0;
+  }
+
+  /**
+   * Removes the first non-empty line (header of CSV files).
+   */
+  void skipFirstLine() {
+    size_t lineBegin = 0;
+
+    while (true) {
+      const size_t completeLength = getCompleteLength();
+
+      while (lineBegin < completeLength) {
+        size_t lineEnd = lineBegin;
+
+        while ((lineEnd < completeLength) && (pending[lineEnd] != '\n')) {
+          lineEnd++;
+        }
+
+        const bool isEmpty = (lineEnd == lineBegin) ||
+                             ((lineEnd == lineBegin + 1) && (pending[lineBegin] == '\r'));
+        lineBegin = std::min(lineEnd + 1, completeLength);
+
+        if (!isEmpty) {
+          pending.erase(pending.begin(), pending.begin() + lineBegin);
+          return;
+        }
+      }
+
+      if (!fill()) {
+        pending.clear();
+        return;
+      }
+    }
+  }
+
+  void readExactly(char* buffer, size_t size) {
+    while (size > 0) {
+      const size_t numberOfBytes = reader->read(buffer, size);
+
+      if (numberOfBytes == 0) {
+        throw base::file_exception("StreamingFileSampleProvider: unexpected end of binary file");
+      }
+
+      buffer += numberOfBytes;
+      size -= numberOfBytes;
+    }
+  }
+
+  void readBinaryHeader() {
+    char magic[sizeof(binaryMagic)];
+    std::uint64_t header[4];
+    readExactly(magic, sizeof(magic));
+
+    if (std::memcmp(magic, binaryMagic, sizeof(magic)) != 0) {
+      throw base::file_exception("StreamingFileSampleProvider: invalid binary file");
+    }
+
+    readExactly(reinterpret_cast<char*>(header), sizeof(header));
+    numberInstances = static_cast<size_t>(header[0]);
+    numberOfColumns = static_cast<size_t>(header[1]);
+    hasTargets = (header[2] != 0);
+    rowsPerBlock = static_cast<size_t>(header[3]);
+
+    if ((rowsPerBlock == 0) && (numberInstances > 0)) {
+      throw base::file_exception("StreamingFileSampleProvider: invalid binary file");
+    }
+  }
+
+  /**
+   * Reads the next block of a binary file.
+   *
+   * @return whether there was a block left
+   */
+  bool readBinaryBlock() {
+    if (readRows >= numberInstances) {
+      return false;
+    }
+
+    blockRows = std::min(rowsPerBlock, numberInstances - readRows);
+    block.resize(blockRows * (numberOfColumns + (hasTargets ? 1 : 0)));
+    readExactly(reinterpret_cast<char*>(block.data()), block.size() * sizeof(double));
+    readRows += blockRows;
+    blockPosition = 0;
+    return true;
+  }
+};
+
+// ----------------------------------------------------------------------------------
+
+StreamingFileSampleProvider::StreamingFileSampleProvider(DataSourceFileType fileType)
+    : fileType(fileType),
+      source(Source::NONE),
+      hasTargets(true),
+      readinCutoff(-1),
+      dimension(0),
+      numSamples(-1),
+      numberOfReadSamples(0),
+      isExhausted(true) {
+  if (fileType == DataSourceFileType::NONE) {
+    throw base::data_exception("StreamingFileSampleProvider: unknown file type");
+  }
+}
+
+StreamingFileSampleProvider::StreamingFileSampleProvider(const StreamingFileSampleProvider& rhs)
+    : StreamingFileSampleProvider(rhs.fileType) {
+  if (rhs.source != Source::NONE) {
+    open(rhs.source, rhs.filePath, rhs.content, rhs.hasTargets, rhs.readinCutoff,
+         rhs.readinColumns, rhs.readinClasses);
+  }
+}
+
+StreamingFileSampleProvider::~StreamingFileSampleProvider() {
+  try {
+    waitForPrefetch();
+  } catch (...) {
+    // errors of a batch that is not used anymore are irrelevant
+  }
+}
+
+SampleProvider* StreamingFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider*>(new StreamingFileSampleProvider{*this});
+}
+
+void StreamingFileSampleProvider::readFile(const std::string& filePath, bool hasTargets,
+                                           size_t readinCutoff,
+                                           std::vector<size_t> readinColumns,
+                                           std::vector<double> readinClasses) {
+  open(Source::FILE, filePath, nullptr, hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
+void StreamingFileSampleProvider::readCompressedFile(const std::string& filePath,
+                                                     bool hasTargets, size_t readinCutoff,
+                                                     std::vector<size_t> readinColumns,
+                                                     std::vector<double> readinClasses) {
+#ifndef ZLIB
+  throw sgpp::base::application_exception{
+      "sgpp has been built without zlib support. Reading compressed files is not possible"};
+#else
+  open(Source::COMPRESSED_FILE, filePath, nullptr, hasTargets, readinCutoff, readinColumns,
+       readinClasses);
+#endif
+}
+
+void StreamingFileSampleProvider::readString(const std::string& input, bool hasTargets,
+                                             size_t readinCutoff,
+                                             std::vector<size_t> readinColumns,
+                                             std::vector<double> readinClasses) {
+  open(Source::STRING, "", std::make_shared<const std::string>(input), hasTargets, readinCutoff,
+       readinColumns, readinClasses);
+}
+
+void StreamingFileSampleProvider::open(Source source, const std::string& filePath,
+                                       std::shared_ptr<const std::string> content,
+                                       bool hasTargets, size_t readinCutoff,
+                                       std::vector<size_t> readinColumns,
+                                       std::vector<double> readinClasses) {
+  waitForPrefetch();
+  this->source = source;
+  this->filePath = filePath;
+  this->content = content;
+  this->hasTargets = hasTargets;
+  this->readinCutoff = readinCutoff;
+  this->readinColumns = readinColumns;
+  this->readinClasses = readinClasses;
+  numSamples = -1;
+  rewind();
+
+  // determine the number of columns
+  size_t numberOfColumns = 0;
+
+  if (fileType == DataSourceFileType::BINARY) {
+    if (hasTargets && !input->hasTargets) {
+      throw base::data_exception("StreamingFileSampleProvider: binary file contains no targets");
+    }
+
+    // if the targets are not requested, they are treated as an additional column
+    numberOfColumns = input->numberOfColumns + ((input->hasTargets && !hasTargets) ? 1 : 0);
+  } else {
+    DatasetParser parser = createParser(false);
+
+    while (true) {
+      size_t numberInstances = 1;
+      const size_t length =
+          parser.findLines(input->pending.data(), input->getCompleteLength(), numberInstances);
+
+      if (numberInstances == 1) {
+        parser.parseSize(input->pending.data(), length, numberInstances, numberOfColumns);
+        break;
+      } else if (!input->fill()) {
+        break;
+      }
+    }
+  }
+
+  if (!readinColumns.empty() &&
+      (*std::max_element(readinColumns.begin(), readinColumns.end()) >= numberOfColumns)) {
+    throw base::data_exception("StreamingFileSampleProvider: invalid column selection");
+  }
+
+  dimension = readinColumns.empty() ? numberOfColumns : readinColumns.size();
+}
+
+std::unique_ptr<StreamingFileSampleProvider::Input> StreamingFileSampleProvider::openInput()
+    const {
+  std::unique_ptr<Input> newInput(new Input());
+
+  switch (source) {
+    case Source::FILE:
+      newInput->reader.reset(new FileReader(filePath));
+      break;
+    case Source::COMPRESSED_FILE:
+#ifdef ZLIB
+      newInput->reader.reset(new GzipReader(filePath));
+#endif
+      break;
+    case Source::STRING:
+      newInput->reader.reset(new StringReader(content));
+      break;
+    case Source::NONE:
+      throw base::file_exception("No dataset loaded.");
+  }
+
+  if (fileType == DataSourceFileType::BINARY) {
+    newInput->readBinaryHeader();
+  } else if (fileType == DataSourceFileType::CSV) {
+    newInput->skipFirstLine();
+  }
+
+  return newInput;
+}
+
+void StreamingFileSampleProvider::rewind() {
+  input = openInput();
+  leftover.reset();
+  numberOfReadSamples = 0;
+  isExhausted = false;
+}
+
+void StreamingFileSampleProvider::reset() {
+  waitForPrefetch();
+
+  if (source != Source::NONE) {
+    rewind();
+  }
+}
+
+size_t StreamingFileSampleProvider::getDim() const {
+  if (source == Source::NONE) {
+    throw base::file_exception{"No dataset loaded."};
+  }
+
+  return dimension;
+}
+
+size_t StreamingFileSampleProvider::getNumSamples() const {
+  if (source == Source::NONE) {
+    throw base::file_exception{"No dataset loaded."};
+  }
+
+  if (numSamples == static_cast<size_t>(-1)) {
+    // count the samples with a separate input, so that the current position is not changed
+    std::unique_ptr<Input> countInput = openInput();
+    size_t count = 0;
+
+    if ((fileType == DataSourceFileType::BINARY) && (!hasTargets || readinClasses.empty())) {
+      count = countInput->numberInstances;
+    } else if (fileType == DataSourceFileType::BINARY) {
+      // the targets have to be filtered block by block
+      while (count < readinCutoff) {
+        std::unique_ptr<Dataset> batch(readBinarySamples(*countInput, countInput->rowsPerBlock));
+
+        if (batch->getNumberInstances() == 0) {
+          break;
+        }
+
+        count += batch->getNumberInstances();
+      }
+    } else {
+      const DatasetParser parser = createParser();
+
+      while (count < readinCutoff) {
+        size_t numberInstances = readinCutoff - count;
+        const size_t length = parser.findLines(countInput->pending.data(),
+                                               countInput->getCompleteLength(), numberInstances);
+        count += numberInstances;
+        countInput->pending.erase(countInput->pending.begin(),
+                                  countInput->pending.begin() + length);
+
+        if (!countInput->fill() && countInput->pending.empty()) {
+          break;
+        }
+      }
+    }
+
+    numSamples = std::min(count, readinCutoff);
+  }
+
+  return numSamples;
+}
+
+Dataset* StreamingFileSampleProvider::getNextSamples(size_t howMany) {
+  if (source == Source::NONE) {
+    throw base::file_exception("No dataset loaded.");
+  }
+
+  waitForPrefetch();
+  std::unique_ptr<Dataset> batch;
+
+  // use the samples that have been read in advance
+  if (leftover && (leftover->getNumberInstances() <= howMany)) {
+    batch = std::move(leftover);
+  } else if (leftover) {
+    batch.reset(copyRows(*leftover, 0, howMany));
+    leftover.reset(
+        copyRows(*leftover, howMany, leftover->getNumberInstances() - howMany));
+  }
+
+  const size_t numberOfSamples = batch ? batch->getNumberInstances() : 0;
+
+  if ((numberOfSamples < howMany) && !isExhausted) {
+    batch = concatenate(std::move(batch),
+                        std::unique_ptr<Dataset>(readSamples(howMany - numberOfSamples)));
+  }
+
+  if (!batch) {
+    batch.reset(new Dataset(0, dimension));
+  }
+
+  // read the next batch while the current one is processed
+  if (!isExhausted) {
+    prefetch = std::async(std::launch::async, &StreamingFileSampleProvider::readSamples, this,
+                          howMany);
+  }
+
+  return batch.release();
+}
+
+Dataset* StreamingFileSampleProvider::getAllSamples() {
+  return getNextSamples(std::numeric_limits<size_t>::max());
+}
+
+void StreamingFileSampleProvider::waitForPrefetch() {
+  if (prefetch.valid()) {
+    std::unique_ptr<Dataset> batch(prefetch.get());
+    leftover = concatenate(std::move(leftover), std::move(batch));
+  }
+}
+
+DatasetParser StreamingFileSampleProvider::createParser(bool filterTargets) const {
+  return DatasetParser(
+      (fileType == DataSourceFileType::ARFF) ? DatasetParser::Format::ARFF
+                                             : DatasetParser::Format::CSV,
+      false, hasTargets, -1, readinColumns,
+      filterTargets ? readinClasses : std::vector<double>());
+}
+
+Dataset* StreamingFileSampleProvider::readSamples(size_t howMany) {
+  howMany = std::min(howMany, readinCutoff - numberOfReadSamples);
+  Dataset* batch = (fileType == DataSourceFileType::BINARY)
+                       ? readBinarySamples(*input, howMany)
+                       : readTextSamples(*input, howMany);
+  numberOfReadSamples += batch->getNumberInstances();
+
+  if (batch->getNumberInstances() < howMany || (numberOfReadSamples >= readinCutoff)) {
+    isExhausted = true;
+  }
+
+  return batch;
+}
+
+Dataset* StreamingFileSampleProvider::readTextSamples(Input& curInput, size_t howMany) const {
+  const DatasetParser parser = createParser();
+  size_t numberOfMissingSamples = howMany;
+  size_t length = 0;
+
+  // collect complete lines until they contain enough samples
+  while (numberOfMissingSamples > 0) {
+    size_t numberOfFoundSamples = numberOfMissingSamples;
+    length += parser.findLines(curInput.pending.data() + length,
+                               curInput.getCompleteLength() - length, numberOfFoundSamples);
+    numberOfMissingSamples -= numberOfFoundSamples;
+
+    if ((numberOfMissingSamples > 0) && !curInput.fill()) {
+      // the end of the input has been reached, but the last line might not be complete
+      size_t numberOfLastSamples = numberOfMissingSamples;
+      length += parser.findLines(curInput.pending.data() + length,
+                                 curInput.getCompleteLength() - length, numberOfLastSamples);
+      numberOfMissingSamples -= numberOfLastSamples;
+      break;
+    }
+  }
+
+  std::unique_ptr<Dataset> batch;
+
+  if (numberOfMissingSamples < howMany) {
+    batch.reset(new Dataset(parser.parse(curInput.pending.data(), length)));
+
+    if (batch->getDimension() != dimension) {
+      throw base::file_exception("StreamingFileSampleProvider: inconsistent number of columns");
+    }
+  } else {
+    batch.reset(new Dataset(0, dimension));
+  }
+
+  curInput.pending.erase(curInput.pending.begin(), curInput.pending.begin() + length);
+  return batch.release();
+}
+
+Dataset* StreamingFileSampleProvider::readBinarySamples(Input& curInput, size_t howMany) const {
+  // the batch can not contain more than the remaining samples
+  howMany = std::min(howMany, curInput.numberInstances - curInput.readRows +
+                                  (curInput.blockRows - curInput.blockPosition));
+  std::unique_ptr<Dataset> batch(new Dataset(howMany, dimension));
+  double* samples = batch->getData().data();
+  double* targets = batch->getTargets().data();
+  const bool useTargets = hasTargets && curInput.hasTargets;
+  const bool filterTargets = useTargets && !readinClasses.empty();
+  size_t row = 0;
+
+  while (row < howMany) {
+    if ((curInput.blockPosition == curInput.blockRows) && !curInput.readBinaryBlock()) {
+      break;
+    }
+
+    // column j of the current block starts at block[j * blockRows]
+    const double* block = curInput.block.data();
+    const size_t blockRows = curInput.blockRows;
+    const size_t targetColumn = curInput.numberOfColumns;
+
+    for (; (curInput.blockPosition < blockRows) && (row < howMany); curInput.blockPosition++) {
+      const size_t i = curInput.blockPosition;
+
+      if (filterTargets) {
+        const double target = block[targetColumn * blockRows + i];
+        bool isSelected = false;
+
+        for (double readinClass : readinClasses) {
+          isSelected = isSelected || (std::abs(target - readinClass) < 0.001);
+        }
+
+        if (!isSelected) {
+          continue;
+        }
+      }
+
+      double* sample = samples + row * dimension;
+
+      for (size_t j = 0; j < dimension; j++) {
+        const size_t column = readinColumns.empty() ? j : readinColumns[j];
+        sample[j] = block[column * blockRows + i];
+      }
+
+      if (useTargets) {
+        targets[row] = block[targetColumn * blockRows + i];
+      }
+
+      row++;
+    }
+  }
+
+  if (row < howMany) {
+    return copyRows(*batch, 0, row);
+  }
+
+  return batch.release();
+}
+
+void StreamingFileSampleProvider::writeBinaryFile(const std::string& filePath,
+                                                  const Dataset& dataset, bool hasTargets,
+                                                  size_t rowsPerBlock) {
+  std::ofstream stream(filePath.c_str(), std::ios::out | std::ios::binary);
+
+  if (!stream) {
+    throw base::file_exception(("Unable to open file: " + filePath).c_str());
+  }
+
+  rowsPerBlock = std::max<size_t>(rowsPerBlock, 1);
+  const size_t numberInstances = dataset.getNumberInstances();
+  const size_t dim = dataset.getDimension();
+  const std::uint64_t header[4] = {numberInstances, dim, hasTargets ? 1u : 0u, rowsPerBlock};
+  stream.write(binaryMagic, sizeof(binaryMagic));
+  stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+  std::vector<double> block;
+
+  for (size_t begin = 0; begin < numberInstances; begin += rowsPerBlock) {
+    const size_t blockRows = std::min(rowsPerBlock, numberInstances - begin);
+    block.resize(blockRows * (dim + (hasTargets ? 1 : 0)));
+
+    for (size_t i = 0; i < blockRows; i++) {
+      for (size_t j = 0; j < dim; j++) {
+        block[j * blockRows + i] = dataset.getData().get(begin + i, j);
+      }
+
+      if (hasTargets) {
+        block[dim * blockRows + i] = dataset.getTargets()[begin + i];
+      }
+    }
+
+    stream.write(reinterpret_cast<const char*>(block.data()),
+                 static_cast<std::streamsize>(block.size() * sizeof(double)));
+  }
+
+  if (!stream) {
+    throw base::file_exception(("Unable to write file: " + filePath).c_str());
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -0,0 +1,167 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/DatasetParser.hpp>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * #sgpp::datadriven::FileSampleProvider that reads the samples lazily from disk instead of
+ * loading the whole file into memory, which is useful for datasets that are larger than the main
+ * memory (e.g., for online density estimation with
+ * #sgpp::datadriven::ModelFittingDensityEstimationOnOff).
+ *
+ * Supported formats are CSV (with a header line), ARFF, and a binary columnar format
+ * (see writeBinaryFile), all of which may be gzip compressed (use a
+ * #sgpp::datadriven::GzipFileSampleDecorator or readCompressedFile).
+ * After a batch has been returned by getNextSamples, the next batch of the same size is read and
+ * parsed by a background thread, which overlaps I/O and parsing with the processing of the
+ * current batch. The memory consumption is bounded by a small multiple of the batch size.
+ *
+ * Samples are provided in the order of the file, shuffling is not supported.
+ */
+class StreamingFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param fileType format of the files (ARFF, CSV, or BINARY)
+   */
+  explicit StreamingFileSampleProvider(DataSourceFileType fileType);
+
+  /**
+   * Copy constructor, re-opens the input of the other provider (without its read position).
+   *
+   * @param rhs provider to copy
+   */
+  StreamingFileSampleProvider(const StreamingFileSampleProvider& rhs);
+
+  StreamingFileSampleProvider& operator=(const StreamingFileSampleProvider& rhs) = delete;
+
+  ~StreamingFileSampleProvider() override;
+
+  SampleProvider* clone() const override;
+
+  Dataset* getNextSamples(size_t howMany) override;
+
+  /**
+   * Reads all remaining samples (which have to fit into the main memory).
+   */
+  Dataset* getAllSamples() override;
+
+  size_t getDim() const override;
+
+  /**
+   * Returns the number of samples in the file. For text files, this requires a pass over the
+   * whole file (without storing the samples), the result is cached.
+   */
+  size_t getNumSamples() const override;
+
+  void reset() override;
+
+  void readFile(const std::string& filePath, bool hasTargets, size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Same as readFile for a gzip compressed file.
+   */
+  void readCompressedFile(const std::string& filePath, bool hasTargets, size_t readinCutoff = -1,
+                          std::vector<size_t> readinColumns = std::vector<size_t>(),
+                          std::vector<double> readinClasses = std::vector<double>());
+
+  void readString(const std::string& input, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Writes a dataset in the binary columnar format.
+   * The file starts with the eight characters "SGPPDS01", followed by four 64-bit unsigned
+   * integers (number of instances, dimension, whether targets are stored, and rows per block).
+   * The samples are stored in blocks
+   * of rowsPerBlock rows; every block contains the columns of its rows one after another
+   * (followed by the targets). The data is stored in the native byte order.
+   *
+   * @param filePath      path of the file
+   * @param dataset       dataset to write
+   * @param hasTargets    whether the targets are written
+   * @param rowsPerBlock  number of rows per block
+   */
+  static void writeBinaryFile(const std::string& filePath, const Dataset& dataset,
+                              bool hasTargets = true, size_t rowsPerBlock = 65536);
+
+  /**
+   * Abstraction of the input (plain file, gzip compressed file, or string).
+   */
+  class Reader {
+   public:
+    virtual ~Reader() = default;
+    /**
+     * @param buffer  buffer for the characters
+     * @param size    maximal number of characters to read
+     * @return number of read characters (zero at the end of the input)
+     */
+    virtual size_t read(char* buffer, size_t size) = 0;
+  };
+
+ private:
+  enum class Source { NONE, FILE, COMPRESSED_FILE, STRING };
+
+  /// state of the input (defined in the source file)
+  struct Input;
+
+  DataSourceFileType fileType;
+  Source source;
+  std::string filePath;
+  std::shared_ptr<const std::string> content;
+  bool hasTargets;
+  size_t readinCutoff;
+  std::vector<size_t> readinColumns;
+  std::vector<double> readinClasses;
+  size_t dimension;
+  /// cached number of samples (-1 if not yet counted)
+  mutable size_t numSamples;
+
+  /// input, only accessed by the prefetch thread while it is running
+  std::unique_ptr<Input> input;
+  /// number of samples read from the input
+  size_t numberOfReadSamples;
+  /// whether the input (or the readin cutoff) has been reached
+  bool isExhausted;
+
+  /// samples that have been read, but not yet returned
+  std::unique_ptr<Dataset> leftover;
+  /// batch that is read by the prefetch thread
+  std::future<Dataset*> prefetch;
+
+  void open(Source source, const std::string& filePath,
+            std::shared_ptr<const std::string> content, bool hasTargets, size_t readinCutoff,
+            std::vector<size_t> readinColumns, std::vector<double> readinClasses);
+  std::unique_ptr<Input> openInput() const;
+  void rewind();
+  void waitForPrefetch();
+  DatasetParser createParser(bool filterTargets = true) const;
+
+  /**
+   * Reads at most howMany samples from the input (called by the prefetch thread).
+   */
+  Dataset* readSamples(size_t howMany);
+  Dataset* readTextSamples(Input& curInput, size_t howMany) const;
+  Dataset* readBinarySamples(Input& curInput, size_t howMany) const;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
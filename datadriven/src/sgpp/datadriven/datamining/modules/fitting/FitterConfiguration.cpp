@@ -141,6 +141,8 @@ void FitterConfiguration::setupDefaults() {
   crossvalidationConfig.lambdaEnd_ = 0.001;
   crossvalidationConfig.lambdaSteps_ = 0;
   crossvalidationConfig.logScale_ = false;
+  crossvalidationConfig.parallelFolds_ = 1;  // mirrors struct default
+  crossvalidationConfig.threadBudget_ = 0;   // mirrors struct default
 
   // (Sebastian) The following two values were previously set
   // in the subclass FitterConfigurationDensityEstimation but were moved here
@@ -154,6 +156,8 @@ void FitterConfiguration::setupDefaults() {
   densityEstimationConfig.iCholSweepsRefine_ = 4;        // mirrors struct default;
   densityEstimationConfig.iCholSweepsUpdateLambda_ = 2;  // mirrors struct default;
   densityEstimationConfig.iCholSweepsSolver_ = 2;        // mirrors struct default;
+  densityEstimationConfig.parallelComponents_ = 1;       // mirrors struct default;
+  densityEstimationConfig.threadBudget_ = 0;             // mirrors struct default;
 
   databaseConfig.filePath = "";
 
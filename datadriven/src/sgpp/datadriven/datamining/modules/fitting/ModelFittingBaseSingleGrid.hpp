@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/datadriven/algorithm/MultipleEvalCache.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfiguration.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
@@ -96,6 +97,12 @@ class ModelFittingBaseSingleGrid : public ModelFittingBase {
    * hierarchical surpluses of the #grid.
    */
   DataVector alpha;
+
+  /**
+   * evaluation operation for batches of samples, which is kept as long as the #grid is
+   * unchanged; it has to be invalidated if the #grid is refined, coarsened or replaced.
+   */
+  MultipleEvalCache evaluationCache;
 };
 
 } /* namespace datadriven */
@@ -19,6 +19,7 @@
 #include <sgpp/datadriven/functors/classification/MultipleClassRefinementFunctor.hpp>
 #include <sgpp/datadriven/functors/classification/ZeroCrossingRefinementFunctor.hpp>
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <string>
@@ -38,6 +39,8 @@ using sgpp::datadriven::RefinementFunctorType;
 namespace sgpp {
 namespace datadriven {
 
+const size_t ModelFittingClassification::evaluationChunkSize = 1024;
+
 ModelFittingClassification::ModelFittingClassification(
     const FitterConfigurationClassification& config)
     : refinementsPerformed{0} {
@@ -127,26 +130,97 @@ void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& resul
 #endif  // USE_SCALAPACK
 
   std::vector<double> priors = getClassPriors();
-  std::vector<DataVector> classResults(models.size());
+  std::vector<size_t> classes;
+  std::vector<double> labels;
   for (auto& p : classIdx) {
-    size_t idx = p.second;
-    DataVector results(samples.getNrows());
-    models[idx]->evaluate(samples, results);
-    results.mult(priors[idx]);
-    classResults[idx] = results;
+    labels.push_back(p.first);
+    classes.push_back(p.second);
   }
-  for (size_t j = 0; j < samples.getNrows(); j++) {
-    double maxDensity = std::numeric_limits<double>::lowest();
-    double prediction = 0.0;
-    for (auto& p : classIdx) {
-      size_t idx = p.second;
-      if (maxDensity < classResults[idx][j]) {
-        maxDensity = classResults[idx][j];
-        prediction = p.first;
+
+  const size_t numSamples = samples.getNrows();
+  const size_t dim = samples.getNcols();
+  const size_t numClasses = classes.size();
+  results.resize(numSamples);
+
+  // If all classes share the same grid, they are evaluated at once with the prior-weighted
+  // coefficients as columns of a matrix. Otherwise, all class models are evaluated chunk by
+  // chunk, such that the class densities of a chunk are still cached when choosing the class.
+  DataMatrix coefficients;
+  const bool fused = getFusedCoefficients(classes, priors, coefficients);
+  DataMatrix fusedResults;
+  std::vector<DataVector> classResults(numClasses);
+
+  for (size_t chunkBegin = 0; chunkBegin < numSamples; chunkBegin += evaluationChunkSize) {
+    const size_t chunkSize = std::min(evaluationChunkSize, numSamples - chunkBegin);
+    DataMatrix chunk(chunkSize, dim);
+    std::copy(samples.data() + chunkBegin * dim, samples.data() + (chunkBegin + chunkSize) * dim,
+              chunk.data());
+
+    if (fused) {
+      evaluationCache.eval(models[classes[0]]->getGrid(), coefficients, chunk, fusedResults);
+    } else {
+      for (size_t k = 0; k < numClasses; k++) {
+        classResults[k].resize(chunkSize);
+        models[classes[k]]->evaluate(chunk, classResults[k]);
       }
     }
-    results.set(j, prediction);
+
+    for (size_t j = 0; j < chunkSize; j++) {
+      double maxDensity = std::numeric_limits<double>::lowest();
+      double prediction = 0.0;
+      for (size_t k = 0; k < numClasses; k++) {
+        const double density =
+            fused ? fusedResults.get(j, k) : priors[classes[k]] * classResults[k][j];
+        if (maxDensity < density) {
+          maxDensity = density;
+          prediction = labels[k];
+        }
+      }
+      results.set(chunkBegin + j, prediction);
+    }
+  }
+}
+
+bool ModelFittingClassification::getFusedCoefficients(const std::vector<size_t>& classes,
+                                                      const std::vector<double>& priors,
+                                                      DataMatrix& coefficients) {
+  // interaction-term aware models are evaluated with their own operations
+  if (classes.empty() || !this->config->getGeometryConfig().stencils.empty()) {
+    return false;
   }
+
+  DataVector classCoefficients;
+  if (!models[classes[0]]->getEvaluationCoefficients(classCoefficients)) {
+    return false;
+  }
+
+  Grid& grid = models[classes[0]]->getGrid();
+  base::GridStorage& storage = grid.getStorage();
+  coefficients.resize(grid.getSize(), classes.size());
+  classCoefficients.mult(priors[classes[0]]);
+  coefficients.setColumn(0, classCoefficients);
+
+  for (size_t k = 1; k < classes.size(); k++) {
+    if (!models[classes[k]]->getEvaluationCoefficients(classCoefficients)) {
+      return false;
+    }
+
+    Grid& classGrid = models[classes[k]]->getGrid();
+    base::GridStorage& classStorage = classGrid.getStorage();
+    if ((classGrid.getType() != grid.getType()) || (classGrid.getSize() != grid.getSize())) {
+      return false;
+    }
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      if (!storage[i].equals(classStorage[i])) {
+        return false;
+      }
+    }
+
+    classCoefficients.mult(priors[classes[k]]);
+    coefficients.setColumn(k, classCoefficients);
+  }
+
+  return true;
 }
 
 std::vector<double> ModelFittingClassification::getClassPriors() const {
@@ -286,6 +360,7 @@ MultiGridRefinementFunctor* ModelFittingClassification::getRefinementFunctor(
 }
 
 bool ModelFittingClassification::refine() {
+  evaluationCache.invalidate();
   if (config->getGridConfig().generalType_ == base::GeneralGridType::ComponentGrid) {
     for (size_t i = 0; i < models.size(); i++) {
       models.at(i)->refine();
@@ -374,6 +449,7 @@ bool ModelFittingClassification::refine() {
 
 void ModelFittingClassification::update(Dataset& newDataset) {
   dataset = &newDataset;
+  evaluationCache.invalidate();
 
   // Split the dataset into classes
   DataVector tmp(newDataset.getDimension());
@@ -398,6 +474,7 @@ void ModelFittingClassification::update(Dataset& newDataset) {
 }
 
 void ModelFittingClassification::reset() {
+  evaluationCache.invalidate();
   models.clear();
   classNumberInstances.clear();
   classIdx.clear();
@@ -9,6 +9,7 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/datadriven/algorithm/DBMatObjectStore.hpp>
+#include <sgpp/datadriven/algorithm/MultipleEvalCache.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationClassification.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBaseSingleGrid.hpp>
@@ -132,6 +133,18 @@ class ModelFittingClassification : public ModelFittingBase {
 
   std::vector<double> getClassPriors() const;
 
+  /**
+   * Collects the prior-weighted coefficients of the given classes as columns of a matrix if the
+   * models of all these classes are defined on identical grids, such that they can be evaluated
+   * at once.
+   * @param classes indices of the models (in the order of the columns)
+   * @param priors priors for each class
+   * @param[out] coefficients matrix whose columns are the weighted coefficient vectors
+   * @return whether all models can be evaluated on the grid of the first model
+   */
+  bool getFusedCoefficients(const std::vector<size_t>& classes, const std::vector<double>& priors,
+                            DataMatrix& coefficients);
+
   /**
    * Returns the refinement functor suitable for the model settings.
    * @param grids vector of pointers to grids for each class
@@ -171,6 +184,16 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   std::vector<size_t> classNumberInstances;
 
+  /**
+   * Evaluation operation for all classes at once if the grids of all classes are identical
+   */
+  MultipleEvalCache evaluationCache;
+
+  /**
+   * Number of samples for which all classes are evaluated before the most likely class is chosen
+   */
+  static const size_t evaluationChunkSize;
+
 #ifdef USE_SCALAPACK
   /**
    * BLACS process grid for ScaLAPACK version
@@ -65,6 +65,14 @@ RefinementFunctor *ModelFittingDensityEstimation::getRefinementFunctor() {
   return nullptr;
 }
 
+bool ModelFittingDensityEstimation::getEvaluationCoefficients(DataVector& coefficients) {
+  if (grid == nullptr) {
+    return false;
+  }
+  coefficients = alpha;
+  return true;
+}
+
 bool ModelFittingDensityEstimation::refine() {
   if (grid != nullptr && this->isRefinable()) {
     if (refinementsPerformed < config->getRefinementConfig().numRefinements_) {
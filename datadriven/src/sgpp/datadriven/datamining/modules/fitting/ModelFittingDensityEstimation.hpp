@@ -67,6 +67,15 @@ class ModelFittingDensityEstimation : public ModelFittingBaseSingleGrid {
    */
   bool refine() override;
 
+  /**
+   * Returns coefficients such that the fitted density is the linear combination of the basis
+   * functions of the grid (getGrid()) with these coefficients. This allows to evaluate models
+   * that are defined on identical grids at once.
+   * @param[out] coefficients coefficients of the grid points
+   * @return false if the model is not represented this way (e.g., not fitted yet)
+   */
+  virtual bool getEvaluationCoefficients(DataVector& coefficients);
+
   /**
    * Returns the refinement functor suitable for the model settings.
    * @return pointer to a refinement functor that suits the model settings
@@ -48,7 +48,7 @@ double ModelFittingDensityEstimationCG::evaluate(const DataVector& sample) {
 
 // TODO(lettrich): exceptions have to be thrown if not valid.
 void ModelFittingDensityEstimationCG::evaluate(DataMatrix& samples, DataVector& results) {
-  sgpp::op_factory::createOperationMultipleEval(*grid, samples)->eval(alpha, results);
+  evaluationCache.eval(*grid, alpha, samples, results);
 }
 
 void ModelFittingDensityEstimationCG::fit(Dataset& newDataset) {
@@ -82,6 +82,8 @@ void ModelFittingDensityEstimationCG::fit(DataMatrix& newDataset) {
 
 bool ModelFittingDensityEstimationCG::refine(size_t newNoPoints,
     std::list<size_t> *deletedGridPoints) {
+  evaluationCache.invalidate();
+
   // Coarsening, remove idx from alpha
   if (deletedGridPoints != nullptr && deletedGridPoints->size() > 0) {
     // Restructure alpha and rhs b
@@ -164,6 +166,7 @@ void ModelFittingDensityEstimationCG::reset() {
   // Clear model
   grid.reset();
   refinementsPerformed = 0;
+  evaluationCache.invalidate();
 }
 
 }  // namespace datadriven
@@ -7,11 +7,13 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/datadriven/algorithm/CombiScheme.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationDensityEstimation.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationCG.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationCombi.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationOnOff.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
 #include <utility>
@@ -24,6 +26,8 @@ using std::vector;
 namespace sgpp {
 namespace datadriven {
 
+const size_t ModelFittingDensityEstimationCombi::evaluationChunkSize = 1024;
+
 ModelFittingDensityEstimationCombi::ModelFittingDensityEstimationCombi() {}
 
 ModelFittingDensityEstimationCombi::ModelFittingDensityEstimationCombi(
@@ -84,22 +88,14 @@ void ModelFittingDensityEstimationCombi::fit(DataMatrix& newDataset) {
     components.at(i) = createNewModel(newFitterConfig);
     fitted.at(i) = 0;
   }
-  for (size_t i = 0; i < components.size(); i++) {
-    components.at(i)->fit(newDataset);
-    fitted.at(i) = 1;
-  }
+  fitComponents(newDataset);
 }
 
 void ModelFittingDensityEstimationCombi::update(Dataset& newDataset) {
   if (components.empty()) {
     fit(newDataset);
   } else {
-    for (size_t i = 0; i < components.size(); i++) {
-      if (fitted.at(i) != 1) {
-        components.at(i)->fit(newDataset.getData());
-        fitted.at(i) = 1;
-      }
-    }
+    fitComponents(newDataset.getData());
   }
   size_t gridpoints = 0;
   for (size_t i = 0; i < components.size(); i++) {
@@ -114,12 +110,7 @@ void ModelFittingDensityEstimationCombi::update(DataMatrix& newDataset) {
   if (components.empty()) {
     fit(newDataset);
   } else {
-    for (size_t i = 0; i < components.size(); i++) {
-      if (fitted.at(i) != 1) {
-        components.at(i)->fit(newDataset);
-        fitted.at(i) = 1;
-      }
-    }
+    fitComponents(newDataset);
   }
   size_t gridpoints = 0;
   for (size_t i = 0; i < components.size(); i++) {
@@ -143,16 +134,67 @@ double ModelFittingDensityEstimationCombi::evaluate(const DataVector& sample) {
 }
 
 void ModelFittingDensityEstimationCombi::evaluate(DataMatrix& samples, DataVector& results) {
-  auto temp = sgpp::base::DataVector(results.size(), 0);
-  results.setAll(0);
+  std::vector<size_t> fittedComponents;
   for (size_t i = 0; i < components.size(); i++) {
     if (fitted.at(i)) {
-      temp.setAll(0);
-      components.at(i)->evaluate(samples, temp);
-      temp.mult(static_cast<double>(componentConfigs.at(i).second));
-      results.add(temp);
+      fittedComponents.push_back(i);
     }
   }
+
+  const size_t numSamples = samples.getNrows();
+  const size_t dim = samples.getNcols();
+  results.resize(numSamples);
+  results.setAll(0);
+
+  // Evaluate chunks of samples on all component grids while the chunk is in cache, the
+  // components of a chunk are evaluated concurrently
+  std::vector<DataVector> componentResults(fittedComponents.size());
+
+  for (size_t chunkBegin = 0; chunkBegin < numSamples; chunkBegin += evaluationChunkSize) {
+    const size_t chunkSize = std::min(evaluationChunkSize, numSamples - chunkBegin);
+    DataMatrix chunk(chunkSize, dim);
+    std::copy(samples.data() + chunkBegin * dim, samples.data() + (chunkBegin + chunkSize) * dim,
+              chunk.data());
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t k = 0; k < fittedComponents.size(); k++) {
+      componentResults[k].resize(chunkSize);
+      componentResults[k].setAll(0);
+      components.at(fittedComponents[k])->evaluate(chunk, componentResults[k]);
+    }
+
+    // Sum up in the order of the components for reproducible results
+    for (size_t k = 0; k < fittedComponents.size(); k++) {
+      const double coefficient =
+          static_cast<double>(componentConfigs.at(fittedComponents[k]).second);
+      for (size_t j = 0; j < chunkSize; j++) {
+        results[chunkBegin + j] += coefficient * componentResults[k][j];
+      }
+    }
+  }
+}
+
+void ModelFittingDensityEstimationCombi::fitComponents(DataMatrix& newDataset) {
+  std::vector<size_t> unfitted;
+  for (size_t i = 0; i < components.size(); i++) {
+    if (!fitted.at(i)) {
+      unfitted.push_back(i);
+    }
+  }
+
+  // Component grids are independent, fit them with a bounded number of concurrent workers (the
+  // object store is thread-safe, so decompositions are still shared between the components)
+  const DensityEstimationConfiguration& densityEstimationConfig =
+      config->getDensityEstimationConfig();
+  TrialScheduler scheduler(densityEstimationConfig.parallelComponents_,
+                           densityEstimationConfig.threadBudget_);
+  scheduler.run(unfitted.size(), [this, &unfitted, &newDataset](size_t worker, size_t i) {
+    components.at(unfitted[i])->fit(newDataset);
+  });
+
+  for (size_t i : unfitted) {
+    fitted.at(i) = true;
+  }
 }
 
 bool ModelFittingDensityEstimationCombi::refine() {
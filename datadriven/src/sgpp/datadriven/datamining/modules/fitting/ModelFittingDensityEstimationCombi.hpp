@@ -80,7 +80,9 @@ class ModelFittingDensityEstimationCombi : public ModelFittingDensityEstimation
   double evaluate(const DataVector& sample) override;
 
   /**
-   * Evaluate the fitted density on a set of data points - requires a trained grid.
+   * Evaluate the fitted density on a set of data points - requires a trained grid. The samples
+   * are processed in chunks, every chunk is evaluated on all component grids (concurrently) before
+   * the next chunk is loaded.
    * @param samples matrix where each row represents a sample and the columns contain the
    * coordinates in all dimensions of that sample.
    * @param results vector where each row will contain the evaluation of the respective sample on
@@ -139,8 +141,21 @@ class ModelFittingDensityEstimationCombi : public ModelFittingDensityEstimation
    */
   CombiScheme scheme;
 
+  /**
+   * Number of samples per chunk in evaluate(DataMatrix&, DataVector&)
+   */
+  static const size_t evaluationChunkSize;
+
   bool isRefinable() override;
 
+  /**
+   * Fits all component grids that have not been fitted yet. The components are fitted
+   * concurrently according to DensityEstimationConfiguration::parallelComponents_ and
+   * DensityEstimationConfiguration::threadBudget_.
+   * @param newDataset the training dataset
+   */
+  void fitComponents(DataMatrix& newDataset);
+
   /**
    * Creates a density estimation model that fits the model settings.
    * @param densityEstimationConfig configuration for the density estimation
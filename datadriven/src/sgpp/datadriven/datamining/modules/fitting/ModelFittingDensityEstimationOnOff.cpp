@@ -61,6 +61,15 @@ void ModelFittingDensityEstimationOnOff::evaluate(DataMatrix& samples, DataVecto
   online->eval(alpha, samples, results, *grid);
 }
 
+bool ModelFittingDensityEstimationOnOff::getEvaluationCoefficients(DataVector& coefficients) {
+  if (grid == nullptr || online == nullptr || !online->isComputed()) {
+    return false;
+  }
+  coefficients = alpha;
+  coefficients.mult(online->getNormFactor());
+  return true;
+}
+
 void ModelFittingDensityEstimationOnOff::fit(Dataset& newDataset) {
   dataset = &newDataset;
   fit(newDataset.getData());
@@ -95,7 +104,7 @@ void ModelFittingDensityEstimationOnOff::fit(DataMatrix& newDataset) {
   // store is given and the offline permutation method is configured, the offline object is obtained
   // from the permutation factory
   if (this->hasObjectStore) {
-    const DBMatOffline* objectFromStore =
+    std::shared_ptr<const DBMatOffline> objectFromStore =
         this->objectStore->getObject(gridConfig, geometryConfig, refinementConfig,
                                      regularizationConfig, densityEstimationConfig);
 
@@ -103,6 +103,13 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
    */
   void evaluate(DataMatrix& samples, DataVector& results) override;
 
+  /**
+   * Returns the surpluses scaled by the normalization factor of the online object.
+   * @param[out] coefficients coefficients of the grid points
+   * @return false if the density function has not been computed yet
+   */
+  bool getEvaluationCoefficients(DataVector& coefficients) override;
+
   /**
    * Function that indicates whether a model is refinable at all (certain on/off settings do not
    * allow for refinement)
@@ -71,6 +71,11 @@ void ModelFittingDensityEstimationOnOffParallel::evaluate(DataMatrix& samples,
   resultsDistributed.toLocalDataVector(results);
 }
 
+bool ModelFittingDensityEstimationOnOffParallel::getEvaluationCoefficients(
+    DataVector& coefficients) {
+  return false;
+}
+
 void ModelFittingDensityEstimationOnOffParallel::fit(Dataset& newDataset) {
   dataset = &newDataset;
   fit(newDataset.getData());
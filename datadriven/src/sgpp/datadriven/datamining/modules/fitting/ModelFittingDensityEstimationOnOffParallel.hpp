@@ -109,6 +109,14 @@ class ModelFittingDensityEstimationOnOffParallel : public ModelFittingDensityEst
    */
   void evaluate(DataMatrix& samples, DataVector& results) override;
 
+  /**
+   * The distributed model is evaluated with its own operation and is never evaluated together
+   * with other models.
+   * @param[out] coefficients unchanged
+   * @return false
+   */
+  bool getEvaluationCoefficients(DataVector& coefficients) override;
+
   /**
    * Function that indicates whether a model is refinable at all (certain on/off settings do not
    * allow for refinement)
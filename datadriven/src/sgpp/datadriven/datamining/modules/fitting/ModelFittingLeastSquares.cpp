@@ -33,6 +33,7 @@ ModelFittingLeastSquares::ModelFittingLeastSquares(const FitterConfigurationLeas
   this->config = std::unique_ptr<FitterConfiguration>(
       std::make_unique<FitterConfigurationLeastSquares>(config));
   solver = std::unique_ptr<SLESolver>{buildSolver(this->config->getSolverFinalConfig())};
+  evaluationCache.setConfiguration(this->config->getMultipleEvalConfig());
 }
 
 // TODO(lettrich): exceptions have to be thrown if not valid.
@@ -43,9 +44,7 @@ double ModelFittingLeastSquares::evaluate(const DataVector &sample) {
 
 // TODO(lettrich): exceptions have to be thrown if not valid.
 void ModelFittingLeastSquares::evaluate(DataMatrix &samples, DataVector &results) {
-  auto opMultEval = std::unique_ptr<base::OperationMultipleEval>{
-      op_factory::createOperationMultipleEval(*grid, samples, config->getMultipleEvalConfig())};
-  opMultEval->eval(alpha, results);
+  evaluationCache.eval(*grid, alpha, samples, results);
 }
 
 void ModelFittingLeastSquares::fit(Dataset &newDataset) {
@@ -78,6 +77,7 @@ bool ModelFittingLeastSquares::refine() {
       } else {
         grid->getGenerator().refine(refinementFunctor);
       }
+      evaluationCache.invalidate();
       if (grid->getSize() > noPoints) {
         // Tell the SLE manager that the grid changed (for interal data structures)
         alpha.resizeZero(grid->getSize());
@@ -121,6 +121,7 @@ DMSystemMatrixBase *ModelFittingLeastSquares::buildSystemMatrix(
 void ModelFittingLeastSquares::reset() {
   grid.reset();
   refinementsPerformed = 0;
+  evaluationCache.invalidate();
 }
 
 void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfiguration &solverConfig,
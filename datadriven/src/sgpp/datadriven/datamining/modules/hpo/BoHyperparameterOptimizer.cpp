@@ -60,16 +60,29 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
   std::mt19937 generator(static_cast<size_t>(config.getSeed()));
 
-  // random warmup phase
+  // random warmup phase, the configurations and fitters are created in order
+  std::vector<std::string> configStrings(static_cast<size_t>(config.getNRandom()));
+  std::vector<ModelFittingBase*> fitters(static_cast<size_t>(config.getNRandom()));
+  std::vector<double> results(static_cast<size_t>(config.getNRandom()));
+
   for (int i = 0; i < config.getNRandom(); ++i) {
     initialConfigs.emplace_back(prototype);
     initialConfigs[i].randomize(generator);
     fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
+    configStrings[i] = fitterFactory->printConfig();
+    fitters[i] = fitterFactory->buildFitter();
+  }
+
+  // the random samples are independent, every worker uses its own miner
+  createTrialScheduler().run(fitters.size(), [this, &fitters, &results](size_t worker, size_t i) {
+    SparseGridMiner& workerMiner = getWorkerMiner(worker);
+    workerMiner.setModel(fitters[i]);
+    results[i] = workerMiner.learn(false);
+  });
+
+  for (int i = 0; i < config.getNRandom(); ++i) {
+    const std::string& configString = configStrings[i];
+    double result = results[i];
     initialConfigs[i].setScore(transformScore(result));
     std::cout << (i + 1) << configString << ", " << result;
     if (writeToFile) {
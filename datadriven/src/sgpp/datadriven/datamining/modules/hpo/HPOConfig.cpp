@@ -18,6 +18,8 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  parallelTrials = 1;
+  threadBudget = 0;
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -75,5 +77,21 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+
+int64_t HPOConfig::getParallelTrials() const {
+  return parallelTrials;
+}
+
+void HPOConfig::setParallelTrials(int64_t parallelTrials) {
+  HPOConfig::parallelTrials = parallelTrials;
+}
+
+int64_t HPOConfig::getThreadBudget() const {
+  return threadBudget;
+}
+
+void HPOConfig::setThreadBudget(int64_t threadBudget) {
+  HPOConfig::threadBudget = threadBudget;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -48,6 +48,14 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  int64_t getParallelTrials() const;
+
+  void setParallelTrials(int64_t parallelTrials);
+
+  int64_t getThreadBudget() const;
+
+  void setThreadBudget(int64_t threadBudget);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -77,6 +85,16 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+  /**
+   * Number of trials (model fits) that are run concurrently
+   * (0: one trial per thread of the thread budget)
+   */
+  int64_t parallelTrials;
+  /**
+   * Total number of threads for the trials and their operations
+   * (0: maximal number of OpenMP threads)
+   */
+  int64_t threadBudget;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -50,6 +50,7 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
   int scnt = 1;
   int bestscnt = 0;
   std::string bestconfigstring;
+  const TrialScheduler scheduler = createTrialScheduler();
 
   // loop over stages
   for (size_t q = 0; q < config.getStages().size(); q++) {
@@ -60,11 +61,15 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
     std::vector<std::string> configStrings(nRuns);
     harmonica.prepareConfigs(fitters, static_cast<int>(config.getSeed()), configStrings);
 
-    // run samples (parallelize here)
+    // run samples concurrently, every worker uses its own miner
+    scheduler.run(nRuns, [this, &fitters, &scores](size_t worker, size_t i) {
+      SparseGridMiner& workerMiner = getWorkerMiner(worker);
+      workerMiner.setModel(fitters[i]);
+      scores[i] = workerMiner.learn(false);
+    });
+
+    // output in the order of the samples
     for (size_t i = 0; i < nRuns; i++) {
-      miner->setModel(fitters[i]);
-      scores[i] = miner->learn(false);
-      // hpoScorer->calculateScore(*(fitters[i]), *trainData, &stdDeviation);
       std::cout << scnt << configStrings[i] << ", " << scores[i];
       if (scores[i] < best) {
         best = scores[i];
@@ -6,6 +6,8 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <limits>
@@ -20,5 +22,24 @@ HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
   config.setupDefaults();
   parser.getHPOConfig(config);
 }
+
+size_t HyperparameterOptimizer::getNumberOfWorkers() const {
+  return TrialScheduler(static_cast<size_t>(std::max(config.getParallelTrials(), int64_t{0})),
+                        static_cast<size_t>(std::max(config.getThreadBudget(), int64_t{0})))
+      .getNumberOfWorkers();
+}
+
+void HyperparameterOptimizer::addWorkerMiner(SparseGridMiner* workerMiner) {
+  workerMiners.emplace_back(workerMiner);
+}
+
+TrialScheduler HyperparameterOptimizer::createTrialScheduler() const {
+  return TrialScheduler(std::min(getNumberOfWorkers(), workerMiners.size() + 1),
+                        static_cast<size_t>(std::max(config.getThreadBudget(), int64_t{0})));
+}
+
+SparseGridMiner& HyperparameterOptimizer::getWorkerMiner(size_t worker) {
+  return (worker == 0) ? *miner : *workerMiners[worker - 1];
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
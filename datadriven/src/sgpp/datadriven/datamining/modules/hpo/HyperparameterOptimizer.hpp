@@ -10,8 +10,10 @@
 #include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -69,13 +71,48 @@ class HyperparameterOptimizer {
    */
   virtual double run(bool writeToFile) = 0;
 
+  /**
+   * Returns the number of workers that run trials concurrently as specified in the configuration
+   * (see HPOConfig::getParallelTrials and HPOConfig::getThreadBudget). Trials are only run
+   * concurrently if a miner has been added for every worker except the first one, which uses the
+   * miner passed to the constructor.
+   * @return number of workers
+   */
+  size_t getNumberOfWorkers() const;
+
+  /**
+   * Adds a miner for a worker that runs trials concurrently. The miner has to be configured like
+   * the miner passed to the constructor, but with its own data source, scorer, and visualizer.
+   * @param workerMiner the miner. The HyperparameterOptimizer instance will take ownership of the
+   * passed object.
+   */
+  void addWorkerMiner(SparseGridMiner* workerMiner);
+
 
  protected:
+  /**
+   * Creates the scheduler that runs trials concurrently with the miners of the workers.
+   * @return the scheduler
+   */
+  TrialScheduler createTrialScheduler() const;
+
+  /**
+   * Returns the miner of a worker of the scheduler.
+   * @param worker index of the worker (0 refers to the miner passed to the constructor)
+   * @return the miner
+   */
+  SparseGridMiner& getWorkerMiner(size_t worker);
+
   /**
    * Miner providing all testing facilities
    */
   std::unique_ptr<SparseGridMiner> miner;
 
+  /**
+   * Miners of further workers that run trials concurrently
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> workerMiners;
+
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
    */
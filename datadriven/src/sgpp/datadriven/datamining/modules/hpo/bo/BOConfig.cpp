@@ -62,6 +62,10 @@ double BOConfig::getTotalDistance(const base::DataVector &input, base::DataVecto
   return tmp;
 }
 
+double BOConfig::getDiscDistance() const {
+  return discDistance;
+}
+
 size_t BOConfig::getContSize() {
   return cont.size();
 }
@@ -53,6 +53,12 @@ class BOConfig {
    */
   double getTotalDistance(const base::DataVector &input, base::DataVector &scales);
 
+  /**
+   * Get the discrete part of the distance computed by the last call of calcDiscDistance
+   * @return discrete part of the distance
+   */
+  double getDiscDistance() const;
+
   /**
    * Get number of continuous parameters
    * @return number of continuous parameters
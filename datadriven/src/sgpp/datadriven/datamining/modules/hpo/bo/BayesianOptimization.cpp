@@ -12,13 +12,38 @@
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/MultiStart.hpp>
 
-#include <vector>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+/**
+ * Acquisition function of a BayesianOptimization object, which also supports the evaluation
+ * at multiple points at once.
+ */
+class AcquisitionFunction : public base::ScalarFunction {
+ public:
+  AcquisitionFunction(size_t d, BayesianOptimization &bo) : base::ScalarFunction(d), bo(bo) {}
+
+  double eval(const base::DataVector &x) override { return bo.acquisitionOuter(x); }
+
+  void eval(const base::DataMatrix &x, base::DataVector &value) override {
+    bo.acquisitionOuter(x, value);
+  }
+
+  void clone(std::unique_ptr<base::ScalarFunction> &clone) const override {
+    clone = std::unique_ptr<base::ScalarFunction>(new AcquisitionFunction(d, bo));
+  }
+
+ protected:
+  BayesianOptimization &bo;
+};
+}  // namespace
+
 BayesianOptimization::BayesianOptimization(const std::vector<BOConfig> &initialConfigs)
     : kernelmatrix(initialConfigs.size(), initialConfigs.size()),
       gleft(),
@@ -75,10 +100,7 @@ double BayesianOptimization::var(base::DataVector &knew, double kself) {
 
 BOConfig BayesianOptimization::main(BOConfig &prototype) {
   BOConfig nextconfig(prototype);
-  base::WrapperScalarFunction wrapper(prototype.getContSize(),
-                                              std::bind(&BayesianOptimization::acquisitionOuter,
-                                                        this,
-                                                        std::placeholders::_1));
+  AcquisitionFunction wrapper(prototype.getContSize(), *this);
   double min = std::numeric_limits<double>::infinity();
   BOConfig bestConfig;
   do {
@@ -102,13 +124,73 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
 }
 
 double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
-  base::DataVector kernelrow(allConfigs.size());
-  for (size_t i = 0; i < allConfigs.size(); i++) {
-    kernelrow[i] = kernel(allConfigs[i].getTotalDistance(inp, scales));
+  base::DataMatrix points(1, inp.size());
+  points.setRow(0, inp);
+  base::DataVector values(1);
+  acquisitionOuter(points, values);
+  return values[0];
+}
+
+void BayesianOptimization::acquisitionOuter(const base::DataMatrix &points,
+                                            base::DataVector &values) {
+  const size_t n = allConfigs.size();
+  const size_t nPoints = points.getNrows();
+  const size_t nCont = points.getNcols();
+  values.resize(nPoints);
+
+  // continuous parameters of the samples in contiguous memory, the discrete part of the distances
+  // has been computed by calcDiscDistance
+  base::DataMatrix samples(n, nCont);
+  base::DataVector discDistances(n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t t = 0; t < nCont; t++) {
+      samples.set(i, t, allConfigs[i].getCont(t));
+    }
+
+    discDistances[i] = allConfigs[i].getDiscDistance();
+  }
+
+  bool varFailed = false;
+
+#pragma omp parallel if (nPoints > 1) reduction(|| : varFailed)
+  {
+    base::DataVector kernelrow(n);
+
+#pragma omp for schedule(static)
+    for (size_t j = 0; j < nPoints; j++) {
+      const double *point = points.getPointer() + j * nCont;
+
+      for (size_t i = 0; i < n; i++) {
+        const double *sample = samples.getPointer() + i * nCont;
+        double distance = discDistances[i];
+
+        for (size_t t = 0; t < nCont; t++) {
+          const double diff = scales[t] * (sample[t] - point[t]);
+          distance += diff * diff;
+        }
+
+        kernelrow[i] = kernel(distance);
+      }
+
+      const double m = mean(kernelrow);
+      // k^T K^{-1} k = |L^{-1} k|^2, no backward substitution needed
+      forwardSubstitution(gleft, kernelrow.getPointer());
+      double v = 1 - kernelrow.dotProduct(kernelrow);
+
+      if (v > 1 || v < 0) {
+        varFailed = true;
+        v = 0;
+      }
+
+      values[j] = acquisitionEI(m, v, bestsofar);
+    }
+  }
+
+  if (varFailed) {
+#pragma omp atomic write
+    screwedvar = true;
   }
-  double m = mean(kernelrow);
-  double v = var(kernelrow, 1);
-  return acquisitionEI(m, v, bestsofar);
 }
 
 void BayesianOptimization::setScales(base::DataVector nscales, double factor) {
@@ -170,10 +252,11 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   allConfigs.push_back(newConfig);
   double noise = pow(10, -scales.back() * 10);
   size_t size = kernelmatrix.getNcols();
-  kernelmatrix.appendRow();
-  kernelmatrix.appendCol(base::DataVector(size + 1));
+  base::DataVector knew(size);
+  kernelmatrix.resizeQuadratic(size + 1);
   for (size_t i = 0; i < size; ++i) {
     double tmp = kernel(allConfigs[i].getScaledDistance(newConfig, scales));
+    knew[i] = tmp;
     kernelmatrix.set(size, i, tmp);
     kernelmatrix.set(i, size, tmp);
     rawScores[i] = allConfigs[i].getScore();
@@ -181,7 +264,8 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   kernelmatrix.set(size, size, 1 + noise);
   rawScores.push_back(newConfig.getScore());
 
-  decomposeCholesky(kernelmatrix, gleft);
+  // the scales did not change, so only the new row of the decomposition has to be computed
+  extendCholesky(gleft, knew, 1 + noise);
   if (normalize) {
     if (rawScores.min() < rawScores.max()) {
       rawScores.normalize();
@@ -235,6 +319,55 @@ void BayesianOptimization::decomposeCholesky(base::DataMatrix &km, base::DataMat
   }
 }
 
+void BayesianOptimization::extendCholesky(base::DataMatrix &gmatrix, const base::DataVector &knew,
+                                          double kself) {
+  const size_t n = knew.size();
+
+  if (gmatrix.getNrows() != n) {
+    throw base::data_exception(
+        "BayesianOptimization::extendCholesky : size of decomposition and kernel row mismatch");
+  }
+
+  // new row l of the decomposition solves L l = knew, the diagonal entry is sqrt(kself - l^T l)
+  base::DataVector row(knew);
+  forwardSubstitution(gmatrix, row.getPointer());
+  double sum = kself;
+
+  for (size_t k = 0; k < n; k++) {
+    sum = sum - row[k] * row[k];
+  }
+
+  gmatrix.resizeQuadratic(n + 1);
+
+  for (size_t k = 0; k < n; k++) {
+    gmatrix.set(n, k, row[k]);
+    gmatrix.set(k, n, 0);
+  }
+
+  if (sum > 0) {
+    gmatrix.set(n, n, std::sqrt(sum));
+  } else {
+    decomFailed = true;
+    gmatrix.set(n, n, 1e-7);
+  }
+}
+
+void BayesianOptimization::forwardSubstitution(const base::DataMatrix &gmatrix, double *x) {
+  const size_t n = gmatrix.getNrows();
+  const double *g = gmatrix.getPointer();
+
+  for (size_t i = 0; i < n; i++) {
+    const double *row = g + i * n;
+    double sum = x[i];
+
+    for (size_t k = 0; k < i; k++) {
+      sum -= row[k] * x[k];
+    }
+
+    x[i] = sum / row[i];
+  }
+}
+
 void BayesianOptimization::solveCholeskySystem(base::DataMatrix &gmatrix, base::DataVector &x) {
   for (size_t i = 0; i < x.size(); i++) {
     x[i] = x[i] / gmatrix.get(i, i);
@@ -34,6 +34,13 @@ class BayesianOptimization {
    */
   double acquisitionOuter(const base::DataVector &inp);
 
+  /**
+   * Evaluates the acquisition function for a set of candidate points in parallel
+   * @param points continuous parts of the candidate points (row-wise)
+   * @param[out] values scores to optimize on
+   */
+  void acquisitionOuter(const base::DataMatrix &points, base::DataVector &values);
+
   /**
    * Gaussian Process update step. Incorporates most recent sample into Gaussian Process.
    */
@@ -51,6 +58,15 @@ class BayesianOptimization {
    */
   void decomposeCholesky(base::DataMatrix &km, base::DataMatrix &gnew);
 
+  /**
+   * Extend a Cholesky Decomposition by one row and column in O(n^2) after a sample point
+   * has been appended to the Gram matrix
+   * @param[in,out] gmatrix decomposed matrix, is extended by one row and column
+   * @param knew kernel values between the new and the existing sample points
+   * @param kself kernel value of the new sample point (including noise)
+   */
+  void extendCholesky(base::DataMatrix &gmatrix, const base::DataVector &knew, double kself);
+
   /**
    * Solve a system of linear equations using previously decomposed matrix
    * @param gmatrix decomposed matrix
@@ -93,6 +109,13 @@ class BayesianOptimization {
   void setScales(base::DataVector nscales, double factor);
 
  protected:
+  /**
+   * Solve a system of linear equations with the lower triangular factor of a decomposed matrix
+   * @param gmatrix decomposed matrix
+   * @param[in,out] x right-hand side, is overwritten by the solution
+   */
+  static void forwardSubstitution(const base::DataMatrix &gmatrix, double *x);
+
   /**
    * Gram matrix containing all kernel values between all existing samples
    */
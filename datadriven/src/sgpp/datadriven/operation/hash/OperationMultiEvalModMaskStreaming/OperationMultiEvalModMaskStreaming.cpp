@@ -169,6 +169,14 @@ double OperationMultiEvalModMaskStreaming::getDuration() { return this->duration
 
 void OperationMultiEvalModMaskStreaming::prepare() { this->recalculateLevelIndexMask(); }
 
+bool OperationMultiEvalModMaskStreaming::updateDataset() {
+  // pad and transpose the new data set, the grid arrays (level, index, mask, offset) stay valid
+  this->preparedDataset = this->dataset;
+  this->padDataset(this->preparedDataset);
+  this->preparedDataset.transpose();
+  return true;
+}
+
 void OperationMultiEvalModMaskStreaming::recalculateLevelIndexMask() {
   size_t localWorkSize = this->getChunkGridPoints();
 
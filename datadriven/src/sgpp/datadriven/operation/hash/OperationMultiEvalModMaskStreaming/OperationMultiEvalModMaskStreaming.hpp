@@ -60,6 +60,8 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   void prepare() override;
 
+  bool updateDataset() override;
+
   double getDuration() override;
 
  private:
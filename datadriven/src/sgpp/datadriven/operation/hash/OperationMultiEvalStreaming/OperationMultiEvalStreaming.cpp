@@ -179,5 +179,13 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
 void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
+
+bool OperationMultiEvalStreaming::updateDataset() {
+  // pad and transpose the new data set, the level and index arrays stay valid
+  this->preparedDataset = this->dataset;
+  this->padDataset(this->preparedDataset);
+  this->preparedDataset.transpose();
+  return true;
+}
 }  // namespace datadriven
 }  // namespace sgpp
@@ -51,6 +51,8 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   void prepare() override;
 
+  bool updateDataset() override;
+
   double getDuration() override;
 
  private:
@@ -15,7 +15,9 @@ namespace sgpp {
 namespace datadriven {
 
 /**
- * keep applying marginalize to function until it's reduced to only 1 dimension
+ * Inverse Rosenblatt transformation of a sparse grid density with piecewise linear basis functions.
+ * The one-dimensional conditional densities are evaluated directly on the full grid
+ * (see RosenblattTransformationEngineLinear).
  */
 
 class OperationInverseRosenblattTransformationLinear
@@ -46,12 +48,11 @@ class OperationInverseRosenblattTransformationLinear
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* cdfs1d, base::DataVector* coords1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t op_dim,
-                                    base::DataVector* cdfs1d, base::DataVector* coords1d,
-                                    size_t& curr_dim);
-  double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Checks the dimensionality of the grid and the start dimensions.
+   */
+  void checkDimensions(size_t dim_start) const;
 };
 }  // namespace datadriven
 }  // namespace sgpp
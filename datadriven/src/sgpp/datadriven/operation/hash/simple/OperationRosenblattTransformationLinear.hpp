@@ -15,7 +15,9 @@ namespace sgpp {
 namespace datadriven {
 
 /**
- * keep applying marginalize to function until it's reduced to only 1 dimension
+ * Rosenblatt transformation of a sparse grid density with piecewise linear basis functions.
+ * The one-dimensional conditional densities are evaluated directly on the full grid
+ * (see RosenblattTransformationEngineLinear).
  */
 
 class OperationRosenblattTransformationLinear : public OperationRosenblattTransformation {
@@ -46,12 +48,11 @@ class OperationRosenblattTransformationLinear : public OperationRosenblattTransf
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* coords1d, base::DataVector* cdfs1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t dim_x,
-                                    base::DataVector* coords1d, base::DataVector* cdfs1d,
-                                    size_t& curr_dim);
-  virtual double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Checks the dimensionality of the grid and the start dimensions.
+   */
+  void checkDimensions(size_t dim_start) const;
 };
 
 }  // namespace datadriven
@@ -0,0 +1,479 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/RosenblattTransformationEngineLinear.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+const size_t RosenblattTransformationEngineLinear::blockSize;
+const size_t RosenblattTransformationEngineLinear::maxCachedPrefix;
+const size_t RosenblattTransformationEngineLinear::maxCachedCells;
+
+RosenblattTransformationEngineLinear::RosenblattTransformationEngineLinear(
+    base::Grid& grid, const base::DataVector& alpha)
+    : dim(grid.getDimension()), gridSize(grid.getSize()) {
+  base::GridStorage& storage = grid.getStorage();
+
+  if (alpha.getSize() != gridSize) {
+    throw base::operation_exception(
+        "RosenblattTransformationEngineLinear: size of alpha does not match the grid size");
+  }
+
+  nodeOfPoint.resize(dim * gridSize);
+  nodeLevels.resize(dim);
+  nodeIndices.resize(dim);
+  nodeScales.resize(dim);
+  maxLevels.assign(dim, 0);
+  nodeNumbers.resize(dim);
+  sortedNodes.resize(dim);
+  sortedCoordinates.resize(dim);
+  ancestorsStart.resize(dim);
+  ancestorNodes.resize(dim);
+  ancestorValues.resize(dim);
+  cellBoundaries.resize(dim);
+  initialWeights.resize(gridSize);
+
+  // project the grid points to the one-dimensional grids and compute the weights, i.e., the
+  // coefficients marginalized over all dimensions
+  for (size_t p = 0; p < gridSize; p++) {
+    base::GridPoint& gp = storage.getPoint(p);
+    double weight = alpha[p];
+
+    for (size_t t = 0; t < dim; t++) {
+      const base::level_t level = gp.getLevel(t);
+      const base::index_t index = gp.getIndex(t);
+      auto inserted = nodeNumbers[t].insert(
+          std::make_pair(std::make_pair(level, index), nodeLevels[t].size()));
+
+      if (inserted.second) {
+        nodeLevels[t].push_back(level);
+        nodeIndices[t].push_back(index);
+        nodeScales[t].push_back(std::ldexp(1.0, static_cast<int>(level)));
+        maxLevels[t] = std::max(maxLevels[t], level);
+      }
+
+      nodeOfPoint[t * gridSize + p] = inserted.first->second;
+      weight /= nodeScales[t][inserted.first->second];
+    }
+
+    initialWeights[p] = weight;
+  }
+
+  // sort the one-dimensional grid points and store their hierarchical ancestors, such that
+  // one-dimensional densities can be evaluated at all grid points in linear time
+  for (size_t t = 0; t < dim; t++) {
+    const size_t n = nodeLevels[t].size();
+    std::vector<double> coordinates(n);
+
+    for (size_t j = 0; j < n; j++) {
+      coordinates[j] = static_cast<double>(nodeIndices[t][j]) / nodeScales[t][j];
+    }
+
+    sortedNodes[t].resize(n);
+    std::iota(sortedNodes[t].begin(), sortedNodes[t].end(), 0);
+    std::sort(sortedNodes[t].begin(), sortedNodes[t].end(),
+              [&coordinates](size_t a, size_t b) { return coordinates[a] < coordinates[b]; });
+
+    sortedCoordinates[t].resize(n + 2);
+    sortedCoordinates[t][0] = 0.0;
+    sortedCoordinates[t][n + 1] = 1.0;
+    ancestorsStart[t].resize(n + 1);
+    ancestorsStart[t][0] = 0;
+
+    for (size_t k = 0; k < n; k++) {
+      const double x = coordinates[sortedNodes[t][k]];
+      sortedCoordinates[t][k + 1] = x;
+
+      for (base::level_t level = 1; level <= nodeLevels[t][sortedNodes[t][k]]; level++) {
+        const base::index_t index =
+            2 * static_cast<base::index_t>(std::floor(std::ldexp(x, static_cast<int>(level) - 1))) +
+            1;
+        auto it = nodeNumbers[t].find(std::make_pair(level, index));
+
+        if (it != nodeNumbers[t].end()) {
+          const double value = evalBasis(level, index, x);
+
+          if (value != 0.0) {
+            ancestorNodes[t].push_back(it->second);
+            ancestorValues[t].push_back(value);
+          }
+        }
+      }
+
+      ancestorsStart[t][k + 1] = ancestorNodes[t].size();
+    }
+
+    // the hat functions are linear between their centers and the ends of their supports
+    cellBoundaries[t].assign({0.0, 1.0});
+
+    for (size_t j = 0; j < n; j++) {
+      const double h = 1.0 / nodeScales[t][j];
+      cellBoundaries[t].push_back(coordinates[j] - h);
+      cellBoundaries[t].push_back(coordinates[j]);
+      cellBoundaries[t].push_back(coordinates[j] + h);
+    }
+
+    std::sort(cellBoundaries[t].begin(), cellBoundaries[t].end());
+    cellBoundaries[t].erase(std::unique(cellBoundaries[t].begin(), cellBoundaries[t].end()),
+                            cellBoundaries[t].end());
+  }
+
+  marginalTables.resize(dim);
+
+  for (size_t t = 0; t < dim; t++) {
+    computeCoefficients(t, initialWeights, marginalTables[t].coefficients);
+    computeTable(t, 1.0, marginalTables[t]);
+  }
+}
+
+void RosenblattTransformationEngineLinear::transform(const base::DataMatrix& points,
+                                                     base::DataMatrix& pointscdf,
+                                                     const std::vector<size_t>& startDims) const {
+  transformAll(points, pointscdf, startDims, false);
+}
+
+void RosenblattTransformationEngineLinear::inverseTransform(
+    const base::DataMatrix& pointscdf, base::DataMatrix& points,
+    const std::vector<size_t>& startDims) const {
+  transformAll(pointscdf, points, startDims, true);
+}
+
+double RosenblattTransformationEngineLinear::evalBasis(base::level_t level, base::index_t index,
+                                                       double x) {
+  return std::max(1.0 - std::abs(std::ldexp(x, static_cast<int>(level)) -
+                                 static_cast<double>(index)),
+                  0.0);
+}
+
+void RosenblattTransformationEngineLinear::computeCoefficients(
+    size_t t, const std::vector<double>& weights, std::vector<double>& coefficients) const {
+  const size_t* nodes = &nodeOfPoint[t * gridSize];
+  coefficients.assign(nodeLevels[t].size(), 0.0);
+
+  for (size_t p = 0; p < gridSize; p++) {
+    coefficients[nodes[p]] += weights[p] * nodeScales[t][nodes[p]];
+  }
+}
+
+void RosenblattTransformationEngineLinear::computeTable(size_t t, double sign,
+                                                        CDFTable& table) const {
+  const size_t n = nodeLevels[t].size();
+  const std::vector<double>& x = sortedCoordinates[t];
+
+  // values at the sorted grid points and at the boundary
+  std::vector<double> pdf(n + 2, 0.0);
+
+  for (size_t k = 0; k < n; k++) {
+    double value = 0.0;
+
+    for (size_t a = ancestorsStart[t][k]; a < ancestorsStart[t][k + 1]; a++) {
+      value += table.coefficients[ancestorNodes[t][a]] * ancestorValues[t][a];
+    }
+
+    pdf[k + 1] = sign * value;
+  }
+
+  // make sure that all the pdf values are positive,
+  // if not, interpolate between the left neighbor and the next positive right neighbor
+  std::vector<double> nextPositive(n + 3, 0.0);
+
+  for (size_t k = n + 2; k-- > 0;) {
+    nextPositive[k] = (pdf[k] > 0.0) ? pdf[k] : nextPositive[k + 1];
+  }
+
+  pdf[0] = std::max(pdf[0], 0.0);
+
+  for (size_t k = 1; k < n + 2; k++) {
+    if (pdf[k] < 0.0) {
+      pdf[k] = (pdf[k - 1] + nextPositive[k + 1]) / 2.0;
+    }
+  }
+
+  // composite trapezoidal rule, the cdf is accumulated in one pass
+  table.cdf.resize(n + 2);
+  table.cdf[0] = 0.0;
+  double sum = 0.0;
+
+  for (size_t k = 1; k < n + 2; k++) {
+    // clip negative areas to keep the cdf monotonically increasing
+    sum += std::max((x[k] - x[k - 1]) / 2 * (pdf[k - 1] + pdf[k]), 0.0);
+    table.cdf[k] = sum;
+  }
+
+  if (sum > 0.0) {
+    for (size_t k = 0; k < n + 2; k++) {
+      table.cdf[k] /= sum;
+    }
+  } else {
+    // no positive mass (e.g., the sample lies outside the support of the density),
+    // fall back to the uniform distribution on [0, 1]
+    for (size_t k = 0; k < n + 2; k++) {
+      table.cdf[k] = x[k];
+    }
+  }
+}
+
+double RosenblattTransformationEngineLinear::evalDensity(size_t t,
+                                                         const std::vector<double>& coefficients,
+                                                         double x) const {
+  double result = 0.0;
+
+  for (base::level_t level = 1; level <= maxLevels[t]; level++) {
+    const double scaled = std::ldexp(x, static_cast<int>(level) - 1);
+
+    if ((scaled < 0.0) || (scaled >= std::ldexp(1.0, static_cast<int>(level) - 1))) {
+      continue;
+    }
+
+    const base::index_t index = 2 * static_cast<base::index_t>(std::floor(scaled)) + 1;
+    auto it = nodeNumbers[t].find(std::make_pair(level, index));
+
+    if (it != nodeNumbers[t].end()) {
+      result += coefficients[it->second] * evalBasis(level, index, x);
+    }
+  }
+
+  return result;
+}
+
+double RosenblattTransformationEngineLinear::evalCDF(size_t t, const CDFTable& table,
+                                                     double x) const {
+  const std::vector<double>& coordinates = sortedCoordinates[t];
+  size_t k = std::lower_bound(coordinates.begin(), coordinates.end(), x) - coordinates.begin();
+  k = std::min(std::max<size_t>(k, 1), coordinates.size() - 1);
+
+  const double x1 = coordinates[k - 1], x2 = coordinates[k];
+  const double y1 = table.cdf[k - 1], y2 = table.cdf[k];
+  // linear interpolation: (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+  return (y2 - y1) / (x2 - x1) * (x - x1) + y1;
+}
+
+double RosenblattTransformationEngineLinear::evalInverseCDF(size_t t, const CDFTable& table,
+                                                            double u) const {
+  const std::vector<double>& coordinates = sortedCoordinates[t];
+  size_t k = std::lower_bound(table.cdf.begin(), table.cdf.end(), u) - table.cdf.begin();
+  k = std::min(std::max<size_t>(k, 1), table.cdf.size() - 1);
+
+  const double x1 = coordinates[k - 1], x2 = coordinates[k];
+  const double y1 = table.cdf[k - 1], y2 = table.cdf[k];
+
+  if (y2 <= y1) {
+    // u is on the lower end of an interval without mass
+    return x1;
+  }
+
+  // linear interpolation: (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+  return (x2 - x1) / (y2 - y1) * (u - y1) + x1;
+}
+
+void RosenblattTransformationEngineLinear::condition(size_t t, double x,
+                                                     std::vector<double>& weights) const {
+  const size_t n = nodeLevels[t].size();
+  const size_t* nodes = &nodeOfPoint[t * gridSize];
+  std::vector<double> factors(n);
+
+  // conditioning replaces the integral of the basis function by its value at x
+  for (size_t j = 0; j < n; j++) {
+    factors[j] = evalBasis(nodeLevels[t][j], nodeIndices[t][j], x) * nodeScales[t][j];
+  }
+
+  for (size_t p = 0; p < gridSize; p++) {
+    weights[p] *= factors[nodes[p]];
+  }
+}
+
+size_t RosenblattTransformationEngineLinear::findCell(size_t t, double x) const {
+  const std::vector<double>& boundaries = cellBoundaries[t];
+  const size_t k =
+      std::upper_bound(boundaries.begin(), boundaries.end(), x) - boundaries.begin();
+  // x = 1 belongs to the last cell
+  return std::min(k, boundaries.size() - 1) - 1;
+}
+
+void RosenblattTransformationEngineLinear::computeCorners(const std::vector<size_t>& key,
+                                                          std::vector<double>& corners,
+                                                          std::vector<double>& weights) const {
+  const size_t start = key[0];
+  const size_t k = key.size() - 1;
+  const size_t t = (start + k) % dim;
+  const size_t n = nodeLevels[t].size();
+  std::vector<double> coefficients;
+  corners.resize((static_cast<size_t>(1) << k) * n);
+
+  for (size_t c = 0; c < (static_cast<size_t>(1) << k); c++) {
+    weights = initialWeights;
+
+    for (size_t j = 0; j < k; j++) {
+      const size_t s = (start + j) % dim;
+      condition(s, cellBoundaries[s][key[j + 1] + ((c >> j) & 1)], weights);
+    }
+
+    computeCoefficients(t, weights, coefficients);
+    std::copy(coefficients.begin(), coefficients.end(), corners.begin() + c * n);
+  }
+}
+
+void RosenblattTransformationEngineLinear::transformAll(const base::DataMatrix& input,
+                                                        base::DataMatrix& output,
+                                                        const std::vector<size_t>& startDims,
+                                                        bool inverse) const {
+  const size_t numSamples = input.getNrows();
+
+  if ((input.getNcols() != dim) || (startDims.size() != numSamples)) {
+    throw base::operation_exception(
+        "RosenblattTransformationEngineLinear: dimensions of the samples do not match");
+  }
+
+  for (size_t i = 0; i < numSamples; i++) {
+    if (startDims[i] >= dim) {
+      throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+    }
+  }
+
+  output.resize(numSamples, dim);
+
+  // sort the samples by their start dimension and their coordinates in the order of processing,
+  // such that samples in the same cells are transformed one after another by the same thread
+  std::vector<size_t> order(numSamples);
+  std::iota(order.begin(), order.end(), 0);
+  const double* data = input.data();
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (startDims[a] != startDims[b]) {
+      return startDims[a] < startDims[b];
+    }
+
+    for (size_t k = 0; k < dim; k++) {
+      const size_t t = (startDims[a] + k) % dim;
+
+      if (data[a * dim + t] != data[b * dim + t]) {
+        return data[a * dim + t] < data[b * dim + t];
+      }
+    }
+
+    return a < b;
+  });
+
+  const size_t numBlocks = (numSamples + blockSize - 1) / blockSize;
+  double* result = output.data();
+
+#pragma omp parallel
+  {
+    CellCache cache;
+    std::vector<double> weights;
+    CDFTable table;
+
+#pragma omp for schedule(dynamic)
+    for (size_t b = 0; b < numBlocks; b++) {
+      for (size_t j = b * blockSize; j < std::min((b + 1) * blockSize, numSamples); j++) {
+        const size_t i = order[j];
+        transformSample(data + i * dim, result + i * dim, startDims[i], inverse, cache, weights,
+                        table);
+      }
+    }
+  }
+}
+
+void RosenblattTransformationEngineLinear::transformSample(const double* input, double* output,
+                                                           size_t start, bool inverse,
+                                                           CellCache& cache,
+                                                           std::vector<double>& weights,
+                                                           CDFTable& table) const {
+  // start dimension followed by the cells of the processed dimensions
+  std::vector<size_t> key(1, start);
+  // whether the cells of all processed dimensions are in the key
+  bool cellsKnown = true;
+  // number of dimensions the weights are conditioned on (none if the weights are not initialized)
+  size_t conditioned = 0;
+  bool initialized = false;
+  // product of the signs of the marginal densities the conditionals have been divided by
+  double sign = 1.0;
+
+  for (size_t k = 0; k < dim; k++) {
+    const size_t t = (start + k) % dim;
+    const CDFTable* current = &marginalTables[start];
+
+    if (k > 0) {
+      const size_t s = (start + k - 1) % dim;
+      const double x = inverse ? output[s] : input[s];
+      cellsKnown = cellsKnown && (k <= maxCachedPrefix) && (x >= 0.0) && (x <= 1.0);
+
+      if (cellsKnown) {
+        key.push_back(findCell(s, x));
+        auto it = cache.find(key);
+
+        if (it == cache.end()) {
+          if (cache.size() >= maxCachedCells) {
+            cache.clear();
+          }
+
+          it = cache.insert(std::make_pair(key, std::vector<double>())).first;
+          computeCorners(key, it->second, weights);
+        }
+
+        // multilinear interpolation between the corners of the cell
+        const size_t n = nodeLevels[t].size();
+        table.coefficients.assign(n, 0.0);
+
+        for (size_t c = 0; c < (static_cast<size_t>(1) << k); c++) {
+          double factor = 1.0;
+
+          for (size_t j = 0; j < k; j++) {
+            const size_t r = (start + j) % dim;
+            const double lower = cellBoundaries[r][key[j + 1]];
+            const double upper = cellBoundaries[r][key[j + 1] + 1];
+            const double lambda = ((inverse ? output[r] : input[r]) - lower) / (upper - lower);
+            factor *= ((c >> j) & 1) ? lambda : 1.0 - lambda;
+          }
+
+          const double* corner = &it->second[c * n];
+
+          for (size_t l = 0; l < n; l++) {
+            table.coefficients[l] += factor * corner[l];
+          }
+        }
+      } else {
+        // condition on all dimensions processed before
+        if (!initialized) {
+          weights = initialWeights;
+          initialized = true;
+        }
+
+        for (; conditioned < k; conditioned++) {
+          const size_t r = (start + conditioned) % dim;
+          condition(r, inverse ? output[r] : input[r], weights);
+        }
+
+        computeCoefficients(t, weights, table.coefficients);
+      }
+
+      computeTable(t, sign, table);
+      current = &table;
+    }
+
+    output[t] = inverse ? evalInverseCDF(t, *current, input[t]) : evalCDF(t, *current, input[t]);
+
+    // the next conditional is normalized by the value of this density at the coordinate,
+    // only its sign matters as the tables are normalized by their integrals
+    if ((k + 1 < dim) &&
+        (sign * evalDensity(t, current->coefficients, inverse ? output[t] : input[t]) < 0.0)) {
+      sign = -sign;
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,201 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ROSENBLATTTRANSFORMATIONENGINELINEAR_HPP
+#define ROSENBLATTTRANSFORMATIONENGINELINEAR_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Rosenblatt transformation and its inverse for sparse grid densities with piecewise linear
+ * basis functions (without boundary).
+ *
+ * Starting in a dimension s, the sample is transformed dimension by dimension in the order
+ * s, s+1, ..., d-1, 0, ..., s-1 with the one-dimensional CDF of the density conditioned on the
+ * coordinates of the dimensions that have already been processed and marginalized over the
+ * dimensions that have not been processed yet.
+ *
+ * The conditional one-dimensional densities are computed directly from the coefficients of the
+ * full grid: conditioning multiplies every coefficient by the value of the one-dimensional
+ * basis function, marginalization by its integral. Hence, no intermediate grids are created.
+ * The CDF tables are obtained by trapezoidal integration of the one-dimensional density at the
+ * grid points (as in OperationDensityMargTo1D / OperationDensityConditional followed by the
+ * 1D transformation). As every table is normalized by its integral, the conditional densities
+ * are not divided by the values of the marginal densities (only their signs are kept), and a
+ * density without positive mass yields the uniform CDF.
+ *
+ * Within a cell of the one-dimensional grids (an interval between consecutive grid points or
+ * ends of supports of basis functions), the hat functions are linear. Hence, the coefficients
+ * of a conditional density are multilinear in the coordinates of the first maxCachedPrefix
+ * processed dimensions within the product of their cells. The coefficients at the corners of
+ * such a product cell are cached per thread and interpolated exactly for all samples in the
+ * cell, the conditionals of the remaining dimensions are computed per sample.
+ */
+class RosenblattTransformationEngineLinear {
+ public:
+  /// number of samples that are transformed by one thread at once
+  static const size_t blockSize = 64;
+  /// maximal number of processed dimensions whose cells key the cache of conditional densities
+  static const size_t maxCachedPrefix = 2;
+  /// maximal number of cells cached per thread (the cache is cleared when it is exceeded)
+  static const size_t maxCachedCells = 4096;
+
+  /**
+   * Constructor.
+   *
+   * @param grid    sparse grid with piecewise linear basis functions
+   * @param alpha   coefficients of the density
+   */
+  RosenblattTransformationEngineLinear(base::Grid& grid, const base::DataVector& alpha);
+
+  /**
+   * Rosenblatt transformation.
+   *
+   * @param points          samples (row-wise)
+   * @param[out] pointscdf  transformed samples in the unit hypercube
+   * @param startDims       start dimension for each sample
+   */
+  void transform(const base::DataMatrix& points, base::DataMatrix& pointscdf,
+                 const std::vector<size_t>& startDims) const;
+
+  /**
+   * Inverse Rosenblatt transformation.
+   *
+   * @param pointscdf       samples in the unit hypercube (row-wise)
+   * @param[out] points     transformed samples
+   * @param startDims       start dimension for each sample
+   */
+  void inverseTransform(const base::DataMatrix& pointscdf, base::DataMatrix& points,
+                        const std::vector<size_t>& startDims) const;
+
+ protected:
+  /// one-dimensional (conditional) density and its CDF
+  struct CDFTable {
+    /// hierarchical coefficients of the one-dimensional grid points
+    std::vector<double> coefficients;
+    /// values of the CDF at the sorted coordinates (including 0 and 1)
+    std::vector<double> cdf;
+  };
+
+  /// coefficients of the conditional densities at the corners of the product cells, indexed by
+  /// the start dimension followed by the cells of the processed dimensions
+  typedef std::map<std::vector<size_t>, std::vector<double>> CellCache;
+
+  /// dimensionality
+  size_t dim;
+  /// number of grid points
+  size_t gridSize;
+  /// coefficients multiplied with the integrals of the basis functions
+  std::vector<double> initialWeights;
+  /// one-dimensional grid point of each grid point in each dimension (index t * gridSize + p)
+  std::vector<size_t> nodeOfPoint;
+  /// levels of the one-dimensional grid points in each dimension
+  std::vector<std::vector<base::level_t>> nodeLevels;
+  /// indices of the one-dimensional grid points in each dimension
+  std::vector<std::vector<base::index_t>> nodeIndices;
+  /// inverse integrals 2^l of the one-dimensional basis functions in each dimension
+  std::vector<std::vector<double>> nodeScales;
+  /// maximal level in each dimension
+  std::vector<base::level_t> maxLevels;
+  /// sequence numbers of the one-dimensional grid points in each dimension
+  std::vector<std::map<std::pair<base::level_t, base::index_t>, size_t>> nodeNumbers;
+  /// one-dimensional grid points in each dimension sorted by their coordinates
+  std::vector<std::vector<size_t>> sortedNodes;
+  /// sorted coordinates in each dimension (including 0 and 1)
+  std::vector<std::vector<double>> sortedCoordinates;
+  /// hierarchical ancestors (including the point itself) of the sorted one-dimensional grid
+  /// points and the values of their basis functions (compressed row storage)
+  std::vector<std::vector<size_t>> ancestorsStart;
+  std::vector<std::vector<size_t>> ancestorNodes;
+  std::vector<std::vector<double>> ancestorValues;
+  /// boundaries of the cells on which all hat functions are linear in each dimension
+  std::vector<std::vector<double>> cellBoundaries;
+  /// CDF tables of the marginal densities for every start dimension
+  std::vector<CDFTable> marginalTables;
+
+  /**
+   * Value of a one-dimensional hat function.
+   */
+  static double evalBasis(base::level_t level, base::index_t index, double x);
+
+  /**
+   * Accumulates the hierarchical coefficients of the one-dimensional density in dimension t
+   * for the given weights.
+   */
+  void computeCoefficients(size_t t, const std::vector<double>& weights,
+                           std::vector<double>& coefficients) const;
+
+  /**
+   * Computes the CDF of the table in dimension t from its coefficients, the density is
+   * multiplied by sign (+1 or -1) before negative values are corrected.
+   */
+  void computeTable(size_t t, double sign, CDFTable& table) const;
+
+  /**
+   * Evaluates the one-dimensional density with the given coefficients in dimension t.
+   */
+  double evalDensity(size_t t, const std::vector<double>& coefficients, double x) const;
+
+  /**
+   * Evaluates the CDF of the table in dimension t (linear interpolation).
+   */
+  double evalCDF(size_t t, const CDFTable& table, double x) const;
+
+  /**
+   * Evaluates the inverse CDF of the table in dimension t (linear interpolation).
+   */
+  double evalInverseCDF(size_t t, const CDFTable& table, double u) const;
+
+  /**
+   * Conditions the weights on coordinate x in dimension t (without normalization).
+   */
+  void condition(size_t t, double x, std::vector<double>& weights) const;
+
+  /**
+   * @return cell of coordinate x in dimension t (x has to be in [0, 1])
+   */
+  size_t findCell(size_t t, double x) const;
+
+  /**
+   * Computes the coefficients of the conditional density at the corners of a product cell.
+   *
+   * @param key             start dimension followed by the cells of the first k processed
+   *                        dimensions, the density is the one of dimension (start + k) % dim
+   * @param[out] corners    coefficients at the 2^k corners (bit j of the corner number selects
+   *                        the upper end of the cell in the j-th processed dimension)
+   * @param weights         work array
+   */
+  void computeCorners(const std::vector<size_t>& key, std::vector<double>& corners,
+                      std::vector<double>& weights) const;
+
+  /**
+   * Transforms all samples (forward or inverse), the samples are sorted such that samples in
+   * the same cells are processed by the same thread.
+   */
+  void transformAll(const base::DataMatrix& input, base::DataMatrix& output,
+                    const std::vector<size_t>& startDims, bool inverse) const;
+
+  /**
+   * Transforms one sample.
+   */
+  void transformSample(const double* input, double* output, size_t start, bool inverse,
+                       CellCache& cache, std::vector<double>& weights, CDFTable& table) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* ROSENBLATTTRANSFORMATIONENGINELINEAR_HPP */
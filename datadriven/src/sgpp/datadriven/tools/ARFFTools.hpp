@@ -46,7 +46,7 @@ class ARFFTools {
                            std::vector<double> selectedTargets);
 
   /**
-   * Sequentially reads a ARFF file.
+   * Reads a ARFF file (in parallel, see DatasetParser).
    *
    * @param stream contains the raw data. Note: After this function exists,
    *        stream will be at eof. For further use it should be cleared and 
@@ -115,13 +115,6 @@ class ARFFTools {
                                     size_t instanceCutoff = -1,
                                     std::vector<size_t> selectedCols = std::vector<size_t>(),
                                     std::vector<double> selectedTargets = std::vector<double>());
-
-
- private:
-  /**
-  * Take a comma-sererated line and return its values as double values
-  */
-  static std::vector<double> tokenizeLine(const std::string& line);
 };
 
 }  // namespace datadriven
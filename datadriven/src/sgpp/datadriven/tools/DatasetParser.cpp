@@ -0,0 +1,543 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/DatasetParser.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// minimal number of characters per chunk
+const size_t minChunkSize = 1 << 16;
+
+/**
+ * Read-only content of a file, memory-mapped if supported by the platform.
+ */
+class FileContent {
+ public:
+  explicit FileContent(const std::string& filename) : data(nullptr), size(0), isMapped(false) {
+#ifndef _WIN32
+    const int fd = open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+      throw base::file_exception(("Unable to open file: " + filename).c_str());
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) != 0) {
+      close(fd);
+      throw base::file_exception(("Unable to stat file: " + filename).c_str());
+    }
+
+    size = static_cast<size_t>(fileStat.st_size);
+
+    if (size > 0) {
+      void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (mapped != MAP_FAILED) {
+        data = static_cast<const char*>(mapped);
+        isMapped = true;
+        // the file is read sequentially by every thread
+        madvise(mapped, size, MADV_SEQUENTIAL);
+      }
+    }
+
+    close(fd);
+
+    if (isMapped || (size == 0)) {
+      return;
+    }
+#endif
+
+    // fall back to reading the whole file
+    std::ifstream stream(filename.c_str(), std::ios::binary);
+
+    if (!stream) {
+      throw base::file_exception(("Unable to open file: " + filename).c_str());
+    }
+
+    buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    data = buffer.data();
+    size = buffer.size();
+  }
+
+  ~FileContent() {
+#ifndef _WIN32
+    if (isMapped) {
+      munmap(const_cast<char*>(data), size);
+    }
+#endif
+  }
+
+  FileContent(const FileContent&) = delete;
+  FileContent& operator=(const FileContent&) = delete;
+
+  const char* data;
+  size_t size;
+
+ private:
+  bool isMapped;
+  std::vector<char> buffer;
+};
+
+/**
+ * @param begin pointer into the text
+ * @param end   end of the text
+ * @return pointer to the next newline character (or end)
+ */
+inline const char* findLineEnd(const char* begin, const char* end) {
+  const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+  return (lineEnd != nullptr) ? lineEnd : end;
+}
+
+/**
+ * @param lineEnd end of the current line
+ * @param end     end of the text
+ * @return beginning of the next line (or end)
+ */
+inline const char* nextLine(const char* lineEnd, const char* end) {
+  return (lineEnd < end) ? lineEnd + 1 : end;
+}
+
+/**
+ * @param begin beginning of the token
+ * @param end   end of the line
+ * @return pointer to the next comma (or end)
+ */
+inline const char* findNextComma(const char* begin, const char* end) {
+  const char* comma = static_cast<const char*>(std::memchr(begin, ',', end - begin));
+  return (comma != nullptr) ? comma : end;
+}
+
+/**
+ * @param begin   beginning of the line
+ * @param lineEnd end of the line (newline character or end of the text)
+ * @return end of the line without a trailing carriage return
+ */
+inline const char* stripCarriageReturn(const char* begin, const char* lineEnd) {
+  return ((lineEnd > begin) && (*(lineEnd - 1) == '\r')) ? lineEnd - 1 : lineEnd;
+}
+
+/**
+ * @param begin beginning of the line
+ * @param end   end of the line
+ * @return pointer to the first character of the last comma-separated token
+ */
+inline const char* findLastToken(const char* begin, const char* end) {
+  for (const char* p = end; p > begin; p--) {
+    if (*(p - 1) == ',') {
+      return p;
+    }
+  }
+
+  return begin;
+}
+
+inline bool isSpace(char c) { return (c == ' ') || (c == '\t') || (c == '\r'); }
+
+inline bool isDigit(char c) { return (c >= '0') && (c <= '9'); }
+
+}  // namespace
+
+DatasetParser::DatasetParser(Format format, bool skipFirstLine, bool hasTargets,
+                             size_t instanceCutoff, std::vector<size_t> selectedCols,
+                             std::vector<double> selectedTargets)
+    : format(format),
+      skipFirstLine(skipFirstLine),
+      hasTargets(hasTargets),
+      instanceCutoff(instanceCutoff),
+      selectedCols(selectedCols),
+      selectedTargets(selectedTargets) {}
+
+double DatasetParser::parseDouble(const char* begin, const char* end) {
+  // exactly representable powers of ten
+  static const double powersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                       1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                       1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char* p = begin;
+
+  while ((p < end) && isSpace(*p)) {
+    p++;
+  }
+
+  bool isNegative = false;
+
+  if ((p < end) && ((*p == '-') || (*p == '+'))) {
+    isNegative = (*p == '-');
+    p++;
+  }
+
+  std::uint64_t mantissa = 0;
+  int numberOfDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  bool isSimple = true;
+
+  while ((p < end) && isDigit(*p)) {
+    mantissa = 10 * mantissa + static_cast<std::uint64_t>(*p - '0');
+    numberOfDigits += (mantissa != 0) ? 1 : 0;
+    hasDigits = true;
+    p++;
+
+    if (numberOfDigits > 15) {
+      isSimple = false;
+      break;
+    }
+  }
+
+  if (isSimple && (p < end) && (*p == '.')) {
+    p++;
+
+    while ((p < end) && isDigit(*p)) {
+      mantissa = 10 * mantissa + static_cast<std::uint64_t>(*p - '0');
+      numberOfDigits += (mantissa != 0) ? 1 : 0;
+      exponent--;
+      hasDigits = true;
+      p++;
+
+      if (numberOfDigits > 15) {
+        isSimple = false;
+        break;
+      }
+    }
+  }
+
+  if (isSimple && hasDigits && (p < end) && ((*p == 'e') || (*p == 'E'))) {
+    p++;
+    bool isExponentNegative = false;
+
+    if ((p < end) && ((*p == '-') || (*p == '+'))) {
+      isExponentNegative = (*p == '-');
+      p++;
+    }
+
+    int explicitExponent = 0;
+    bool hasExponentDigits = false;
+
+    while ((p < end) && isDigit(*p) && (explicitExponent < 1000)) {
+      explicitExponent = 10 * explicitExponent + (*p - '0');
+      hasExponentDigits = true;
+      p++;
+    }
+
+    isSimple = hasExponentDigits;
+    exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+  }
+
+  while ((p < end) && isSpace(*p)) {
+    p++;
+  }
+
+  if (isSimple && hasDigits && (p == end)) {
+    if (mantissa == 0) {
+      return isNegative ? -0.0 : 0.0;
+    } else if ((exponent >= -22) && (exponent <= 22)) {
+      // both factors are exact, hence the result is correctly rounded
+      const double value = (exponent >= 0) ? static_cast<double>(mantissa) * powersOfTen[exponent]
+                                           : static_cast<double>(mantissa) / powersOfTen[-exponent];
+      return isNegative ? -value : value;
+    }
+  }
+
+  // long mantissas, large exponents, special values (nan, inf), and invalid tokens
+  char buffer[64];
+  const size_t length = end - begin;
+
+  if (length < sizeof(buffer)) {
+    // avoid the allocation of a string for usual token lengths
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    return std::atof(buffer);
+  } else {
+    const std::string token(begin, end);
+    return std::atof(token.c_str());
+  }
+}
+
+bool DatasetParser::isDataLine(const char* begin, const char* end) const {
+  if (begin == end) {
+    return false;
+  } else if (format == Format::ARFF) {
+    // skip comments and the header
+    return (std::memchr(begin, '%', end - begin) == nullptr) &&
+           (std::memchr(begin, '@', end - begin) == nullptr);
+  } else {
+    return true;
+  }
+}
+
+bool DatasetParser::isSelectedTarget(const char* begin, const char* end) const {
+  const double target = parseDouble(begin, end);
+
+  for (size_t i = 0; i < selectedTargets.size(); i++) {
+    if (std::fabs(target - selectedTargets[i]) < 0.001) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+size_t DatasetParser::countLines(const char* data, size_t size, std::vector<Chunk>& chunks,
+                                 size_t& numberOfCommas) const {
+  const char* end = data + size;
+  const char* dataBegin = end;
+  bool skipLine = skipFirstLine;
+  numberOfCommas = 0;
+  chunks.clear();
+
+  // skip the header and determine the number of columns with the first data line
+  for (const char* p = data; p < end;) {
+    const char* lineEnd = findLineEnd(p, end);
+    const char* contentEnd = stripCarriageReturn(p, lineEnd);
+
+    if (isDataLine(p, contentEnd)) {
+      if (skipLine) {
+        skipLine = false;
+      } else {
+        numberOfCommas = std::count(p, contentEnd, ',');
+        dataBegin = p;
+        break;
+      }
+    }
+
+    p = nextLine(lineEnd, end);
+  }
+
+  if (dataBegin == end) {
+    return 0;
+  }
+
+  // split the data at line boundaries
+  const size_t dataSize = end - dataBegin;
+#ifdef _OPENMP
+  const size_t numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t numberOfThreads = 1;
+#endif
+  const size_t numberOfChunks =
+      std::max<size_t>(1, std::min<size_t>(4 * numberOfThreads, dataSize / minChunkSize));
+  const char* chunkBegin = dataBegin;
+
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    const char* chunkEnd = end;
+
+    if (c < numberOfChunks - 1) {
+      chunkEnd = std::max(chunkBegin, dataBegin + (c + 1) * dataSize / numberOfChunks);
+
+      if ((chunkEnd > dataBegin) && (chunkEnd < end) && (*(chunkEnd - 1) != '\n')) {
+        chunkEnd = std::min(findLineEnd(chunkEnd, end) + 1, end);
+      }
+    }
+
+    chunks.push_back(Chunk{chunkBegin, chunkEnd, 0, 0, false});
+    chunkBegin = chunkEnd;
+  }
+
+  const bool filterTargets = hasTargets && !selectedTargets.empty();
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t c = 0; c < chunks.size(); c++) {
+    Chunk& chunk = chunks[c];
+
+    for (const char* p = chunk.begin; p < chunk.end;) {
+      const char* lineEnd = findLineEnd(p, chunk.end);
+      const char* contentEnd = stripCarriageReturn(p, lineEnd);
+
+      if (isDataLine(p, contentEnd)) {
+        if (static_cast<size_t>(std::count(p, contentEnd, ',')) != numberOfCommas) {
+          chunk.hasError = true;
+          break;
+        }
+
+        if (!filterTargets || isSelectedTarget(findLastToken(p, contentEnd), contentEnd)) {
+          chunk.numberOfLines++;
+        }
+      }
+
+      p = nextLine(lineEnd, chunk.end);
+    }
+  }
+
+  size_t numberOfLines = 0;
+
+  for (Chunk& chunk : chunks) {
+    chunk.offset = numberOfLines;
+
+    if (chunk.hasError) {
+      std::string msg = "DatasetParser: Columns missing in line ";
+      msg.append(std::to_string(chunk.offset + chunk.numberOfLines));
+      throw base::file_exception(msg.c_str());
+    }
+
+    numberOfLines += chunk.numberOfLines;
+  }
+
+  return numberOfLines;
+}
+
+size_t DatasetParser::findLines(const char* data, size_t size, size_t& numberInstances) const {
+  const char* end = data + size;
+  const bool filterTargets = hasTargets && !selectedTargets.empty();
+  size_t numberOfLines = 0;
+  const char* p = data;
+
+  while ((p < end) && (numberOfLines < numberInstances)) {
+    const char* lineEnd = findLineEnd(p, end);
+    const char* contentEnd = stripCarriageReturn(p, lineEnd);
+
+    if (isDataLine(p, contentEnd) &&
+        (!filterTargets || isSelectedTarget(findLastToken(p, contentEnd), contentEnd))) {
+      numberOfLines++;
+    }
+
+    p = nextLine(lineEnd, end);
+  }
+
+  numberInstances = numberOfLines;
+  return p - data;
+}
+
+void DatasetParser::parseSize(const char* data, size_t size, size_t& numberInstances,
+                              size_t& dimension) const {
+  std::vector<Chunk> chunks;
+  size_t numberOfCommas;
+  numberInstances = countLines(data, size, chunks, numberOfCommas);
+  dimension = (numberInstances > 0) ? numberOfCommas + (hasTargets ? 0 : 1) : 0;
+}
+
+Dataset DatasetParser::parse(const char* data, size_t size) const {
+  std::vector<Chunk> chunks;
+  size_t numberOfCommas;
+  const size_t numberOfLines = countLines(data, size, chunks, numberOfCommas);
+  const size_t numberOfColumns =
+      (numberOfLines > 0) ? numberOfCommas + (hasTargets ? 0 : 1) : 0;
+
+  // make sure selectedCols has admissible values if it is not empty
+  if (!selectedCols.empty() &&
+      (*std::max_element(selectedCols.begin(), selectedCols.end()) >= numberOfColumns)) {
+    throw base::file_exception("DatasetParser: invalid column selection");
+  }
+
+  const size_t dimension = selectedCols.empty() ? numberOfColumns : selectedCols.size();
+  const size_t numberInstances = std::min(numberOfLines, instanceCutoff);
+  Dataset dataset(numberInstances, dimension);
+
+  double* samples = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+  const bool filterTargets = hasTargets && !selectedTargets.empty();
+
+#pragma omp parallel
+  {
+    // all values of a line, only needed if columns are selected
+    std::vector<double> values(selectedCols.empty() ? 0 : numberOfCommas + 1);
+
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < chunks.size(); c++) {
+      const Chunk& chunk = chunks[c];
+      size_t row = chunk.offset;
+
+      for (const char* p = chunk.begin; (p < chunk.end) && (row < numberInstances);) {
+        const char* lineEnd = findLineEnd(p, chunk.end);
+        const char* contentEnd = stripCarriageReturn(p, lineEnd);
+        const char* lineBegin = p;
+        p = nextLine(lineEnd, chunk.end);
+
+        if (!isDataLine(lineBegin, contentEnd)) {
+          continue;
+        }
+
+        const char* lastToken = findLastToken(lineBegin, contentEnd);
+
+        if (filterTargets && !isSelectedTarget(lastToken, contentEnd)) {
+          continue;
+        }
+
+        double* sample = samples + row * dimension;
+        const char* token = lineBegin;
+
+        for (size_t k = 0; k < numberOfColumns; k++) {
+          const char* tokenEnd = (k < numberOfCommas) ? findNextComma(token, contentEnd)
+                                                      : contentEnd;
+          const double value = parseDouble(token, tokenEnd);
+
+          if (selectedCols.empty()) {
+            sample[k] = value;
+          } else {
+            values[k] = value;
+          }
+
+          token = tokenEnd + 1;
+        }
+
+        for (size_t i = 0; i < selectedCols.size(); i++) {
+          sample[i] = values[selectedCols[i]];
+        }
+
+        if (hasTargets) {
+          targets[row] = parseDouble(lastToken, contentEnd);
+        }
+
+        row++;
+      }
+    }
+  }
+
+  return dataset;
+}
+
+Dataset DatasetParser::parseStream(std::istream& stream) const {
+  const std::vector<char> buffer((std::istreambuf_iterator<char>(stream)),
+                                 std::istreambuf_iterator<char>());
+  return parse(buffer.data(), buffer.size());
+}
+
+Dataset DatasetParser::parseFile(const std::string& filename) const {
+  FileContent content(filename);
+  return parse(content.data, content.size);
+}
+
+void DatasetParser::parseSizeStream(std::istream& stream, size_t& numberInstances,
+                                    size_t& dimension) const {
+  const std::vector<char> buffer((std::istreambuf_iterator<char>(stream)),
+                                 std::istreambuf_iterator<char>());
+  parseSize(buffer.data(), buffer.size(), numberInstances, dimension);
+}
+
+void DatasetParser::parseSizeFile(const std::string& filename, size_t& numberInstances,
+                                  size_t& dimension) const {
+  FileContent content(filename);
+  parseSize(content.data, content.size, numberInstances, dimension);
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,179 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATASETPARSER_HPP
+#define DATASETPARSER_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Parallel parser for comma-separated numerical data, i.e., CSV files and the data section of
+ * ARFF files. It is used by CSVTools and ARFFTools (and therefore by the file sample providers).
+ *
+ * Files are memory-mapped. The text is split into chunks at line boundaries, which are processed
+ * by different OpenMP threads in two passes: The first pass counts the admissible lines of
+ * every chunk, whose prefix sums give the rows of the first line of every chunk in the
+ * resulting Dataset. The second pass parses the values directly into the rows of the Dataset.
+ * Numbers are converted without creating intermediate strings.
+ *
+ * The semantics of the parameters are the same as for CSVTools::readCSV and
+ * ARFFTools::readARFF.
+ */
+class DatasetParser {
+ public:
+  /**
+   * Format of the input.
+   * For CSV, empty lines are skipped. For ARFF, empty lines and lines containing
+   * "%" or "@" (comments and header) are skipped.
+   */
+  enum class Format { CSV, ARFF };
+
+  /**
+   * Constructor.
+   *
+   * @param format          format of the input
+   * @param skipFirstLine   whether to skip the first non-empty line (CSV header)
+   * @param hasTargets      whether the last column contains the targets
+   * @param instanceCutoff  maximal number of instances to read
+   * @param selectedCols    columns which are written to the dataset (empty for all columns)
+   * @param selectedTargets admissible targets (empty for all targets)
+   */
+  explicit DatasetParser(Format format, bool skipFirstLine = false, bool hasTargets = true,
+                         size_t instanceCutoff = -1,
+                         std::vector<size_t> selectedCols = std::vector<size_t>(),
+                         std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Parses a character buffer.
+   *
+   * @param data  pointer to the first character
+   * @param size  number of characters
+   * @return parsed dataset
+   */
+  Dataset parse(const char* data, size_t size) const;
+
+  /**
+   * Parses the remaining content of a stream.
+   *
+   * @param stream input stream, will be at eof afterwards
+   * @return parsed dataset
+   */
+  Dataset parseStream(std::istream& stream) const;
+
+  /**
+   * Parses a file (which is memory-mapped if supported by the platform).
+   *
+   * @param filename name of the file
+   * @return parsed dataset
+   */
+  Dataset parseFile(const std::string& filename) const;
+
+  /**
+   * Determines the size of the dataset in a character buffer without parsing all values.
+   * The instance cutoff and the column selection are ignored.
+   *
+   * @param data                  pointer to the first character
+   * @param size                  number of characters
+   * @param[out] numberInstances  number of (admissible) instances
+   * @param[out] dimension        number of columns (without the target column)
+   */
+  void parseSize(const char* data, size_t size, size_t& numberInstances,
+                 size_t& dimension) const;
+
+  /**
+   * Determines the size of the dataset in the remaining content of a stream.
+   *
+   * @param stream                input stream, will be at eof afterwards
+   * @param[out] numberInstances  number of (admissible) instances
+   * @param[out] dimension        number of columns (without the target column)
+   */
+  void parseSizeStream(std::istream& stream, size_t& numberInstances, size_t& dimension) const;
+
+  /**
+   * Determines the size of the dataset in a file.
+   *
+   * @param filename              name of the file
+   * @param[out] numberInstances  number of (admissible) instances
+   * @param[out] dimension        number of columns (without the target column)
+   */
+  void parseSizeFile(const std::string& filename, size_t& numberInstances,
+                     size_t& dimension) const;
+
+  /**
+   * Determines the length of the shortest prefix of a character buffer that contains a given
+   * number of admissible lines, e.g., to split a stream into batches.
+   * The header is not skipped (skipFirstLine is ignored), but the buffer must contain
+   * complete lines only.
+   *
+   * @param data                      pointer to the first character
+   * @param size                      number of characters
+   * @param[in,out] numberInstances   requested number of instances,
+   *                                  number of instances in the prefix on output
+   * @return number of characters of the prefix
+   */
+  size_t findLines(const char* data, size_t size, size_t& numberInstances) const;
+
+  /**
+   * Converts a token to a double with the same result as atof.
+   * Decimal numbers with at most 15 significant digits and moderate exponents are converted
+   * directly (the result is correctly rounded as both the mantissa and the power of ten are
+   * exactly representable); all other tokens are passed to atof.
+   *
+   * @param begin pointer to the first character of the token
+   * @param end   pointer behind the last character of the token
+   * @return value of the token
+   */
+  static double parseDouble(const char* begin, const char* end);
+
+ private:
+  /// range of lines processed by one thread
+  struct Chunk {
+    const char* begin;
+    const char* end;
+    /// number of admissible lines
+    size_t numberOfLines;
+    /// index of the first line of the chunk in the dataset
+    size_t offset;
+    /// whether the chunk contains a line with a wrong number of columns
+    bool hasError;
+  };
+
+  Format format;
+  bool skipFirstLine;
+  bool hasTargets;
+  size_t instanceCutoff;
+  std::vector<size_t> selectedCols;
+  std::vector<double> selectedTargets;
+
+  /**
+   * Skips the header, determines the number of columns of the first data line, splits the
+   * data into chunks, and counts the admissible lines of every chunk in parallel.
+   *
+   * @param data                pointer to the first character
+   * @param size                number of characters
+   * @param[out] chunks         chunks with line counts and offsets
+   * @param[out] numberOfCommas number of commas in every data line
+   * @return total number of admissible lines
+   */
+  size_t countLines(const char* data, size_t size, std::vector<Chunk>& chunks,
+                    size_t& numberOfCommas) const;
+
+  bool isDataLine(const char* begin, const char* end) const;
+  bool isSelectedTarget(const char* begin, const char* end) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* DATASETPARSER_HPP */
@@ -30,7 +30,7 @@ class DBMatOfflineTest : public sgpp::datadriven::DBMatOfflinePermutable {
 
   bool isRefineable() override { return false; }
 
-  sgpp::datadriven::MatrixDecompositionType getDecompositionType() override {
+  sgpp::datadriven::MatrixDecompositionType getDecompositionType() const override {
     return sgpp::datadriven::MatrixDecompositionType::Chol;
   }
 
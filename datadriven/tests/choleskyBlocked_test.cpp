@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::DBMatOfflineChol;
+
+namespace {
+
+// checks that the lower triangular matrix l satisfies l l^T = a
+void checkFactor(const DataMatrix& a, const DataMatrix& l) {
+  const size_t n = a.getNrows();
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      if (j > i) {
+        BOOST_CHECK_EQUAL(l.get(i, j), 0.0);
+      }
+
+      double sum = 0.0;
+
+      for (size_t p = 0; p <= std::min(i, j); p++) {
+        sum += l.get(i, p) * l.get(j, p);
+      }
+
+      BOOST_CHECK_SMALL(sum - a.get(i, j), 1e-10);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(CholeskyBlocked_test)
+
+BOOST_AUTO_TEST_CASE(decomp_random_spd) {
+  const size_t n = 101;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  // A = B B^T + n I
+  DataMatrix b(n, n);
+  for (size_t i = 0; i < b.getSize(); i++) {
+    b[i] = distribution(generator);
+  }
+
+  DataMatrix a(n, n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double sum = (i == j) ? static_cast<double>(n) : 0.0;
+      for (size_t p = 0; p < n; p++) {
+        sum += b.get(i, p) * b.get(j, p);
+      }
+      a.set(i, j, sum);
+    }
+  }
+
+  // block sizes that do and do not divide n and an unblocked decomposition
+  for (size_t blockSize : {1, 16, 64, 101, 200}) {
+    DataMatrix l = a;
+    DBMatOfflineChol::choleskyBlocked(l, blockSize);
+    checkFactor(a, l);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(decomp_not_positive_definite) {
+  DataMatrix a(3, 3, 0.0);
+  a.set(0, 0, 1.0);
+  a.set(1, 1, -1.0);
+  a.set(2, 2, 1.0);
+  BOOST_CHECK_THROW(DBMatOfflineChol::choleskyBlocked(a, 2), sgpp::base::algorithm_exception);
+}
+
+BOOST_AUTO_TEST_CASE(decomp_offline_matrix) {
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 1e-4;
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+
+  for (bool modified : {false, true}) {
+    std::unique_ptr<sgpp::base::Grid> grid(modified ? sgpp::base::Grid::createModLinearGrid(3)
+                                                    : sgpp::base::Grid::createLinearGrid(3));
+    grid->getGenerator().regular(4);
+
+    DBMatOfflineChol offline;
+    offline.buildMatrix(grid.get(), regularizationConfig);
+    DataMatrix a = offline.getLhsMatrix_ONLY_FOR_TESTING();
+    BOOST_CHECK_EQUAL(a.getNrows(), grid->getSize());
+
+    for (size_t i = 0; i < a.getNrows(); i++) {
+      for (size_t j = 0; j < i; j++) {
+        BOOST_CHECK_EQUAL(a.get(i, j), a.get(j, i));
+      }
+    }
+
+    offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+    checkFactor(a, offline.getDecomposedMatrix());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,7 @@
 
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
 
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BOConfig.hpp>
@@ -16,7 +17,9 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/builder/LeastSquaresRegressionMinerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 
+#include <stdexcept>
 
 #include <string>
 #include <vector>
@@ -131,6 +134,76 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+BOOST_AUTO_TEST_CASE(parallelTrialsTest) {
+  // the results have to be independent of the number of concurrent trials
+  // (up to rounding errors)
+  std::string path("datadriven/tests/pipeline/config_hpo.json");
+  std::string pathParallel("datadriven/tests/pipeline/config_hpoParallel.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::DataMiningConfigParser parserParallel(pathParallel);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+
+  sgpp::datadriven::BoHyperparameterOptimizer
+      bohpo(minfac.buildMiner(path), new FitterFactoryTester(), parser);
+  sgpp::datadriven::BoHyperparameterOptimizer
+      bohpoParallel(minfac.buildMiner(pathParallel), new FitterFactoryTester(), parserParallel);
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer
+      harmhpo(minfac.buildMiner(path), new FitterFactoryTester(), parser);
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer
+      harmhpoParallel(minfac.buildMiner(pathParallel), new FitterFactoryTester(),
+                      parserParallel);
+
+  BOOST_CHECK_EQUAL(bohpo.getNumberOfWorkers(), 1);
+  BOOST_CHECK_EQUAL(bohpoParallel.getNumberOfWorkers(), 3);
+
+  for (size_t worker = 1; worker < 3; worker++) {
+    bohpoParallel.addWorkerMiner(minfac.buildMiner(pathParallel));
+    harmhpoParallel.addWorkerMiner(minfac.buildMiner(pathParallel));
+  }
+
+  // the acquisition function is optimized with random starting points
+  sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+  const double resBo = bohpo.run(false);
+  sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+  const double resBoParallel = bohpoParallel.run(false);
+  // the inner parallel regions use fewer threads, which changes the order of reductions
+  BOOST_CHECK_CLOSE(resBo, resBoParallel, 1e-4);
+  BOOST_CHECK_CLOSE(harmhpo.run(false), harmhpoParallel.run(false), 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(trialSchedulerTest) {
+  const size_t numTrials = 10;
+  sgpp::datadriven::TrialScheduler scheduler(3, 6);
+  BOOST_CHECK_EQUAL(scheduler.getNumberOfWorkers(), 3);
+  BOOST_CHECK_EQUAL(scheduler.getThreadsPerWorker(), 2);
+
+  // every trial is run exactly once by the worker determined by its index
+  std::vector<size_t> workers(numTrials, numTrials);
+  scheduler.run(numTrials, [&workers](size_t worker, size_t trial) { workers[trial] = worker; });
+
+  for (size_t trial = 0; trial < numTrials; trial++) {
+    BOOST_CHECK_EQUAL(workers[trial], (numTrials - 1 - trial) % 3);
+  }
+
+  // the exception of the first failing trial is rethrown after all trials have been run
+  // (std::vector<char> instead of std::vector<bool>, as the workers write concurrently)
+  std::vector<char> done(numTrials, 0);
+  BOOST_CHECK_THROW(scheduler.run(numTrials,
+                                  [&done](size_t, size_t trial) {
+                                    done[trial] = 1;
+                                    if (trial == 4) {
+                                      throw std::logic_error("trial 4");
+                                    } else if (trial == 7) {
+                                      throw std::runtime_error("trial 7");
+                                    }
+                                  }),
+                    std::logic_error);
+
+  for (size_t trial = 0; trial < numTrials; trial++) {
+    BOOST_CHECK_EQUAL(done[trial], 1);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing
   // to a vector of all possible bit configurations
@@ -347,6 +420,88 @@ BOOST_AUTO_TEST_CASE(addSamplesGP) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(incrementalGP) {
+  // the incrementally extended decomposition has to match the decomposition from scratch and
+  // the acquisition function has to be independent of the batch size
+  std::vector<BOConfig> initialConfigs{};
+  std::mt19937 generator(321);
+
+  std::vector<int> discOptions = {2, 3};
+  std::vector<int> catOptions = {2, 3};
+  size_t nCont = 2;
+  BOConfig prototype{&discOptions, &catOptions, nCont};
+  DataVector scales(prototype.getNPar() + 1, 1);
+  const size_t n = 20;
+
+  for (size_t i = 0; i < n; i++) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    initialConfigs[i].setScore(static_cast<double>((7 * i) % 11));
+  }
+
+  sgpp::datadriven::BayesianOptimization bo(initialConfigs);
+  double noise = pow(10, -scales.back() * 10);
+  DataMatrix kernelmatrix(n, n);
+
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t k = 0; k < i; ++k) {
+      double tmp = bo.kernel(initialConfigs[i].getScaledDistance(initialConfigs[k], scales));
+      kernelmatrix.set(k, i, tmp);
+      kernelmatrix.set(i, k, tmp);
+    }
+    kernelmatrix.set(i, i, 1 + noise);
+  }
+
+  DataMatrix gfull;
+  bo.decomposeCholesky(kernelmatrix, gfull);
+
+  DataMatrix kernelsub(kernelmatrix);
+  kernelsub.resizeQuadratic(n - 1);
+  DataMatrix gincremental;
+  bo.decomposeCholesky(kernelsub, gincremental);
+  DataVector knew(n);
+  kernelmatrix.getRow(n - 1, knew);
+  knew.resize(n - 1);
+  bo.extendCholesky(gincremental, knew, 1 + noise);
+
+  BOOST_CHECK_EQUAL(gincremental.getNrows(), n);
+  BOOST_CHECK_EQUAL(gincremental.getNcols(), n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t k = 0; k <= i; k++) {
+      BOOST_CHECK_CLOSE(gincremental.get(i, k), gfull.get(i, k), 1e-10);
+    }
+  }
+
+  BOConfig nextconfig(prototype);
+  nextconfig.randomize(generator);
+
+  for (auto &config : initialConfigs) {
+    config.calcDiscDistance(nextconfig, scales);
+  }
+
+  sgpp::datadriven::BayesianOptimization boDisc(initialConfigs);
+  const size_t nPoints = 50;
+  DataMatrix points(nPoints, nCont);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t j = 0; j < nPoints; j++) {
+    for (size_t t = 0; t < nCont; t++) {
+      points.set(j, t, distribution(generator));
+    }
+  }
+
+  DataVector values;
+  boDisc.acquisitionOuter(points, values);
+  BOOST_CHECK_EQUAL(values.size(), nPoints);
+  DataVector point(nCont);
+
+  for (size_t j = 0; j < nPoints; j++) {
+    points.getRow(j, point);
+    BOOST_CHECK_EQUAL(values[j], boDisc.acquisitionOuter(point));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(fitScalesGP) {
   // test gaussian process fitting by fitting to a second GP
   std::vector<BOConfig> initialConfigs{};
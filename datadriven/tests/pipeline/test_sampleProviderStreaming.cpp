@@ -0,0 +1,212 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::DataSourceFileType;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::StreamingFileSampleProvider;
+
+BOOST_AUTO_TEST_SUITE(datamingStreamingSampleProviderTest)
+
+const size_t datasetSize = 1000;
+const size_t datasetDim = 3;
+
+Dataset createDataset() {
+  Dataset dataset(datasetSize, datasetDim);
+
+  for (size_t i = 0; i < datasetSize; i++) {
+    for (size_t j = 0; j < datasetDim; j++) {
+      dataset.getData().set(i, j, static_cast<double>(i) + 0.25 * static_cast<double>(j));
+    }
+
+    dataset.getTargets()[i] = static_cast<double>(i % 3);
+  }
+
+  return dataset;
+}
+
+std::string toCSV(const Dataset& dataset) {
+  std::ostringstream stream;
+  stream.precision(17);
+  stream << "x0,x1,x2,class\n";
+
+  for (size_t i = 0; i < dataset.getNumberInstances(); i++) {
+    for (size_t j = 0; j < dataset.getDimension(); j++) {
+      stream << dataset.getData().get(i, j) << ",";
+    }
+
+    stream << dataset.getTargets()[i] << "\n";
+  }
+
+  return stream.str();
+}
+
+/**
+ * Reads the samples in batches of different sizes and compares them with the expected dataset.
+ */
+void checkBatches(StreamingFileSampleProvider& sampleProvider, const Dataset& expected) {
+  size_t row = 0;
+  size_t batchSize = 1;
+
+  while (true) {
+    std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(batchSize));
+    BOOST_CHECK_EQUAL(batch->getDimension(), expected.getDimension());
+
+    if (batch->getNumberInstances() == 0) {
+      break;
+    }
+
+    for (size_t i = 0; i < batch->getNumberInstances(); i++, row++) {
+      BOOST_REQUIRE_LT(row, expected.getNumberInstances());
+
+      for (size_t j = 0; j < expected.getDimension(); j++) {
+        BOOST_CHECK_EQUAL(batch->getData().get(i, j), expected.getData().get(row, j));
+      }
+
+      BOOST_CHECK_EQUAL(batch->getTargets()[i], expected.getTargets()[row]);
+    }
+
+    batchSize = 2 * batchSize + 1;
+  }
+
+  BOOST_CHECK_EQUAL(row, expected.getNumberInstances());
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestCSV) {
+  const Dataset dataset = createDataset();
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::CSV);
+  sampleProvider.readString(toCSV(dataset), true);
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), datasetDim);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), datasetSize);
+
+  checkBatches(sampleProvider, dataset);
+
+  // the second pass has to give the same samples
+  sampleProvider.reset();
+  checkBatches(sampleProvider, dataset);
+
+  // resetting in the middle of a pass
+  delete sampleProvider.getNextSamples(10);
+  sampleProvider.reset();
+  std::unique_ptr<Dataset> allSamples(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(allSamples->getNumberInstances(), datasetSize);
+  BOOST_CHECK_EQUAL(allSamples->getData().get(0, 0), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestArff) {
+  const std::string datasetPath =
+      "datadriven/datasets/liver/liver-disorders_normalized_small.arff";
+  ArffFileSampleProvider reference;
+  reference.readFile(datasetPath, true);
+  std::unique_ptr<Dataset> expected(reference.getAllSamples());
+
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF);
+  sampleProvider.readFile(datasetPath, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), expected->getNumberInstances());
+  checkBatches(sampleProvider, *expected);
+
+#ifdef ZLIB
+  // the decorator lets the streaming provider decompress the file lazily
+  sgpp::datadriven::GzipFileSampleDecorator decorator(
+      new StreamingFileSampleProvider(DataSourceFileType::ARFF));
+  decorator.readFile(datasetPath + ".gz", true);
+  std::unique_ptr<Dataset> first(decorator.getNextSamples(4));
+  decorator.reset();
+  std::unique_ptr<Dataset> all(decorator.getAllSamples());
+  BOOST_CHECK_EQUAL(first->getNumberInstances(), 4);
+  BOOST_CHECK_EQUAL(all->getNumberInstances(), expected->getNumberInstances());
+
+  for (size_t i = 0; i < all->getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(all->getTargets()[i], expected->getTargets()[i]);
+  }
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestBinary) {
+  const Dataset dataset = createDataset();
+  const std::string fileName = "test_sampleProviderStreaming.tmp";
+  StreamingFileSampleProvider::writeBinaryFile(fileName, dataset, true, 64);
+
+  {
+    StreamingFileSampleProvider sampleProvider(DataSourceFileType::BINARY);
+    sampleProvider.readFile(fileName, true);
+    BOOST_CHECK_EQUAL(sampleProvider.getDim(), datasetDim);
+    BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), datasetSize);
+    checkBatches(sampleProvider, dataset);
+
+    // copies start at the beginning of the file
+    std::unique_ptr<sgpp::datadriven::SampleProvider> copy(sampleProvider.clone());
+    std::unique_ptr<Dataset> allSamples(copy->getAllSamples());
+    BOOST_CHECK_EQUAL(allSamples->getNumberInstances(), datasetSize);
+  }
+
+  // column selection, class selection, and readin cutoff
+  {
+    const std::vector<size_t> readinColumns{2, 0};
+    const std::vector<double> readinClasses{1.0};
+    const size_t readinCutoff = 100;
+    Dataset expected(readinCutoff, readinColumns.size());
+
+    for (size_t i = 0; i < readinCutoff; i++) {
+      const size_t row = 3 * i + 1;
+
+      for (size_t j = 0; j < readinColumns.size(); j++) {
+        expected.getData().set(i, j, dataset.getData().get(row, readinColumns[j]));
+      }
+
+      expected.getTargets()[i] = 1.0;
+    }
+
+    StreamingFileSampleProvider binaryProvider(DataSourceFileType::BINARY);
+    binaryProvider.readFile(fileName, true, readinCutoff, readinColumns, readinClasses);
+    BOOST_CHECK_EQUAL(binaryProvider.getNumSamples(), readinCutoff);
+    checkBatches(binaryProvider, expected);
+
+    StreamingFileSampleProvider csvProvider(DataSourceFileType::CSV);
+    csvProvider.readString(toCSV(dataset), true, readinCutoff, readinColumns, readinClasses);
+    BOOST_CHECK_EQUAL(csvProvider.getNumSamples(), readinCutoff);
+    checkBatches(csvProvider, expected);
+  }
+
+  // binary files are always streamed by the data source builder
+  {
+    sgpp::datadriven::DataSourceConfig config;
+    config.filePath = fileName;
+    config.fileType = DataSourceFileType::BINARY;
+    config.batchSize = 300;
+    config.numBatches = 4;
+    sgpp::datadriven::DataSourceBuilder builder;
+    std::unique_ptr<sgpp::datadriven::DataSourceSplitting> dataSource(
+        builder.splittingFromConfig(config));
+    std::unique_ptr<Dataset> batch(dataSource->getNextSamples());
+    BOOST_CHECK_EQUAL(batch->getNumberInstances(), 300);
+    BOOST_CHECK_EQUAL(batch->getData().get(299, 1), 299.25);
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMappedFile.hpp>
+#include <sgpp/datadriven/algorithm/DBMatObjectStore.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::DBMatMappedFile;
+using sgpp::datadriven::DBMatOffline;
+using sgpp::datadriven::DBMatOfflineChol;
+
+namespace {
+
+struct MappedFileFixture {
+  MappedFileFixture() {
+    gridConfig.dim_ = 2;
+    gridConfig.level_ = 3;
+    gridConfig.type_ = sgpp::base::GridType::Linear;
+    regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+    regularizationConfig.lambda_ = 1e-3;
+    densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+    grid.reset(sgpp::base::Grid::createLinearGrid(2));
+    grid->getGenerator().regular(3);
+    offline.interactions = {{0}, {1}, {0, 1}};
+    offline.buildMatrix(grid.get(), regularizationConfig);
+    offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  }
+
+  ~MappedFileFixture() {
+    std::remove(fileName.c_str());
+    std::remove(databaseName.c_str());
+  }
+
+  sgpp::base::GeneralGridConfiguration gridConfig;
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  sgpp::datadriven::GeometryConfiguration geometryConfig;
+  std::unique_ptr<sgpp::base::Grid> grid;
+  DBMatOfflineChol offline;
+  std::string fileName = "test_DBMatMappedFile.bin";
+  std::string databaseName = "test_DBMatMappedFile.json";
+};
+
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(testDBMatMappedFile, MappedFileFixture)
+
+BOOST_AUTO_TEST_CASE(storeAndLoad) {
+  const uint64_t hash = sgpp::datadriven::DBMatDatabase::getConfigurationHash(
+      gridConfig, regularizationConfig, densityEstimationConfig);
+  const std::string description = sgpp::datadriven::DBMatDatabase::getConfigurationDescription(
+      gridConfig, regularizationConfig, densityEstimationConfig);
+  offline.storeMapped(fileName, hash, description);
+
+  BOOST_CHECK(DBMatMappedFile::isMappedFile(fileName));
+
+  {
+    DBMatMappedFile file(fileName);
+    BOOST_CHECK(file.getDecompositionType() == sgpp::datadriven::MatrixDecompositionType::Chol);
+    BOOST_CHECK_EQUAL(file.getConfigurationHash(), hash);
+    BOOST_CHECK_EQUAL(file.getConfiguration(), description);
+    BOOST_CHECK(file.hasSection("lhs"));
+    BOOST_CHECK(!file.hasSection("inverse"));
+    BOOST_CHECK(file.verify());
+
+    // the matrix data is accessed in place
+    const DataMatrix& lhs = offline.getDecomposedMatrix();
+    const double* data = file.getSectionData("lhs");
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(data) % 64, 0);
+    for (size_t i = 0; i < lhs.getSize(); i++) {
+      BOOST_CHECK_EQUAL(data[i], lhs[i]);
+    }
+  }
+
+  std::unique_ptr<DBMatOffline> loaded(sgpp::datadriven::DBMatOfflineFactory::buildFromFile(fileName));
+  BOOST_CHECK(loaded->getDecompositionType() == sgpp::datadriven::MatrixDecompositionType::Chol);
+  BOOST_CHECK(loaded->interactions == offline.interactions);
+
+  const DataMatrix& expected = offline.getDecomposedMatrix();
+  const DataMatrix& actual = loaded->getDecomposedMatrix();
+  BOOST_CHECK_EQUAL(actual.getNrows(), expected.getNrows());
+  BOOST_CHECK_EQUAL(actual.getNcols(), expected.getNcols());
+  for (size_t i = 0; i < expected.getSize(); i++) {
+    BOOST_CHECK_EQUAL(actual[i], expected[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(corruptedFile) {
+  offline.storeMapped(fileName);
+
+  // flip a byte of the last matrix entry
+  {
+    std::fstream stream(fileName, std::ios::in | std::ios::out | std::ios::binary);
+    DBMatMappedFile file(fileName);
+    const DBMatMappedFile::SectionHeader& section = file.getSectionHeader("lhs");
+    stream.seekp(static_cast<std::streamoff>(section.offset + 8 * section.rows * section.cols - 1));
+    stream.put(0x7f);
+  }
+
+  DBMatMappedFile file(fileName);
+  BOOST_CHECK(!file.verify());
+  DataMatrix lhs;
+  BOOST_CHECK_THROW(file.copySection("lhs", lhs), sgpp::base::file_exception);
+
+  // truncated files are rejected when they are opened
+  {
+    std::ofstream stream(fileName, std::ios::binary | std::ios::trunc);
+    stream << "SGPPDBMT";
+  }
+  BOOST_CHECK_THROW(DBMatMappedFile truncated(fileName), sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(corruptedHeader) {
+  // the header checksum covers the fields of the header itself
+  const size_t fieldOffsets[] = {offsetof(DBMatMappedFile::Header, decompositionType),
+                                 offsetof(DBMatMappedFile::Header, configurationHash),
+                                 offsetof(DBMatMappedFile::Header, configurationOffset),
+                                 offsetof(DBMatMappedFile::Header, sectionTableOffset),
+                                 offsetof(DBMatMappedFile::Header, fileSize)};
+
+  for (size_t fieldOffset : fieldOffsets) {
+    offline.storeMapped(fileName, 42, "configuration");
+
+    {
+      std::fstream stream(fileName, std::ios::in | std::ios::out | std::ios::binary);
+      stream.seekg(static_cast<std::streamoff>(fieldOffset));
+      const char byte = static_cast<char>(stream.get());
+      stream.seekp(static_cast<std::streamoff>(fieldOffset));
+      stream.put(static_cast<char>(byte ^ 0x01));
+    }
+
+    BOOST_CHECK_THROW(DBMatMappedFile file(fileName), sgpp::base::file_exception);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(databaseLookup) {
+  {
+    std::ofstream stream(databaseName);
+    stream << "{\"database\": []}";
+  }
+
+  offline.storeMapped(fileName);
+
+  {
+    sgpp::datadriven::DBMatDatabase database(databaseName);
+    BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                        densityEstimationConfig));
+    database.putDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                           densityEstimationConfig, fileName);
+    BOOST_CHECK(database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                       densityEstimationConfig));
+  }
+
+  // the entry is found by its hash after reloading the database
+  sgpp::datadriven::DBMatDatabase database(databaseName);
+  BOOST_CHECK_EQUAL(database.getDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                           densityEstimationConfig),
+                    fileName);
+  sgpp::datadriven::RegularizationConfiguration otherRegularizationConfig = regularizationConfig;
+  otherRegularizationConfig.lambda_ = 1e-2;
+  BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, otherRegularizationConfig,
+                                      densityEstimationConfig));
+
+  // the object store loads the object lazily from the database
+  sgpp::datadriven::DBMatObjectStore store(databaseName);
+  std::shared_ptr<const DBMatOffline> object = store.getObject(
+      gridConfig, geometryConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig);
+  BOOST_REQUIRE(object != nullptr);
+  BOOST_CHECK(store.getObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+                              densityEstimationConfig) == object);
+  BOOST_CHECK(store.getObject(gridConfig, geometryConfig, adaptivityConfig,
+                              otherRegularizationConfig, densityEstimationConfig) == object);
+
+  sgpp::base::GeneralGridConfiguration otherGridConfig = gridConfig;
+  otherGridConfig.level_ = 4;
+  BOOST_CHECK(store.getObject(otherGridConfig, geometryConfig, adaptivityConfig,
+                              regularizationConfig, densityEstimationConfig) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
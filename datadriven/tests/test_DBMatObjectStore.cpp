@@ -0,0 +1,247 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatObjectStore.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::DBMatObjectStore;
+using sgpp::datadriven::DBMatOffline;
+using sgpp::datadriven::DBMatOfflineChol;
+
+namespace {
+
+struct ObjectStoreFixture {
+  ObjectStoreFixture() {
+    regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+    regularizationConfig.lambda_ = 1e-3;
+    densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+  }
+
+  sgpp::base::GeneralGridConfiguration getGridConfig(size_t level) {
+    sgpp::base::GeneralGridConfiguration gridConfig;
+    gridConfig.dim_ = 2;
+    gridConfig.level_ = static_cast<int>(level);
+    gridConfig.type_ = sgpp::base::GridType::Linear;
+    return gridConfig;
+  }
+
+  DBMatOffline* createObject(size_t level) {
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+    grid->getGenerator().regular(level);
+    DBMatOfflineChol* offline = new DBMatOfflineChol();
+    offline->buildMatrix(grid.get(), regularizationConfig);
+    offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+    return offline;
+  }
+
+  size_t getMemorySize(size_t level) {
+    std::unique_ptr<DBMatOffline> offline(createObject(level));
+    return offline->getMemorySize();
+  }
+
+  std::shared_ptr<const DBMatOffline> get(DBMatObjectStore& store, size_t level) {
+    return store.getObject(getGridConfig(level), geometryConfig, adaptivityConfig,
+                           regularizationConfig, densityEstimationConfig);
+  }
+
+  void put(DBMatObjectStore& store, size_t level) {
+    store.putObject(getGridConfig(level), geometryConfig, adaptivityConfig, regularizationConfig,
+                    densityEstimationConfig, createObject(level));
+  }
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  sgpp::datadriven::GeometryConfiguration geometryConfig;
+};
+
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(testDBMatObjectStore, ObjectStoreFixture)
+
+BOOST_AUTO_TEST_CASE(leastRecentlyUsedEviction) {
+  DBMatObjectStore store;
+  put(store, 2);
+  put(store, 3);
+  put(store, 4);
+
+  // level 2 becomes the most recently used object, level 3 the least recently used one
+  std::shared_ptr<const DBMatOffline> level3 = get(store, 3);
+  BOOST_REQUIRE(level3 != nullptr);
+  BOOST_REQUIRE(get(store, 4) != nullptr);
+  BOOST_REQUIRE(get(store, 2) != nullptr);
+  BOOST_CHECK(get(store, 5) == nullptr);
+
+  DBMatObjectStore::Statistics statistics = store.getStatistics();
+  BOOST_CHECK_EQUAL(statistics.hits, 3);
+  BOOST_CHECK_EQUAL(statistics.misses, 1);
+  BOOST_CHECK_EQUAL(statistics.numberOfObjects, 3);
+
+  // only the two most recently used objects fit
+  const size_t sizeLevel2 = getMemorySize(2);
+  const size_t sizeLevel4 = getMemorySize(4);
+  store.setMemoryLimit(sizeLevel2 + sizeLevel4);
+
+  statistics = store.getStatistics();
+  BOOST_CHECK_EQUAL(statistics.evictions, 1);
+  BOOST_CHECK_EQUAL(statistics.numberOfObjects, 2);
+  BOOST_CHECK_EQUAL(statistics.memorySize, sizeLevel2 + sizeLevel4);
+  BOOST_CHECK(get(store, 3) == nullptr);
+  BOOST_CHECK(get(store, 2) != nullptr);
+  BOOST_CHECK(get(store, 4) != nullptr);
+
+  // evicted objects stay valid for their users
+  BOOST_CHECK_EQUAL(level3->getMemorySize(), getMemorySize(3));
+
+  // the most recently stored object is kept even if it exceeds the limit
+  store.setMemoryLimit(1);
+  BOOST_CHECK_EQUAL(store.getStatistics().numberOfObjects, 1);
+  BOOST_CHECK(get(store, 4) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(spillToDisk) {
+  DBMatObjectStore store;
+  store.setSpillDirectory(".");
+  put(store, 3);
+  std::shared_ptr<const DBMatOffline> original = get(store, 3);
+  sgpp::base::DataMatrix expected = const_cast<DBMatOffline&>(*original).getDecomposedMatrix();
+
+  store.setMemoryLimit(1);
+  put(store, 2);
+
+  DBMatObjectStore::Statistics statistics = store.getStatistics();
+  BOOST_CHECK_EQUAL(statistics.spills, 1);
+  BOOST_CHECK_EQUAL(statistics.numberOfObjects, 1);
+  BOOST_CHECK_EQUAL(statistics.numberOfSpilledObjects, 1);
+
+  // the spilled object is reloaded and the other one is spilled in turn
+  std::shared_ptr<const DBMatOffline> reloaded = get(store, 3);
+  BOOST_REQUIRE(reloaded != nullptr);
+  BOOST_CHECK(reloaded != original);
+  statistics = store.getStatistics();
+  BOOST_CHECK_EQUAL(statistics.reloads, 1);
+  BOOST_CHECK_EQUAL(statistics.spills, 2);
+  BOOST_CHECK_EQUAL(statistics.numberOfSpilledObjects, 1);
+
+  const sgpp::base::DataMatrix& actual =
+      const_cast<DBMatOffline&>(*reloaded).getDecomposedMatrix();
+  BOOST_REQUIRE_EQUAL(actual.getSize(), expected.getSize());
+  for (size_t i = 0; i < expected.getSize(); i++) {
+    BOOST_CHECK_EQUAL(actual[i], expected[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(concurrentAccess) {
+  DBMatObjectStore store;
+  const size_t sizeLevel2 = getMemorySize(2);
+  store.setMemoryLimit(3 * sizeLevel2);
+  std::vector<DBMatOffline*> objects;
+  for (size_t i = 0; i < 4; i++) {
+    objects.push_back(createObject(2));
+  }
+
+  size_t found = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : found)
+  for (size_t i = 0; i < 400; i++) {
+    sgpp::base::GeneralGridConfiguration gridConfig = getGridConfig(2);
+    gridConfig.levelVector_ = {i % 4};
+    if (i < 4) {
+      store.putObject(gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+                      densityEstimationConfig, objects[i]);
+    } else {
+      std::shared_ptr<const DBMatOffline> object = store.getObject(
+          gridConfig, geometryConfig, adaptivityConfig, regularizationConfig,
+          densityEstimationConfig);
+      if ((object != nullptr) && (object->getMemorySize() == sizeLevel2)) {
+        found++;
+      }
+    }
+  }
+
+  DBMatObjectStore::Statistics statistics = store.getStatistics();
+  BOOST_CHECK_EQUAL(statistics.hits, found);
+  BOOST_CHECK_EQUAL(statistics.hits + statistics.misses, 396);
+  BOOST_CHECK_EQUAL(statistics.evictions, 1);
+  BOOST_CHECK_EQUAL(statistics.numberOfObjects, 3);
+  BOOST_CHECK_LE(statistics.memorySize, 3 * sizeLevel2);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentSpillAndReload) {
+  // every request reloads a spilled object and spills another one
+  DBMatObjectStore store;
+  store.setSpillDirectory(".");
+  store.setMemoryLimit(1);
+  for (size_t level = 2; level <= 4; level++) {
+    put(store, level);
+  }
+
+  std::vector<size_t> memorySizes{getMemorySize(2), getMemorySize(3), getMemorySize(4)};
+  size_t found = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : found)
+  for (size_t i = 0; i < 60; i++) {
+    std::shared_ptr<const DBMatOffline> object = get(store, 2 + i % 3);
+    if ((object != nullptr) && (object->getMemorySize() == memorySizes[i % 3])) {
+      found++;
+    }
+  }
+
+  DBMatObjectStore::Statistics statistics = store.getStatistics();
+  BOOST_CHECK_EQUAL(found, 60);
+  BOOST_CHECK_EQUAL(statistics.hits, 60);
+  BOOST_CHECK_EQUAL(statistics.misses, 0);
+  BOOST_CHECK_EQUAL(statistics.numberOfObjects + statistics.numberOfSpilledObjects, 3);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentDatabaseLoads) {
+  const std::string fileName = "test_DBMatObjectStore.bin";
+  const std::string databaseName = "test_DBMatObjectStore.json";
+  std::unique_ptr<DBMatOffline> offline(createObject(3));
+  offline->storeMapped(fileName);
+  {
+    std::ofstream stream(databaseName);
+    stream << "{\"database\": []}";
+  }
+  {
+    sgpp::datadriven::DBMatDatabase database(databaseName);
+    database.putDataMatrix(getGridConfig(3), adaptivityConfig, regularizationConfig,
+                           densityEstimationConfig, fileName);
+  }
+
+  // concurrent requests for the same missing object load it only once
+  std::vector<std::shared_ptr<const DBMatOffline>> objects(8);
+  {
+    DBMatObjectStore store(databaseName);
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < objects.size(); i++) {
+      objects[i] = get(store, 3);
+    }
+
+    DBMatObjectStore::Statistics statistics = store.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.databaseLoads, 1);
+    BOOST_CHECK_EQUAL(statistics.hits + statistics.misses, objects.size());
+    BOOST_CHECK_EQUAL(statistics.numberOfObjects, 1);
+  }
+
+  BOOST_REQUIRE(objects[0] != nullptr);
+  for (size_t i = 1; i < objects.size(); i++) {
+    BOOST_CHECK(objects[i] == objects[0]);
+  }
+
+  std::remove(fileName.c_str());
+  std::remove(databaseName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
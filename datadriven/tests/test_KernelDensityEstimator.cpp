@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+
+#include <cmath>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::BandwidthOptimizationType;
+using sgpp::datadriven::KernelDensityEstimator;
+using sgpp::datadriven::KernelEvaluationType;
+using sgpp::datadriven::KernelType;
+
+BOOST_AUTO_TEST_SUITE(testKernelDensityEstimator)
+
+void fillRandomly(DataMatrix& points, std::mt19937_64& generator) {
+  std::normal_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    for (size_t j = 0; j < points.getNcols(); j++) {
+      points.set(i, j, distribution(generator));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testKDTreeEvaluation) {
+  const size_t numDims = 3;
+  std::mt19937_64 generator(1234);
+
+  DataMatrix samples(2000, numDims);
+  fillRandomly(samples, generator);
+  DataMatrix points(200, numDims);
+  fillRandomly(points, generator);
+  DataVector x(numDims);
+
+  for (KernelType kernelType : {KernelType::GAUSSIAN, KernelType::EPANECHNIKOV}) {
+    KernelDensityEstimator kde(samples, kernelType, BandwidthOptimizationType::SILVERMANSRULE);
+
+    // exact evaluation of single points as reference
+    DataVector reference(points.getNrows());
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, x);
+      reference[i] = kde.pdf(x);
+    }
+
+    // parallel exact evaluation
+    DataVector result;
+    kde.pdf(points, result);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      BOOST_CHECK_CLOSE(result[i], reference[i], 1e-10);
+    }
+
+    // kd-tree evaluation, the relative error has to be bounded by the tolerance
+    for (double tolerance : {0.0, 1e-6, 1e-2}) {
+      kde.setEvaluationType(KernelEvaluationType::KDTREE, tolerance);
+      kde.pdf(points, result);
+
+      for (size_t i = 0; i < points.getNrows(); i++) {
+        BOOST_CHECK_LE(std::abs(result[i] - reference[i]),
+                       tolerance * reference[i] + 1e-12 * reference[i] + 1e-300);
+      }
+    }
+
+    // the tree does not depend on the bandwidths, but has to be rebuilt
+    // if the conditionalization factors change
+    DataVector bandwidths;
+    kde.getBandwidths(bandwidths);
+    bandwidths.mult(1.5);
+    DataVector cond(samples.getNrows());
+
+    for (size_t i = 0; i < cond.getSize(); i++) {
+      cond[i] = 1.0 + static_cast<double>(i % 3);
+    }
+
+    kde.setEvaluationType(KernelEvaluationType::KDTREE, 1e-6);
+    kde.setBandwidths(bandwidths);
+    kde.setConditionalizationFactor(cond);
+    kde.pdf(points, result);
+    kde.setEvaluationType(KernelEvaluationType::EXACT);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, x);
+      const double exact = kde.pdf(x);
+      BOOST_CHECK_LE(std::abs(result[i] - exact), 1e-6 * exact + 1e-300);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testKDTreeCrossValidation) {
+  const size_t numDims = 2;
+  std::mt19937_64 generator(42);
+  DataMatrix samples(500, numDims);
+  fillRandomly(samples, generator);
+
+  KernelDensityEstimator kde(samples);
+  DataVector bandwidths;
+  kde.getBandwidths(bandwidths);
+
+  // the cross validation has to give the same result for both evaluation types
+  sgpp::datadriven::KDEMaximumLikelihoodCrossValidation cvExact(kde, 5);
+  kde.setEvaluationType(KernelEvaluationType::KDTREE, 1e-8);
+  sgpp::datadriven::KDEMaximumLikelihoodCrossValidation cvTree(kde, 5);
+
+  for (double factor : {0.5, 1.0, 2.0}) {
+    DataVector x(bandwidths);
+    x.mult(factor);
+    BOOST_CHECK_CLOSE(cvTree.eval(x), cvExact.eval(x), 1e-5);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
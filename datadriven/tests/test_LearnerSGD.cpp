@@ -0,0 +1,133 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/application/LearnerSGD.hpp>
+
+#include <random>
+#include <string>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::LearnerSGD;
+
+namespace {
+
+// two classes separated by the line x_0 + x_1 = 1
+void createDataset(size_t numData, unsigned int seed, DataMatrix& data, DataVector& labels) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  data.resize(numData, 2);
+  labels.resize(numData);
+
+  for (size_t i = 0; i < numData; i++) {
+    data.set(i, 0, distribution(generator));
+    data.set(i, 1, distribution(generator));
+    labels[i] = (data.get(i, 0) + data.get(i, 1) > 1.0) ? 1.0 : -1.0;
+  }
+}
+
+// exposes the surpluses of the learner
+class LearnerSGDTester : public LearnerSGD {
+ public:
+  using LearnerSGD::LearnerSGD;
+
+  const DataVector& getAlpha() const { return alpha; }
+  const DataVector& getAlphaAvg() const { return alphaAvg; }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testLearnerSGD)
+
+BOOST_AUTO_TEST_CASE(testMiniBatch) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::ModLinear;
+
+  sgpp::base::AdaptivityConfiguration adaptConfig;
+  adaptConfig.numRefinements_ = 0;
+  adaptConfig.noPoints_ = 5;
+  adaptConfig.threshold_ = 0.0;
+
+  DataMatrix trainData(0, 2);
+  DataVector trainLabels(0);
+  DataMatrix testData(0, 2);
+  DataVector testLabels(0);
+  createDataset(1000, 1, trainData, trainLabels);
+  createDataset(200, 2, testData, testLabels);
+
+  for (bool asynchronous : {false, true}) {
+    LearnerSGD learner(gridConfig, adaptConfig, trainData, trainLabels, testData, testLabels,
+                       nullptr, nullptr, 1e-4, 0.5, 50, false);
+    learner.initialize();
+    learner.trainMiniBatch(5, 10, asynchronous, "predictive", "periodic", 100, 0.0, 0, 0);
+
+    BOOST_CHECK_GT(learner.getAccuracy(testData, testLabels, 0.0), 0.9);
+    BOOST_CHECK_GT(learner.getSamplesPerSecond(), 0.0);
+  }
+
+  LearnerSGD learner(gridConfig, adaptConfig, trainData, trainLabels, testData, testLabels,
+                     nullptr, nullptr, 1e-4, 0.5, 50, false);
+  learner.initialize();
+  BOOST_CHECK_THROW(
+      learner.trainMiniBatch(1, 0, false, "predictive", "periodic", 100, 0.0, 0, 0),
+      sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testMiniBatchSizeOne) {
+  // synchronous mini-batches of size 1 have to perform the same updates as train()
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::ModLinear;
+
+  sgpp::base::AdaptivityConfiguration adaptConfig;
+  adaptConfig.numRefinements_ = 0;
+  adaptConfig.noPoints_ = 5;
+  adaptConfig.threshold_ = 0.0;
+
+  DataMatrix trainData(0, 2);
+  DataVector trainLabels(0);
+  DataMatrix testData(0, 2);
+  DataVector testLabels(0);
+  createDataset(300, 3, trainData, trainLabels);
+  createDataset(100, 4, testData, testLabels);
+
+  // single data point steps need a smaller learning rate than mini-batches to converge
+  LearnerSGDTester learner(gridConfig, adaptConfig, trainData, trainLabels, testData,
+                           testLabels, nullptr, nullptr, 1e-4, 0.05, 50, false);
+  learner.initialize();
+  learner.train(2, "predictive", "periodic", 100, 0.0, 0, 0);
+
+  LearnerSGDTester miniBatchLearner(gridConfig, adaptConfig, trainData, trainLabels, testData,
+                                    testLabels, nullptr, nullptr, 1e-4, 0.05, 50, false);
+  miniBatchLearner.initialize();
+  miniBatchLearner.trainMiniBatch(2, 1, false, "predictive", "periodic", 100, 0.0, 0, 0);
+
+  const DataVector& alpha = learner.getAlpha();
+  const DataVector& alphaAvg = learner.getAlphaAvg();
+  BOOST_REQUIRE_EQUAL(miniBatchLearner.getAlpha().getSize(), alpha.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    BOOST_CHECK_SMALL(miniBatchLearner.getAlpha()[i] - alpha[i], 1e-10);
+    BOOST_CHECK_SMALL(miniBatchLearner.getAlphaAvg()[i] - alphaAvg[i], 1e-10);
+  }
+
+  BOOST_REQUIRE_EQUAL(miniBatchLearner.avgErrors.getSize(), learner.avgErrors.getSize());
+
+  for (size_t i = 0; i < learner.avgErrors.getSize(); i++) {
+    BOOST_CHECK_EQUAL(miniBatchLearner.avgErrors[i], learner.avgErrors[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
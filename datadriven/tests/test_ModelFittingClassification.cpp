@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationClassification.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClassification.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <algorithm>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::FitterConfigurationClassification;
+using sgpp::datadriven::ModelFittingClassification;
+
+namespace {
+
+Dataset createDataset(size_t numberInstances, size_t dim, size_t numberClasses,
+                      std::mt19937& generator) {
+  std::normal_distribution<double> distribution(0.0, 0.1);
+  std::uniform_int_distribution<size_t> classDistribution(0, numberClasses - 1);
+  Dataset dataset(numberInstances, dim);
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    const size_t label = classDistribution(generator);
+    // the class centers lie on the diagonal of the unit cube
+    const double center = (static_cast<double>(label) + 0.5) / static_cast<double>(numberClasses);
+    for (size_t t = 0; t < dim; t++) {
+      dataset.getData().set(i, t,
+                            std::min(std::max(center + distribution(generator), 0.01), 0.99));
+    }
+    dataset.getTargets()[i] = static_cast<double>(label);
+  }
+
+  return dataset;
+}
+
+void checkBatchAgainstPointwise(ModelFittingClassification& model, DataMatrix& samples) {
+  DataVector results(samples.getNrows());
+  model.evaluate(samples, results);
+
+  DataVector sample(samples.getNcols());
+  for (size_t i = 0; i < samples.getNrows(); i++) {
+    samples.getRow(i, sample);
+    BOOST_CHECK_EQUAL(results[i], model.evaluate(sample));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testModelFittingClassification)
+
+BOOST_AUTO_TEST_CASE(fusedAndChunkedEvaluation) {
+  const size_t dim = 2;
+  const size_t numberClasses = 4;
+  std::mt19937 generator(11);
+  Dataset trainData = createDataset(400, dim, numberClasses, generator);
+  // more samples than fit into one evaluation chunk
+  Dataset testData = createDataset(2100, dim, numberClasses, generator);
+
+  FitterConfigurationClassification config;
+  config.setupDefaults();
+  config.getGridConfig().type_ = sgpp::base::GridType::Linear;
+  config.getGridConfig().dim_ = dim;
+  config.getGridConfig().level_ = 3;
+  config.getRefinementConfig().numRefinements_ = 1;
+  config.getRefinementConfig().noPoints_ = 3;
+  config.getRegularizationConfig().lambda_ = 1e-3;
+  config.getDensityEstimationConfig().type_ = sgpp::datadriven::DensityEstimationType::CG;
+
+  ModelFittingClassification model(config);
+  model.fit(trainData);
+
+  // all classes share the same regular grid and are evaluated at once
+  checkBatchAgainstPointwise(model, testData.getData());
+
+  // after the refinement the grids of the classes differ
+  model.refine();
+  checkBatchAgainstPointwise(model, testData.getData());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
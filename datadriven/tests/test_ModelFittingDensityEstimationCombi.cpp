@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationDensityEstimation.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationCombi.hpp>
+
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::FitterConfigurationDensityEstimation;
+using sgpp::datadriven::ModelFittingDensityEstimationCombi;
+
+BOOST_AUTO_TEST_SUITE(testModelFittingDensityEstimationCombi)
+
+BOOST_AUTO_TEST_CASE(parallelComponents) {
+  const size_t dim = 3;
+  std::mt19937 generator(7);
+  std::normal_distribution<double> distribution(0.5, 0.15);
+
+  DataMatrix trainData(500, dim);
+  for (size_t i = 0; i < trainData.getSize(); i++) {
+    trainData[i] = std::min(std::max(distribution(generator), 0.01), 0.99);
+  }
+  // more samples than fit into one evaluation chunk
+  DataMatrix testData(2500, dim);
+  for (size_t i = 0; i < testData.getSize(); i++) {
+    testData[i] = std::min(std::max(distribution(generator), 0.01), 0.99);
+  }
+
+  FitterConfigurationDensityEstimation config;
+  config.setupDefaults();
+  config.getGridConfig().generalType_ = sgpp::base::GeneralGridType::ComponentGrid;
+  config.getGridConfig().type_ = sgpp::base::GridType::Linear;
+  config.getGridConfig().dim_ = dim;
+  config.getGridConfig().level_ = 4;
+  config.getRefinementConfig().numRefinements_ = 1;
+  config.getRegularizationConfig().lambda_ = 1e-3;
+  config.getDensityEstimationConfig().type_ = sgpp::datadriven::DensityEstimationType::CG;
+
+  ModelFittingDensityEstimationCombi serialModel(config);
+  serialModel.fit(trainData);
+  serialModel.refine();
+  serialModel.update(trainData);
+
+  config.getDensityEstimationConfig().parallelComponents_ = 0;
+  ModelFittingDensityEstimationCombi parallelModel(config);
+  parallelModel.fit(trainData);
+  parallelModel.refine();
+  parallelModel.update(trainData);
+
+  DataVector serialResults(testData.getNrows());
+  DataVector parallelResults(testData.getNrows());
+  serialModel.evaluate(testData, serialResults);
+  parallelModel.evaluate(testData, parallelResults);
+
+  for (size_t i = 0; i < testData.getNrows(); i++) {
+    DataVector sample(dim);
+    testData.getRow(i, sample);
+    const double expected = serialModel.evaluate(sample);
+    BOOST_CHECK_CLOSE(serialResults[i], expected, 1e-8);
+    // the CG solver of the components uses fewer threads if components are fitted concurrently,
+    // which changes the rounding
+    BOOST_CHECK_SMALL(parallelResults[i] - expected, 1e-3);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/algorithm/MultipleEvalCache.hpp>
+
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::MultipleEvalCache;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+
+namespace {
+
+DataMatrix randomPoints(size_t numberOfPoints, size_t dim) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix points(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      points.set(i, t, distribution(generator));
+    }
+  }
+
+  return points;
+}
+
+DataVector randomCoefficients(size_t size) {
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataVector alpha(size);
+
+  for (size_t i = 0; i < size; i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  return alpha;
+}
+
+void checkAgainstOperation(Grid& grid, DataVector& alpha, DataMatrix& points,
+                           const DataVector& results) {
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+      sgpp::op_factory::createOperationMultipleEval(grid, points));
+  DataVector reference(points.getNrows());
+  opEval->eval(alpha, reference);
+
+  BOOST_REQUIRE_EQUAL(results.getSize(), reference.getSize());
+
+  for (size_t i = 0; i < reference.getSize(); i++) {
+    BOOST_CHECK_SMALL(results[i] - reference[i], 1e-12);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testMultipleEvalCache)
+
+BOOST_AUTO_TEST_CASE(chunkedEvaluationMatchesOperation) {
+  const size_t dim = 3;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createModLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(3);
+    DataVector alpha = randomCoefficients(grid->getSize());
+    // the number of points is not a multiple of the batch size
+    DataMatrix points = randomPoints(53, dim);
+    DataVector results;
+
+    MultipleEvalCache cache(OperationMultipleEvalConfiguration(), 10);
+    cache.eval(*grid, alpha, points, results);
+    checkAgainstOperation(*grid, alpha, points, results);
+
+    // a second batch with a different size reuses the operation
+    DataMatrix morePoints = randomPoints(17, dim);
+    cache.eval(*grid, alpha, morePoints, results);
+    checkAgainstOperation(*grid, alpha, morePoints, results);
+    BOOST_CHECK_EQUAL(cache.getNumberOfCreatedOperations(), 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(invalidationAfterRefinement) {
+  const size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(2);
+  DataVector alpha = randomCoefficients(grid->getSize());
+  DataMatrix points = randomPoints(40, dim);
+  DataVector results;
+
+  MultipleEvalCache cache(OperationMultipleEvalConfiguration(), 16);
+  cache.eval(*grid, alpha, points, results);
+  BOOST_CHECK_EQUAL(cache.getNumberOfCreatedOperations(), 1);
+
+  // refining the grid is detected by the changed grid size
+  sgpp::base::SurplusRefinementFunctor functor(alpha, 1);
+  grid->getGenerator().refine(functor);
+  alpha = randomCoefficients(grid->getSize());
+  cache.eval(*grid, alpha, points, results);
+  checkAgainstOperation(*grid, alpha, points, results);
+  BOOST_CHECK_EQUAL(cache.getNumberOfCreatedOperations(), 2);
+
+  cache.invalidate();
+  cache.eval(*grid, alpha, points, results);
+  checkAgainstOperation(*grid, alpha, points, results);
+  BOOST_CHECK_EQUAL(cache.getNumberOfCreatedOperations(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(evaluationWithInteractions) {
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  std::set<std::set<size_t>> interactions = {{}, {0}, {1}, {2}, {0, 1}};
+  grid->getGenerator().regularInter(3, interactions, 0.0);
+  DataVector alpha = randomCoefficients(grid->getSize());
+  DataMatrix points = randomPoints(29, dim);
+  DataVector results;
+
+  MultipleEvalCache cache(OperationMultipleEvalConfiguration(), 8);
+  cache.eval(*grid, alpha, points, results, &interactions);
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+      sgpp::op_factory::createOperationMultipleEvalInter(*grid, points, interactions));
+  DataVector reference(points.getNrows());
+  opEval->eval(alpha, reference);
+
+  for (size_t i = 0; i < reference.getSize(); i++) {
+    BOOST_CHECK_SMALL(results[i] - reference[i], 1e-12);
+  }
+
+  BOOST_CHECK_EQUAL(cache.getNumberOfCreatedOperations(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,8 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include <random>
 #include <iostream>
@@ -51,6 +53,17 @@ double parabola(DataVector& input) {
   return result;
 }
 
+double coupledParabola(DataVector& input) {
+  // positive and not symmetric in the dimensions
+  double coupling = 1.;
+
+  for (size_t i = 0; i + 1 < input.getSize(); i++) {
+    coupling += static_cast<double>(i + 1) * input[i] * input[i + 1];
+  }
+
+  return coupling * parabola(input);
+}
+
 void hierarchize(Grid* grid, std::uint32_t level, DataVector& alpha, double (*func)(DataVector&)) {
   size_t dim = grid->getDimension();
   GridStorage& gs = grid->getStorage();
@@ -216,6 +229,113 @@ void testEqualityRosenblattInverseRosenblattKDE(
   }
 }
 
+/**
+ * Rosenblatt transformation of one sample obtained by marginalizing and conditioning
+ * the sparse grid explicitly.
+ */
+void rosenblattByConditionals(Grid& grid, DataVector& alpha, DataVector& x, size_t dimStart,
+                              DataVector& u) {
+  size_t numDims = grid.getDimension();
+  std::vector<size_t> remaining(numDims);
+  for (size_t idim = 0; idim < numDims; idim++) {
+    remaining[idim] = idim;
+  }
+
+  std::unique_ptr<Grid> currentGrid(grid.clone());
+  std::unique_ptr<DataVector> currentAlpha(new DataVector(alpha));
+
+  for (size_t k = 0; k < numDims; k++) {
+    size_t idim = (dimStart + k) % numDims;
+    unsigned int localDim = static_cast<unsigned int>(
+        std::find(remaining.begin(), remaining.end(), idim) - remaining.begin());
+
+    if (remaining.size() > 1) {
+      Grid* grid1d = nullptr;
+      DataVector* alpha1d = nullptr;
+      std::unique_ptr<sgpp::datadriven::OperationDensityMargTo1D> opMarg(
+          sgpp::op_factory::createOperationDensityMargTo1D(*currentGrid));
+      opMarg->margToDimX(currentAlpha.get(), grid1d, alpha1d, localDim);
+      std::unique_ptr<Grid> grid1dPtr(grid1d);
+      std::unique_ptr<DataVector> alpha1dPtr(alpha1d);
+      std::unique_ptr<sgpp::datadriven::OperationTransformation1D> opRos(
+          sgpp::op_factory::createOperationRosenblattTransformation1D(*grid1d));
+      u[idim] = opRos->doTransformation1D(alpha1d, x[idim]);
+
+      Grid* conditionalGrid = nullptr;
+      std::unique_ptr<DataVector> conditionalAlpha(new DataVector(1));
+      std::unique_ptr<sgpp::datadriven::OperationDensityConditional> opCond(
+          sgpp::op_factory::createOperationDensityConditional(*currentGrid));
+      opCond->doConditional(*currentAlpha, conditionalGrid, *conditionalAlpha, localDim, x[idim]);
+      currentGrid.reset(conditionalGrid);
+      currentAlpha = std::move(conditionalAlpha);
+      remaining.erase(remaining.begin() + localDim);
+    } else {
+      std::unique_ptr<sgpp::datadriven::OperationTransformation1D> opRos(
+          sgpp::op_factory::createOperationRosenblattTransformation1D(*currentGrid));
+      u[idim] = opRos->doTransformation1D(currentAlpha.get(), x[idim]);
+    }
+  }
+}
+
+/**
+ * Rosenblatt transformation of one sample of a piecewise linear density on a regular grid of
+ * level 2 by its definition: the one-dimensional conditional densities are integrated over the
+ * remaining dimensions with the tensor trapezoidal rule on the mesh with width 1/4, which is
+ * exact for piecewise multilinear functions. As in the transformation operations, the CDFs are
+ * interpolated linearly between the grid points.
+ */
+void rosenblattByQuadrature(Grid& grid, DataVector& alpha, DataVector& x, size_t dimStart,
+                            DataVector& u) {
+  const size_t numDims = grid.getDimension();
+  const size_t numCells = 4;
+  const double h = 1.0 / static_cast<double>(numCells);
+  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(grid));
+  DataVector point(numDims);
+
+  for (size_t k = 0; k < numDims; k++) {
+    const size_t idim = (dimStart + k) % numDims;
+    const size_t numRemaining = numDims - k - 1;
+    size_t numMeshPoints = 1;
+
+    for (size_t j = 0; j < numRemaining; j++) {
+      numMeshPoints *= numCells + 1;
+    }
+
+    // values of the unnormalized conditional density at the grid points of dimension idim
+    std::vector<double> density(numCells + 1, 0.0);
+
+    for (size_t i = 0; i <= numCells; i++) {
+      point[idim] = static_cast<double>(i) * h;
+
+      for (size_t m = 0; m < numMeshPoints; m++) {
+        double weight = 1.0;
+        size_t index = m;
+
+        for (size_t j = 0; j < numRemaining; j++) {
+          const size_t jdim = (idim + j + 1) % numDims;
+          const size_t ij = index % (numCells + 1);
+          index /= numCells + 1;
+          point[jdim] = static_cast<double>(ij) * h;
+          weight *= ((ij == 0) || (ij == numCells)) ? h / 2.0 : h;
+        }
+
+        density[i] += weight * opEval->eval(alpha, point);
+      }
+    }
+
+    std::vector<double> cdf(numCells + 1, 0.0);
+
+    for (size_t i = 1; i <= numCells; i++) {
+      cdf[i] = cdf[i - 1] + h / 2.0 * (density[i - 1] + density[i]);
+    }
+
+    const size_t cell = std::min(static_cast<size_t>(x[idim] / h), numCells - 1);
+    const double lambda = x[idim] / h - static_cast<double>(cell);
+    u[idim] = ((1.0 - lambda) * cdf[cell] + lambda * cdf[cell + 1]) / cdf[numCells];
+    point[idim] = x[idim];
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(testRosenblattTransformation)
 
 BOOST_AUTO_TEST_CASE(testRosenblattLinear1D) {
@@ -242,6 +362,119 @@ BOOST_AUTO_TEST_CASE(testRosenblattLinearDD) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testRosenblattLinearConditionals) {
+  DataVector alpha(20);
+  // more samples than fit into one block of the transformation engine
+  size_t numSamples = 150;
+  for (std::uint32_t dim = 2; dim < 5; dim++) {
+    Grid* grid = Grid::createLinearGrid(dim);
+    hierarchize(grid, 4, alpha, &coupledParabola);
+
+    DataMatrix x_vars(numSamples, dim);
+    randu(x_vars, 1234);
+    // samples with common coordinates share the conditional densities
+    for (size_t isample = 1; isample < numSamples; isample += 2) {
+      x_vars.set(isample, 0, x_vars.get(isample - 1, 0));
+    }
+
+    std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRos(
+        sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+    std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+        sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+
+    for (size_t dimStart = 0; dimStart < dim; dimStart++) {
+      DataMatrix u_vars(numSamples, dim);
+      DataMatrix x_vars_transformed(numSamples, dim);
+      opRos->doTransformation(&alpha, &x_vars, &u_vars, dimStart);
+      opInvRos->doTransformation(&alpha, &u_vars, &x_vars_transformed, dimStart);
+
+      DataVector x_sample(dim);
+      DataVector u_reference(dim);
+      for (size_t isample = 0; isample < numSamples; isample++) {
+        x_vars.getRow(isample, x_sample);
+        rosenblattByConditionals(*grid, alpha, x_sample, dimStart, u_reference);
+        for (size_t idim = 0; idim < dim; idim++) {
+          BOOST_CHECK_SMALL(u_vars.get(isample, idim) - u_reference[idim], 1e-10);
+          BOOST_CHECK_SMALL(x_vars_transformed.get(isample, idim) - x_sample[idim], 1e-10);
+        }
+      }
+    }
+    delete grid;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRosenblattLinearQuadrature) {
+  size_t numSamples = 200;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.5, 1.5);
+
+  for (std::uint32_t dim = 3; dim < 5; dim++) {
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(2);
+    // positive coefficients, the density is positive and does not factorize
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator);
+    }
+
+    DataMatrix x_vars(numSamples, dim);
+    randu(x_vars, 4321);
+
+    std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRos(
+        sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+    std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+        sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+
+    for (size_t dimStart = 0; dimStart < dim; dimStart++) {
+      DataMatrix u_vars(numSamples, dim);
+      DataMatrix x_vars_transformed(numSamples, dim);
+      opRos->doTransformation(&alpha, &x_vars, &u_vars, dimStart);
+      opInvRos->doTransformation(&alpha, &u_vars, &x_vars_transformed, dimStart);
+
+      DataVector x_sample(dim);
+      DataVector u_reference(dim);
+      for (size_t isample = 0; isample < numSamples; isample++) {
+        x_vars.getRow(isample, x_sample);
+        rosenblattByQuadrature(*grid, alpha, x_sample, dimStart, u_reference);
+        for (size_t idim = 0; idim < dim; idim++) {
+          BOOST_CHECK_SMALL(u_vars.get(isample, idim) - u_reference[idim], 1e-10);
+          BOOST_CHECK_SMALL(x_vars_transformed.get(isample, idim) - x_sample[idim], 1e-10);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRosenblattLinearZeroDensity) {
+  size_t dim = 3;
+  size_t numSamples = 50;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataVector alpha(grid->getSize(), 0.0);
+
+  DataMatrix x_vars(numSamples, dim);
+  randu(x_vars, 1234);
+
+  std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRos(
+      sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+  std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+      sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+
+  // without mass, the transformations fall back to the uniform distribution
+  DataMatrix u_vars(numSamples, dim);
+  DataMatrix x_vars_transformed(numSamples, dim);
+  opRos->doTransformation(&alpha, &x_vars, &u_vars, 1);
+  opInvRos->doTransformation(&alpha, &u_vars, &x_vars_transformed, 1);
+
+  for (size_t isample = 0; isample < numSamples; isample++) {
+    for (size_t idim = 0; idim < dim; idim++) {
+      BOOST_CHECK_SMALL(u_vars.get(isample, idim) - x_vars.get(isample, idim), 1e-12);
+      BOOST_CHECK_SMALL(x_vars_transformed.get(isample, idim) - x_vars.get(isample, idim), 1e-12);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testRosenblattPoly1D) {
   Grid* grid = Grid::createPolyGrid(1, 3);
   DataVector alpha(20);
@@ -11,7 +11,13 @@
 
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/DatasetParser.hpp>
 
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -20,6 +26,7 @@ using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::datadriven::Dataset;
 using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::DatasetParser;
 
 
 BOOST_AUTO_TEST_SUITE(test_dataread_csv)
@@ -175,4 +182,85 @@ BOOST_AUTO_TEST_CASE(test_read_csv_old) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_parse_double) {
+  // the parser has to give exactly the same results as atof
+  std::vector<std::string> tokens = {
+      "0", "-0", "1", "+1", "0.1", "-7e-01", "7e+00", "42.42", " 3.5 ", "1.\r", ".5", "-.25e2",
+      "123456789012345", "1234567890123456789", "0.30000000000000004", "1e22", "1e23",
+      "1e-300", "5e-324", "1e400", "inf", "nan", "", "?", "1.5abc", "e5", "1e", "00012.5000"};
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e3, 1e3);
+  char buffer[64];
+
+  for (size_t i = 0; i < 1000; i++) {
+    snprintf(buffer, sizeof(buffer), (i % 2 == 0) ? "%.17g" : "%.6f", distribution(generator));
+    tokens.push_back(buffer);
+  }
+
+  for (const std::string& token : tokens) {
+    const double expected = std::atof(token.c_str());
+    const double value = DatasetParser::parseDouble(token.data(), token.data() + token.size());
+
+    if (std::isnan(expected)) {
+      BOOST_CHECK(std::isnan(value));
+    } else {
+      BOOST_CHECK_EQUAL(value, expected);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_read) {
+  // large enough to be split into several chunks
+  const size_t numberInstances = 20000;
+  const size_t dimension = 4;
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataMatrix controlMatrix(numberInstances, dimension);
+  DataVector controlVector(numberInstances);
+  std::ostringstream stream;
+  stream.precision(17);
+  stream << "x0,x1,x2,x3,class\n";
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      controlMatrix.set(i, j, distribution(generator));
+      stream << controlMatrix.get(i, j) << ",";
+    }
+
+    controlVector[i] = static_cast<double>(i % 3);
+    stream << controlVector[i] << ((i % 100 == 0) ? "\r\n\n" : "\n");
+  }
+
+  std::istringstream input(stream.str());
+  Dataset d = CSVTools::readCSV(input, true, true);
+  BOOST_CHECK_EQUAL(d.getNumberInstances(), numberInstances);
+  BOOST_CHECK_EQUAL(d.getDimension(), dimension);
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      BOOST_CHECK_EQUAL(d.getData().get(i, j), controlMatrix.get(i, j));
+    }
+
+    BOOST_CHECK_EQUAL(d.getTargets()[i], controlVector[i]);
+  }
+
+  // selection of columns and targets, instance cutoff
+  const std::string content = stream.str();
+  DatasetParser parser(DatasetParser::Format::CSV, true, true, 5000, {3, 1}, {2.0});
+  d = parser.parse(content.data(), content.size());
+  BOOST_CHECK_EQUAL(d.getNumberInstances(), 5000);
+  BOOST_CHECK_EQUAL(d.getDimension(), 2);
+
+  for (size_t i = 0; i < d.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(d.getData().get(i, 0), controlMatrix.get(3 * i + 2, 3));
+    BOOST_CHECK_EQUAL(d.getData().get(i, 1), controlMatrix.get(3 * i + 2, 1));
+    BOOST_CHECK_EQUAL(d.getTargets()[i], 2.0);
+  }
+
+  size_t numberOfSelectedInstances, numberOfColumns;
+  parser.parseSize(content.data(), content.size(), numberOfSelectedInstances, numberOfColumns);
+  BOOST_CHECK_EQUAL(numberOfSelectedInstances, numberInstances / 3);
+  BOOST_CHECK_EQUAL(numberOfColumns, dimension);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
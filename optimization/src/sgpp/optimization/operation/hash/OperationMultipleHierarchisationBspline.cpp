@@ -7,7 +7,7 @@
 
 #include <sgpp/base/operation/hash/OperationEvalBsplineNaive.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBspline.hpp>
-#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
@@ -21,7 +21,7 @@ OperationMultipleHierarchisationBspline::~OperationMultipleHierarchisationBsplin
 
 bool OperationMultipleHierarchisationBspline::doHierarchisation(base::DataVector& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataVector b(nodeValues);
   return solver.solve(system, b, nodeValues);
 }
@@ -44,7 +44,7 @@ void OperationMultipleHierarchisationBspline::doDehierarchisation(base::DataVect
 
 bool OperationMultipleHierarchisationBspline::doHierarchisation(base::DataMatrix& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataMatrix B(nodeValues);
   return solver.solve(system, B, nodeValues);
 }
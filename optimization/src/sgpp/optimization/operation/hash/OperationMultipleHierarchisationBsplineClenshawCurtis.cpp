@@ -6,7 +6,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <sgpp/base/operation/hash/OperationEvalBsplineClenshawCurtisNaive.hpp>
-#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineClenshawCurtis.hpp>
 
@@ -23,7 +23,7 @@ OperationMultipleHierarchisationBsplineClenshawCurtis::
 bool OperationMultipleHierarchisationBsplineClenshawCurtis::doHierarchisation(
     base::DataVector& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataVector b(nodeValues);
   return solver.solve(system, b, nodeValues);
 }
@@ -48,7 +48,7 @@ void OperationMultipleHierarchisationBsplineClenshawCurtis::doDehierarchisation(
 bool OperationMultipleHierarchisationBsplineClenshawCurtis::doHierarchisation(
     base::DataMatrix& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataMatrix B(nodeValues);
   return solver.solve(system, B, nodeValues);
 }
@@ -6,7 +6,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <sgpp/base/operation/hash/OperationEvalModBsplineNaive.hpp>
-#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModBspline.hpp>
 
@@ -21,7 +21,7 @@ OperationMultipleHierarchisationModBspline::~OperationMultipleHierarchisationMod
 
 bool OperationMultipleHierarchisationModBspline::doHierarchisation(base::DataVector& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataVector b(nodeValues);
   return solver.solve(system, b, nodeValues);
 }
@@ -44,7 +44,7 @@ void OperationMultipleHierarchisationModBspline::doDehierarchisation(base::DataV
 
 bool OperationMultipleHierarchisationModBspline::doHierarchisation(base::DataMatrix& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataMatrix B(nodeValues);
   return solver.solve(system, B, nodeValues);
 }
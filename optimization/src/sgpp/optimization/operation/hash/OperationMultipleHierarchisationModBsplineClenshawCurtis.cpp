@@ -6,7 +6,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <sgpp/base/operation/hash/OperationEvalModBsplineClenshawCurtisNaive.hpp>
-#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModBsplineClenshawCurtis.hpp>
 
@@ -24,7 +24,7 @@ OperationMultipleHierarchisationModBsplineClenshawCurtis::
 bool OperationMultipleHierarchisationModBsplineClenshawCurtis::doHierarchisation(
     base::DataVector& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataVector b(nodeValues);
   return solver.solve(system, b, nodeValues);
 }
@@ -49,7 +49,7 @@ void OperationMultipleHierarchisationModBsplineClenshawCurtis::doDehierarchisati
 bool OperationMultipleHierarchisationModBsplineClenshawCurtis::doHierarchisation(
     base::DataMatrix& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataMatrix B(nodeValues);
   return solver.solve(system, B, nodeValues);
 }
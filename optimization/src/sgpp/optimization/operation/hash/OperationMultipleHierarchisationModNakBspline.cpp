@@ -7,7 +7,7 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModNakBspline.hpp>
 #include <sgpp/base/operation/hash/OperationEvalModNakBsplineNaive.hpp>
-#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/solver/CombinationTechnique.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
@@ -24,7 +24,7 @@ OperationMultipleHierarchisationModNakBspline::
 bool OperationMultipleHierarchisationModNakBspline::doHierarchisation(
     base::DataVector& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataVector b(nodeValues);
   return solver.solve(system, b, nodeValues);
 }
@@ -49,7 +49,7 @@ void OperationMultipleHierarchisationModNakBspline::doDehierarchisation(
 bool OperationMultipleHierarchisationModNakBspline::doHierarchisation(
     base::DataMatrix& nodeValues) {
   base::HierarchisationSLE system(grid);
-  base::sle_solver::Auto solver;
+  base::sle_solver::CombinationTechnique solver;
   base::DataMatrix B(nodeValues);
   return solver.solve(system, B, nodeValues);
 }
@@ -78,6 +78,8 @@ void CMAES::optimize() {
   double sigma = 0.3;
 
   base::DataMatrix X(d, lambda), Y(d, lambda);
+  // offspring (row-wise) for the batched evaluation
+  base::DataMatrix XRows(lambda, d);
   base::DataVector x(d), y(d), tmp(d);
   base::DataVector fX(lambda);
   std::vector<size_t> fXOrder(lambda);
@@ -118,22 +120,13 @@ void CMAES::optimize() {
       x.mult(sigma);
       x.add(m);
       X.setColumn(j, x);
-
-      {
-        bool inDomain = true;
-
-        for (size_t t = 0; t < d; t++) {
-          if ((x[t] < 0.0) || (x[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
-        }
-
-        fX[j] = (inDomain ? f->eval(x) : std::numeric_limits<double>::infinity());
-        fXOrder[j] = j;
-      }
+      XRows.setRow(j, x);
+      fXOrder[j] = j;
     }
 
+    // evaluate the whole generation at once
+    evalInDomain(*f, XRows, fX);
+
     numberOfFcnEvals += lambda;
 
     std::sort(fXOrder.begin(), fXOrder.end(),
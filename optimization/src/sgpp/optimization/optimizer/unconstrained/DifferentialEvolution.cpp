@@ -15,6 +15,10 @@
 #include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
 namespace sgpp {
 namespace optimization {
 namespace optimizer {
@@ -66,15 +70,22 @@ void DifferentialEvolution::optimize() {
   // (no need to swap those)
   base::DataVector fx(populationSize);
 
+  // mutated points of the current generation (row-wise) and their function values
+  base::DataMatrix y(populationSize, d);
+  base::DataVector fy(populationSize);
+
   // initial pseudorandom points
   for (size_t i = 0; i < populationSize; i++) {
     for (size_t t = 0; t < d; t++) {
       (*xOld)[i][t] = base::RandomNumberGenerator::getInstance().getUniformRN();
     }
 
-    fx[i] = f->eval((*xOld)[i]);
+    y.setRow(i, (*xOld)[i]);
   }
 
+  // evaluate the initial population at once
+  f->eval(y, fx);
+
   // smallest function value in the population
   double fCurrentOpt = std::numeric_limits<double>::infinity();
   // index of the point with value fOpt
@@ -129,71 +140,78 @@ void DifferentialEvolution::optimize() {
     const std::vector<size_t>& j_k = j[k];
     const std::vector<base::DataVector>& prob_k = prob[k];
 
-#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, xNew)
-    {  // NOLINT(whitespace/braces)
-      base::DataVector y(d);
-      base::ScalarFunction* curFPtr = f.get();
-#ifdef _OPENMP
-      std::unique_ptr<base::ScalarFunction> curF;
-
-      if (omp_get_max_threads() > 1) {
-        f->clone(curF);
-        curFPtr = curF.get();
-      }
+    // for each point in the population: mutate point
+    for (size_t i = 0; i < populationSize; i++) {
+      const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
+      const size_t& cur_j = j_k[i];
+      const base::DataVector& prob_ki = prob_k[i];
 
-#endif /* _OPENMP */
+      // for each dimension
+      for (size_t t = 0; t < d; t++) {
+        const double& curProb = prob_ki[t];
 
-// for each point in the population
-#pragma omp for schedule(dynamic)
+        if ((t == cur_j) || (curProb < crossoverProbability)) {
+          // mutate point in this dimension
+          y(i, t) = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
+        } else {
+          // don't mutate point in this dimension
+          y(i, t) = (*xOld)[i][t];
+        }
+      }
+    }
 
-      for (size_t i = 0; i < populationSize; i++) {
-        const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
-        const size_t& cur_j = j_k[i];
-        const base::DataVector& prob_ki = prob_k[i];
-        bool inDomain = true;
+    // evaluate mutated points (if not out of bounds)
+    if (f->isBatchEvalParallel()) {
+      // the objective evaluates the whole generation in parallel itself
+      evalInDomain(*f, y, fy);
+    } else {
+// every thread evaluates a contiguous part of the population at once
+#pragma omp parallel shared(y, fy)
+      {  // NOLINT(whitespace/braces)
+        base::ScalarFunction* curFPtr = f.get();
+        size_t threadCount = 1;
+        size_t threadIndex = 0;
+#ifdef _OPENMP
+        std::unique_ptr<base::ScalarFunction> curF;
+        threadCount = static_cast<size_t>(omp_get_num_threads());
+        threadIndex = static_cast<size_t>(omp_get_thread_num());
 
-        // for each dimension
-        for (size_t t = 0; t < d; t++) {
-          const double& curProb = prob_ki[t];
-
-          if ((t == cur_j) || (curProb < crossoverProbability)) {
-            // mutate point in this dimension
-            y[t] = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
-          } else {
-            // don't mutate point in this dimension
-            y[t] = (*xOld)[i][t];
-          }
-
-          // mutated point is out of bounds ==> discard
-          if ((y[t] < 0.0) || (y[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
+        if (threadCount > 1) {
+          f->clone(curF);
+          curFPtr = curF.get();
         }
 
-        // evaluate mutated point (if not out of bounds)
-        const double fy = (inDomain ? curFPtr->eval(y) : std::numeric_limits<double>::infinity());
+#endif /* _OPENMP */
+        const size_t begin = populationSize * threadIndex / threadCount;
+        const size_t end = populationSize * (threadIndex + 1) / threadCount;
+
+        if (begin < end) {
+          base::DataMatrix curY(end - begin, d);
+          base::DataVector curFy(end - begin);
+          std::copy(y.data() + begin * d, y.data() + end * d, curY.data());
+          evalInDomain(*curFPtr, curY, curFy);
+          std::copy(curFy.data(), curFy.data() + (end - begin), fy.data() + begin);
+        }
+      }
+    }
 
-        if (fy < fx[i]) {
-// function_value is better ==> replace point with mutated one
-#pragma omp critical
-          {
-            fx[i] = fy;
+    for (size_t i = 0; i < populationSize; i++) {
+      if (fy[i] < fx[i]) {
+        // function_value is better ==> replace point with mutated one
+        fx[i] = fy[i];
 
-            if (fy < fCurrentOpt) {
-              xOptIndex = i;
-              fCurrentOpt = fy;
-            }
-          }
+        if (fy[i] < fCurrentOpt) {
+          xOptIndex = i;
+          fCurrentOpt = fy[i];
+        }
 
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = y[t];
-          }
-        } else {
-          // function value not better ==> keep old point
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = (*xOld)[i][t];
-          }
+        for (size_t t = 0; t < d; t++) {
+          (*xNew)[i][t] = y(i, t);
+        }
+      } else {
+        // function value not better ==> keep old point
+        for (size_t t = 0; t < d; t++) {
+          (*xNew)[i][t] = (*xOld)[i][t];
         }
       }
     }
@@ -48,13 +48,19 @@ void NelderMead::optimize() {
   base::DataVector fPoints(d + 1);
   base::DataVector fPointsNew(d + 1);
 
+  base::DataMatrix simplex(d + 1, d);
+
   // construct starting simplex
   for (size_t t = 0; t < d; t++) {
     points[t + 1][t] = std::min(points[t + 1][t] + STARTING_SIMPLEX_EDGE_LENGTH, 1.0);
-    fPoints[t + 1] = f->eval(points[t + 1]);
   }
 
-  fPoints[0] = f->eval(points[0]);
+  // evaluate all vertices at once
+  for (size_t i = 0; i < d + 1; i++) {
+    simplex.setRow(i, points[i]);
+  }
+
+  f->eval(simplex, fPoints);
 
   std::vector<size_t> index(d + 1, 0);
   base::DataVector pointO(d);
@@ -176,19 +182,23 @@ void NelderMead::optimize() {
     }
 
     if (shrink) {
+      base::DataMatrix shrunkPoints(d, d);
+      base::DataVector fShrunkPoints(d);
+
       // shrink all points but the first
       for (size_t i = 1; i < d + 1; i++) {
-        bool in_domain = true;
-
         for (size_t t = 0; t < d; t++) {
           points[i][t] = points[0][t] + delta * (points[i][t] - points[0][t]);
-
-          if ((points[i][t] < 0.0) || (points[i][t] > 1.0)) {
-            in_domain = false;
-          }
         }
 
-        fPoints[i] = (in_domain ? f->eval(points[i]) : std::numeric_limits<double>::infinity());
+        shrunkPoints.setRow(i - 1, points[i]);
+      }
+
+      // evaluate the shrunk points at once
+      evalInDomain(*f, shrunkPoints, fShrunkPoints);
+
+      for (size_t i = 1; i < d + 1; i++) {
+        fPoints[i] = fShrunkPoints[i - 1];
       }
 
       numberOfFcnEvals += d;
@@ -203,6 +203,24 @@ class UnconstrainedOptimizer {
   base::DataMatrix xHist;
   /// search history vector (optimal values)
   base::DataVector fHist;
+
+  /**
+   * Evaluates a function at multiple points at once with
+   * base::ScalarFunction::eval(const base::DataMatrix&, base::DataVector&).
+   * Points outside of \f$[0, 1]^d\f$ are not evaluated,
+   * their function value is set to infinity.
+   *
+   * @param      f      function to evaluate
+   * @param      x      evaluation points (row-wise)
+   * @param[out] fx     function values at the evaluation points
+   */
+  static void evalInDomain(base::ScalarFunction& f, const base::DataMatrix& x,
+                           base::DataVector& fx) {
+    base::ScalarFunction::evalInDomain(
+        x, fx, [&f](const base::DataMatrix& xInDomain, base::DataVector& fxInDomain) {
+          f.eval(xInDomain, fxInDomain);
+        });
+  }
 };
 }  // namespace optimizer
 }  // namespace optimization
@@ -6,9 +6,12 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/function/scalar/ComponentScalarFunction.hpp>
 #include <sgpp/base/function/scalar/ComponentScalarFunctionGradient.hpp>
 #include <sgpp/base/function/scalar/ComponentScalarFunctionHessian.hpp>
+#include <sgpp/base/function/scalar/InterpolantScalarFunction.hpp>
+#include <sgpp/base/function/scalar/InterpolantScalarFunctionGradient.hpp>
 #include <sgpp/base/function/scalar/WrapperScalarFunction.hpp>
 #include <sgpp/base/function/scalar/WrapperScalarFunctionGradient.hpp>
 #include <sgpp/base/function/scalar/WrapperScalarFunctionHessian.hpp>
@@ -19,15 +22,19 @@
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
 
 #include <limits>
+#include <memory>
 #include <vector>
 
 #include "CheckEqualFunction.hpp"
+#include "GridCreator.hpp"
 
 using sgpp::base::ComponentScalarFunction;
 using sgpp::base::ComponentScalarFunctionGradient;
 using sgpp::base::ComponentScalarFunctionHessian;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::base::InterpolantScalarFunction;
+using sgpp::base::InterpolantScalarFunctionGradient;
 using sgpp::base::RandomNumberGenerator;
 using sgpp::base::ScalarFunction;
 using sgpp::base::ScalarFunctionGradient;
@@ -412,3 +419,90 @@ BOOST_AUTO_TEST_CASE(TestWrapperVectorFunctionHessian) {
   f2.clone(f2Clone);
   checkEqualFunction(f1, *f2Clone);
 }
+
+BOOST_AUTO_TEST_CASE(TestInterpolantScalarFunctionBatchedEval) {
+  // Test batched evaluation of sgpp::base::InterpolantScalarFunction(Gradient).
+  const size_t d = 2;
+  const size_t p = 3;
+  const size_t l = 4;
+  const size_t N = 50;
+  const double inf = std::numeric_limits<double>::infinity();
+
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGrids(d, p, grids);
+
+  DataMatrix x(N, d);
+
+  for (size_t k = 0; k < N; k++) {
+    for (size_t t = 0; t < d; t++) {
+      x(k, t) = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  // some points outside of the domain
+  x(3, 0) = -0.1;
+  x(17, 1) = 1.5;
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(l);
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+    }
+
+    InterpolantScalarFunction f(*grid, alpha);
+    DataVector value;
+    f.eval(x, value);
+    BOOST_CHECK_EQUAL(value.getSize(), N);
+
+    DataVector xk(d);
+
+    for (size_t k = 0; k < N; k++) {
+      x.getRow(k, xk);
+      const double fx = f.eval(xk);
+
+      if (fx == inf) {
+        BOOST_CHECK_EQUAL(value[k], inf);
+      } else {
+        BOOST_CHECK_SMALL(value[k] - fx, 1e-10);
+      }
+    }
+
+    // not all grids support gradients
+    std::unique_ptr<InterpolantScalarFunctionGradient> fGradient;
+
+    try {
+      fGradient.reset(new InterpolantScalarFunctionGradient(*grid, alpha));
+    } catch (sgpp::base::factory_exception&) {
+      continue;
+    }
+
+    DataVector valueGradient;
+    DataMatrix gradient;
+    fGradient->eval(x, valueGradient, gradient);
+    BOOST_CHECK_EQUAL(valueGradient.getSize(), N);
+    BOOST_CHECK_EQUAL(gradient.getNrows(), N);
+    BOOST_CHECK_EQUAL(gradient.getNcols(), d);
+
+    DataVector gradientk(d);
+
+    for (size_t k = 0; k < N; k++) {
+      x.getRow(k, xk);
+      const double fx = fGradient->eval(xk, gradientk);
+
+      if (fx == inf) {
+        BOOST_CHECK_EQUAL(valueGradient[k], inf);
+        continue;
+      }
+
+      BOOST_CHECK_SMALL(valueGradient[k] - fx, 1e-10);
+
+      for (size_t t = 0; t < d; t++) {
+        BOOST_CHECK_SMALL(gradient(k, t) - gradientk[t], 1e-10);
+      }
+    }
+  }
+}
@@ -15,6 +15,7 @@
 #include <sgpp/base/function/vector/InterpolantVectorFunction.hpp>
 #include <sgpp/base/function/vector/InterpolantVectorFunctionGradient.hpp>
 #include <sgpp/base/tools/Printer.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
 #include <sgpp/optimization/optimizer/constrained/AugmentedLagrangian.hpp>
 #include <sgpp/optimization/optimizer/constrained/LogBarrier.hpp>
@@ -32,8 +33,13 @@
 #include <sgpp/optimization/optimizer/unconstrained/NLCG.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/Rprop.hpp>
 
+#include <limits>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "CheckEqualFunction.hpp"
 #include "GridCreator.hpp"
 #include "ObjectiveFunctions.hpp"
@@ -53,6 +59,55 @@ using sgpp::base::VectorFunction;
 using sgpp::base::VectorFunctionGradient;
 using sgpp::optimization::OperationMultipleHierarchisation;
 
+namespace {
+
+/**
+ * Shifted sphere function that counts its (batched) evaluations.
+ */
+class CountingSphereFunction : public ScalarFunction {
+ public:
+  CountingSphereFunction(size_t d, bool batchEvalParallel)
+      : ScalarFunction(d),
+        batchEvalParallel(batchEvalParallel),
+        batchEvalCount(0),
+        parallelBatchEvalCount(0) {}
+
+  double eval(const sgpp::base::DataVector& x) override {
+    double result = 0.0;
+
+    for (size_t t = 0; t < d; t++) {
+      result += (x[t] - 0.3) * (x[t] - 0.3);
+    }
+
+    return result;
+  }
+
+  void eval(const sgpp::base::DataMatrix& x, sgpp::base::DataVector& value) override {
+#ifdef _OPENMP
+    if (omp_in_parallel()) {
+#pragma omp atomic
+      parallelBatchEvalCount++;
+    }
+#endif
+
+#pragma omp atomic
+    batchEvalCount++;
+    ScalarFunction::eval(x, value);
+  }
+
+  bool isBatchEvalParallel() const override { return batchEvalParallel; }
+
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override {
+    clone = std::unique_ptr<ScalarFunction>(new CountingSphereFunction(d, batchEvalParallel));
+  }
+
+  bool batchEvalParallel;
+  size_t batchEvalCount;
+  size_t parallelBatchEvalCount;
+};
+
+}  // namespace
+
 BOOST_AUTO_TEST_CASE(TestUnconstrainedOptimizers) {
   // Test unconstrained optimizers in sgpp::optimization::optimizer.
   Printer::getInstance().setVerbosity(-1);
@@ -391,6 +446,43 @@ BOOST_AUTO_TEST_CASE(TestUnconstrainedOptimizers) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestDifferentialEvolutionBatchEval) {
+  // Test that differential evolution evaluates whole generations at once
+  // if the objective function evaluates them in parallel itself.
+  Printer::getInstance().setVerbosity(-1);
+  const size_t d = 3;
+  const size_t N = 2000;
+  std::vector<sgpp::base::DataVector> xOpt;
+  std::vector<double> fOpt;
+
+  for (bool batchEvalParallel : {false, true}) {
+    CountingSphereFunction f(d, batchEvalParallel);
+    sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+    sgpp::optimization::optimizer::DifferentialEvolution differentialEvolution(f, N);
+    differentialEvolution.optimize();
+    xOpt.push_back(differentialEvolution.getOptimalPoint());
+    fOpt.push_back(differentialEvolution.getOptimalValue());
+
+    if (batchEvalParallel) {
+      // the optimizer works on a clone of the objective function
+      const CountingSphereFunction& fClone = dynamic_cast<const CountingSphereFunction&>(
+          differentialEvolution.getObjectiveFunction());
+      // initial population and at least one generation
+      BOOST_CHECK_GE(fClone.batchEvalCount, 2U);
+      BOOST_CHECK_EQUAL(fClone.parallelBatchEvalCount, 0U);
+    }
+  }
+
+  // both ways of evaluation yield the same optimization run
+  BOOST_CHECK_EQUAL(fOpt[0], fOpt[1]);
+
+  for (size_t t = 0; t < d; t++) {
+    BOOST_CHECK_EQUAL(xOpt[0][t], xOpt[1][t]);
+  }
+
+  BOOST_CHECK_SMALL(fOpt[1], 1e-4);
+}
+
 BOOST_AUTO_TEST_CASE(TestLeastSquaresOptimizers) {
   // Test least squares optimizers in sgpp::optimization::optimizer.
   Printer::getInstance().setVerbosity(-1);
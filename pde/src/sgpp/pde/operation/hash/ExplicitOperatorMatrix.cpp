@@ -0,0 +1,51 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+ExplicitOperatorMatrix::ExplicitOperatorMatrix() : denseMatrix(nullptr), packedMatrix(0) {}
+
+ExplicitOperatorMatrix::ExplicitOperatorMatrix(sgpp::base::DataMatrix* m)
+    : denseMatrix(m), packedMatrix(0) {}
+
+ExplicitOperatorMatrix::ExplicitOperatorMatrix(size_t size)
+    : denseMatrix(nullptr), packedMatrix(size) {}
+
+void ExplicitOperatorMatrix::setColumn(size_t i, const sgpp::base::DataVector& column) {
+  if (denseMatrix != nullptr) {
+    denseMatrix->setColumn(i, column);
+  } else {
+    for (size_t j = 0; j <= i; j++) {
+      packedMatrix.set(j, i, column[j]);
+    }
+  }
+}
+
+void ExplicitOperatorMatrix::mult(const sgpp::base::DataVector& alpha,
+                                  sgpp::base::DataVector& result) const {
+  if (denseMatrix != nullptr) {
+    if (alpha.getSize() != denseMatrix->getNcols() ||
+        result.getSize() != denseMatrix->getNrows()) {
+      throw sgpp::base::data_exception("Dimensions do not match!");
+    }
+
+    denseMatrix->mult(alpha, result);
+  } else {
+    if (alpha.getSize() != packedMatrix.getSize() || result.getSize() != packedMatrix.getSize()) {
+      throw sgpp::base::data_exception("Dimensions do not match!");
+    }
+
+    packedMatrix.mult(alpha, result);
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,99 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef EXPLICITOPERATORMATRIX_HPP
+#define EXPLICITOPERATORMATRIX_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/SymmetricPackedMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Storage of the symmetric matrix of an explicit operator (e.g., OperationMatrixLTwoDotExplicit*
+ * or OperationLaplaceExplicit*).
+ *
+ * If the matrix is provided by the user of the operator, it is stored densely in that
+ * external DataMatrix (which is not destroyed by this class), so that the user can access
+ * the full matrix. Otherwise, an own SymmetricPackedMatrix is created, which stores only the
+ * upper triangle.
+ * In both cases, mult() computes the matrix-vector product in parallel.
+ */
+class ExplicitOperatorMatrix {
+ public:
+  /**
+   * Constructor for an empty matrix.
+   */
+  ExplicitOperatorMatrix();
+
+  /**
+   * Constructor that uses an external dense matrix.
+   *
+   * @param m pointer to datamatrix of size (number of grid point) x (number of grid points)
+   */
+  explicit ExplicitOperatorMatrix(sgpp::base::DataMatrix* m);
+
+  /**
+   * Constructor that creates an own packed symmetric matrix.
+   *
+   * @param size number of grid points
+   */
+  explicit ExplicitOperatorMatrix(size_t size);
+
+  /**
+   * @return number of rows (and columns)
+   */
+  inline size_t getSize() const {
+    return (denseMatrix != nullptr) ? denseMatrix->getNrows() : packedMatrix.getSize();
+  }
+
+  /**
+   * Sets both entries \f$(i, j)\f$ and \f$(j, i)\f$.
+   *
+   * @param i     row
+   * @param j     column
+   * @param value new value
+   */
+  inline void set(size_t i, size_t j, double value) {
+    if (denseMatrix != nullptr) {
+      denseMatrix->set(i, j, value);
+      denseMatrix->set(j, i, value);
+    } else {
+      packedMatrix.set(i, j, value);
+    }
+  }
+
+  /**
+   * Sets the i-th column (and therefore the i-th row) of the matrix.
+   * If the matrix is packed, only the entries on and above the diagonal are used.
+   *
+   * @param i       column
+   * @param column  new values of the column
+   */
+  void setColumn(size_t i, const sgpp::base::DataVector& column);
+
+  /**
+   * Multiplies the matrix with a vector.
+   *
+   * @param alpha   DataVector that is multiplied to the matrix
+   * @param result  DataVector into which the result of multiplication is stored
+   */
+  void mult(const sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) const;
+
+ private:
+  /// external dense matrix (nullptr if the packed matrix is used)
+  sgpp::base::DataMatrix* denseMatrix;
+  /// own packed matrix
+  sgpp::base::SymmetricPackedMatrix packedMatrix;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* EXPLICITOPERATORMATRIX_HPP */
@@ -30,19 +30,17 @@ namespace pde {
 
 OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::DataMatrix* m,
                                                                sgpp::base::GridStorage* storage)
-  : UpDownOneOpDim(storage), ownsMatrix_(false) {
-  m_ = m;
+  : UpDownOneOpDim(storage), matrix_(m) {
   buildMatrix(storage);
 }
 
 OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::GridStorage* storage)
-  : UpDownOneOpDim(storage), ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(storage->getSize(), storage->getSize());
+  : UpDownOneOpDim(storage), matrix_(storage->getSize()) {
   buildMatrix(storage);
 }
 
 void OperationLaplaceExplicitLinear::buildMatrix(sgpp::base::GridStorage* storage) {
-  size_t ncols = m_->getNcols();
+  size_t ncols = storage->getSize();
   base::DataVector alpha(ncols);
   base::DataVector beta(ncols);
   // FIXME: inefficient
@@ -50,38 +48,15 @@ void OperationLaplaceExplicitLinear::buildMatrix(sgpp::base::GridStorage* storag
     alpha.setAll(0.0);
     alpha.set(i, 1.0);
     UpDownOneOpDim::mult(alpha, beta);
-    m_->setColumn(i, beta);
+    matrix_.setColumn(i, beta);
   }
 }
 
-OperationLaplaceExplicitLinear::~OperationLaplaceExplicitLinear() {
-  if (ownsMatrix_) delete m_;
-}
+OperationLaplaceExplicitLinear::~OperationLaplaceExplicitLinear() {}
 
 void OperationLaplaceExplicitLinear::mult(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
-  size_t nrows = m_->getNrows();
-  size_t ncols = m_->getNcols();
-
-  if (alpha.getSize() != ncols || result.getSize() != nrows) {
-    throw sgpp::base::data_exception("Dimensions do not match!");
-  }
-
-  double* data = m_->getPointer();
-
-  // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
-  for (size_t i = 0; i < nrows; i++) {
-    for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
-    }
-
-    result[i] = temp;
-    temp = 0.;
-    acc += ncols;
-  }
+  matrix_.mult(alpha, result);
 }
 
 void OperationLaplaceExplicitLinear::specialOP(sgpp::base::DataVector& alpha,
@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceLinear.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -29,7 +30,7 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
    */
   OperationLaplaceExplicitLinear(sgpp::base::DataMatrix* m, sgpp::base::GridStorage* storage);
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of OperationLaplaceExplicitLinear
    *
    * @param storage pointer to the sparse grid storage
@@ -65,8 +66,7 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
    */
   void buildMatrix(sgpp::base::GridStorage* storage);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
 };
 
 }  // namespace pde
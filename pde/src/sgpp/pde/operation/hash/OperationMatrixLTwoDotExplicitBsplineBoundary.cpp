@@ -21,15 +21,13 @@ namespace pde {
 
 OperationMatrixLTwoDotExplicitBsplineBoundary::OperationMatrixLTwoDotExplicitBsplineBoundary(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
-  m_ = m;
+    : matrix_(m) {
   buildMatrix(grid);
 }
 
 OperationMatrixLTwoDotExplicitBsplineBoundary::OperationMatrixLTwoDotExplicitBsplineBoundary(
   sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+    : matrix_(grid->getSize()) {
   buildMatrix(grid);
 }
 
@@ -99,40 +97,16 @@ void OperationMatrixLTwoDotExplicitBsplineBoundary::buildMatrix(base::Grid* grid
           res *= scaling * temp_res;
         }
       }
-      m_->set(i, j, res);
-      m_->set(j, i, res);
+      matrix_.set(i, j, res);
     }
   }
 }
 
-OperationMatrixLTwoDotExplicitBsplineBoundary::~OperationMatrixLTwoDotExplicitBsplineBoundary() {
-  if (ownsMatrix_) delete m_;
-}
+OperationMatrixLTwoDotExplicitBsplineBoundary::~OperationMatrixLTwoDotExplicitBsplineBoundary() {}
 
 void OperationMatrixLTwoDotExplicitBsplineBoundary::mult(base::DataVector& alpha,
                                                  base::DataVector& result) {
-  size_t nrows = m_->getNrows();
-  size_t ncols = m_->getNcols();
-
-  if (alpha.getSize() != ncols || result.getSize() != nrows) {
-    throw base::data_exception("Dimensions do not match!");
-  }
-
-  double* data = m_->getPointer();
-
-  // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
-  for (size_t i = 0; i < nrows; i++) {
-    for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
-    }
-
-    result[i] = temp;
-    temp = 0.;
-    acc += ncols;
-  }
+  matrix_.mult(alpha, result);
 }
 
 }  // namespace pde
@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -28,7 +29,7 @@ class OperationMatrixLTwoDotExplicitBsplineBoundary : public sgpp::base::Operati
    */
   OperationMatrixLTwoDotExplicitBsplineBoundary(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitBsplineBoundaryFullGrid
    *
    * @param grid the sparse grid
@@ -54,8 +55,7 @@ class OperationMatrixLTwoDotExplicitBsplineBoundary : public sgpp::base::Operati
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
 };
 
 }  // namespace pde
@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -37,7 +38,7 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
   OperationMatrixLTwoDotExplicitLinear(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
 
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitLinearFullGrid
    *
    * @param grid the sparse grid
@@ -59,14 +60,15 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
 
   /**
    * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
-   * @param mat matrix for storage of L2 producs
+   * @param mat matrix for storage of L2 producs (DataMatrix or ExplicitOperatorMatrix)
    * @param grid the underlying grid
    * @param i_start start index for row iteration
    * @param i_end end index for row iteration
    * @param j_start start index for column iteration
    * @param j_end end index for column iteration
    */
-  inline void buildMatrixWithBounds(sgpp::base::DataMatrix* mat, sgpp::base::Grid* grid,
+  template <class MATRIX>
+  inline void buildMatrixWithBounds(MATRIX* mat, sgpp::base::Grid* grid,
                                     size_t i_start = 0, size_t i_end = 0, size_t j_start = 0,
                                     size_t j_end = 0) {
     size_t gridSize = grid->getSize();
@@ -83,11 +85,15 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
     // init standard values
     i_end = i_end == 0 ? gridSize : i_end;
 
+    j_end = j_end == 0 ? gridSize : j_end;
+
+    // the rows are independent, in the quadratic case only the upper triangle is computed
+    // (row i has j_end - i entries), hence the dynamic schedule
+#pragma omp parallel for schedule(dynamic, 16)
     for (size_t i = i_start; i < i_end; i++) {
-      j_start = j_start == 0 ? i : j_start;
-      j_end = j_end == 0 ? gridSize : j_end;
-#pragma omp parallel for schedule(guided)
-      for (size_t j = j_start; j < j_end; j++) {
+      const size_t row_j_start = mat_quadratic ? i : j_start;
+
+      for (size_t j = row_j_start; j < j_end; j++) {
         double res = 1;
 
         for (size_t k = 0; k < gridDim; k++) {
@@ -145,8 +151,7 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
 };
 
 }  // namespace pde
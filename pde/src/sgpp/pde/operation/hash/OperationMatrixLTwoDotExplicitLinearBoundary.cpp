@@ -15,21 +15,17 @@ namespace pde {
 
 OperationMatrixLTwoDotExplicitLinearBoundary::OperationMatrixLTwoDotExplicitLinearBoundary(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
-  m_ = m;
+    : matrix_(m) {
   buildMatrix(grid);
 }
 
 OperationMatrixLTwoDotExplicitLinearBoundary::OperationMatrixLTwoDotExplicitLinearBoundary(
     sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+    : matrix_(grid->getSize()) {
   buildMatrix(grid);
 }
 
-OperationMatrixLTwoDotExplicitLinearBoundary::~OperationMatrixLTwoDotExplicitLinearBoundary() {
-  if (ownsMatrix_) delete m_;
-}
+OperationMatrixLTwoDotExplicitLinearBoundary::~OperationMatrixLTwoDotExplicitLinearBoundary() {}
 
 void OperationMatrixLTwoDotExplicitLinearBoundary::buildMatrix(sgpp::base::Grid* grid) {
   // Build matrix (in the moment just by multiplying the OperationMatrix with the unit vectors):
@@ -49,34 +45,13 @@ void OperationMatrixLTwoDotExplicitLinearBoundary::buildMatrix(sgpp::base::Grid*
 
     // Multiply with operation matrix
     opMatrix->mult(unit, result);
-    m_->setColumn(i, result);
+    matrix_.setColumn(i, result);
   }
 }
 
 void OperationMatrixLTwoDotExplicitLinearBoundary::mult(sgpp::base::DataVector& alpha,
                                                         sgpp::base::DataVector& result) {
-  size_t nrows = m_->getNrows();
-  size_t ncols = m_->getNcols();
-
-  if (alpha.getSize() != ncols || result.getSize() != nrows) {
-    throw sgpp::base::data_exception("Dimensions do not match!");
-  }
-
-  double* data = m_->getPointer();
-
-  // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
-  for (size_t i = 0; i < nrows; i++) {
-    for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
-    }
-
-    result[i] = temp;
-    temp = 0.;
-    acc += ncols;
-  }
+  matrix_.mult(alpha, result);
 }
 
 }  // namespace pde
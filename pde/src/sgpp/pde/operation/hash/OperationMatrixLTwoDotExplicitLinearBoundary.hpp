@@ -9,6 +9,7 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -30,7 +31,7 @@ class OperationMatrixLTwoDotExplicitLinearBoundary : public sgpp::base::Operatio
    */
   OperationMatrixLTwoDotExplicitLinearBoundary(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of
    * OperationMatrixLTwoDotExplicitLinearBoundaryFullGrid
    *
@@ -57,8 +58,7 @@ class OperationMatrixLTwoDotExplicitLinearBoundary : public sgpp::base::Operatio
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
 };
 
 }  // namespace pde
@@ -10,6 +10,7 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -36,7 +37,7 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
    */
   OperationMatrixLTwoDotExplicitModLinear(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitModLinearFullGrid
    *
    * @param grid the sparse grid
@@ -58,14 +59,15 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
 
   /**
    * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
-   * @param mat matrix for storage of L2 producs
+   * @param mat matrix for storage of L2 producs (DataMatrix or ExplicitOperatorMatrix)
    * @param grid the underlying grid
    * @param i_start start index for row iteration
    * @param i_end end index for row iteration
    * @param j_start start index for column iteration
    * @param j_end end index for column iteration
    */
-  inline void buildMatrixWithBounds(sgpp::base::DataMatrix* mat, sgpp::base::Grid* grid,
+  template <class MATRIX>
+  inline void buildMatrixWithBounds(MATRIX* mat, sgpp::base::Grid* grid,
                                     size_t i_start = 0, size_t i_end = 0, size_t j_start = 0,
                                     size_t j_end = 0) {
     size_t gridSize = grid->getSize();
@@ -80,11 +82,15 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
     // init standard values
     i_end = i_end == 0 ? gridSize : i_end;
 
+    j_end = j_end == 0 ? gridSize : j_end;
+
+    // the rows are independent, in the quadratic case only the upper triangle is computed
+    // (row i has j_end - i entries), hence the dynamic schedule
+#pragma omp parallel for schedule(dynamic, 16)
     for (size_t i = i_start; i < i_end; i++) {
-      j_start = j_start == 0 ? i : j_start;
-      j_end = j_end == 0 ? gridSize : j_end;
+      const size_t row_j_start = mat_quadratic ? i : j_start;
 
-      for (size_t j = j_start; j < j_end; j++) {
+      for (size_t j = row_j_start; j < j_end; j++) {
         double res = 1;
 
         for (size_t k = 0; k < gridDim; k++) {
@@ -186,8 +192,7 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
 };
 
 }  // namespace pde
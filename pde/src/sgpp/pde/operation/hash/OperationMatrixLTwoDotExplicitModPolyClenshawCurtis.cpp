@@ -23,17 +23,15 @@ namespace pde {
 OperationMatrixLTwoDotExplicitModPolyClenshawCurtis::
   OperationMatrixLTwoDotExplicitModPolyClenshawCurtis(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-  : ownsMatrix_(false),
+  : matrix_(m),
     clenshawCurtisTable(base::ClenshawCurtisTable::getInstance()) {
-  m_ = m;
   buildMatrix(grid);
 }
 
 OperationMatrixLTwoDotExplicitModPolyClenshawCurtis::
     OperationMatrixLTwoDotExplicitModPolyClenshawCurtis(sgpp::base::Grid* grid)
-    : ownsMatrix_(true),
+    : matrix_(grid->getSize()),
     clenshawCurtisTable(base::ClenshawCurtisTable::getInstance()) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
   buildMatrix(grid);
 }
 
@@ -78,41 +76,17 @@ void OperationMatrixLTwoDotExplicitModPolyClenshawCurtis::buildMatrix(sgpp::base
           res *= temp_res;
         }
       }
-      m_->set(i, j, res);
-      m_->set(j, i, res);
+      matrix_.set(i, j, res);
     }
   }
 }
 
 OperationMatrixLTwoDotExplicitModPolyClenshawCurtis::
-    ~OperationMatrixLTwoDotExplicitModPolyClenshawCurtis() {
-  if (ownsMatrix_) delete m_;
-}
+    ~OperationMatrixLTwoDotExplicitModPolyClenshawCurtis() {}
 
 void OperationMatrixLTwoDotExplicitModPolyClenshawCurtis::mult(sgpp::base::DataVector& alpha,
                                                  sgpp::base::DataVector& result) {
-  size_t nrows = m_->getNrows();
-  size_t ncols = m_->getNcols();
-
-  if (alpha.getSize() != ncols || result.getSize() != nrows) {
-    throw sgpp::base::data_exception("Dimensions do not match!");
-  }
-
-  double* data = m_->getPointer();
-
-  // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
-  for (size_t i = 0; i < nrows; i++) {
-    for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
-    }
-
-    result[i] = temp;
-    temp = 0.;
-    acc += ncols;
-  }
+  matrix_.mult(alpha, result);
 }
 
 }  // namespace pde
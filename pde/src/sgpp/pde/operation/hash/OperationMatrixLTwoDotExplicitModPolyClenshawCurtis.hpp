@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/tools/ClenshawCurtisTable.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -30,7 +31,7 @@ class OperationMatrixLTwoDotExplicitModPolyClenshawCurtis : public sgpp::base::O
   OperationMatrixLTwoDotExplicitModPolyClenshawCurtis(sgpp::base::DataMatrix* m,
                                                    sgpp::base::Grid* grid);
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitModPolyClenshawCurtisFullGrid
    *
    * @param grid the sparse grid
@@ -56,8 +57,7 @@ class OperationMatrixLTwoDotExplicitModPolyClenshawCurtis : public sgpp::base::O
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
   base::ClenshawCurtisTable& clenshawCurtisTable;
 };
 
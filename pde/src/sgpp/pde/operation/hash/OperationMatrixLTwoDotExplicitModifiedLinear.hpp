@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/pde/operation/hash/ExplicitOperatorMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -36,7 +37,7 @@ class OperationMatrixLTwoDotExplicitModifiedLinear : public sgpp::base::Operatio
    */
   OperationMatrixLTwoDotExplicitModifiedLinear(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
   /**
-   * Constructor that creates an own matrix
+   * Constructor that creates an own matrix (only the upper triangle is stored)
    * i.e. matrix is destroyed by the destructor of
    * OperationMatrixLTwoDotExplicitModifiedLinearFullGrid
    *
@@ -59,14 +60,15 @@ class OperationMatrixLTwoDotExplicitModifiedLinear : public sgpp::base::Operatio
 
   /**
    * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
-   * @param mat matrix for storage of L2 products
+   * @param mat matrix for storage of L2 products (DataMatrix or ExplicitOperatorMatrix)
    * @param grid the underlying grid
    * @param i_start start index for row iteration
    * @param i_end end index for row iteration
    * @param j_start start index for column iteration
    * @param j_end end index for column iteration
    */
-  inline void buildMatrixWithBounds(sgpp::base::DataMatrix* mat, sgpp::base::Grid* grid,
+  template <class MATRIX>
+  inline void buildMatrixWithBounds(MATRIX* mat, sgpp::base::Grid* grid,
                                     size_t i_start = 0, size_t i_end = 0, size_t j_start = 0,
                                     size_t j_end = 0) {
     size_t gridSize = grid->getSize();
@@ -195,8 +197,7 @@ class OperationMatrixLTwoDotExplicitModifiedLinear : public sgpp::base::Operatio
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
-  sgpp::base::DataMatrix* m_;
-  bool ownsMatrix_;
+  ExplicitOperatorMatrix matrix_;
 };
 
 }  // namespace pde
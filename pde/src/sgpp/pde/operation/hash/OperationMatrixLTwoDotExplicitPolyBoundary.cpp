@@ -20,15 +20,13 @@ namespace pde {
 
 OperationMatrixLTwoDotExplicitPolyBoundary::OperationMatrixLTwoDotExplicitPolyBoundary(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
-  m_ = m;
+    : matrix_(m) {
   buildMatrix(grid);
 }
 
 OperationMatrixLTwoDotExplicitPolyBoundary::
     OperationMatrixLTwoDotExplicitPolyBoundary(sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+    : matrix_(grid->getSize()) {
   buildMatrix(grid);
 }
 
@@ -109,40 +107,16 @@ void OperationMatrixLTwoDotExplicitPolyBoundary::buildMatrix(sgpp::base::Grid* g
         }
       }
       // std::cout << "res:" << res << std::endl;
-      m_->set(i, j, res);
-      m_->set(j, i, res);
+      matrix_.set(i, j, res);
     }
   }
 }
 
-OperationMatrixLTwoDotExplicitPolyBoundary::~OperationMatrixLTwoDotExplicitPolyBoundary() {
-  if (ownsMatrix_) delete m_;
-}
+OperationMatrixLTwoDotExplicitPolyBoundary::~OperationMatrixLTwoDotExplicitPolyBoundary() {}
 
 void OperationMatrixLTwoDotExplicitPolyBoundary::mult(sgpp::base::DataVector& alpha,
                                                  sgpp::base::DataVector& result) {
-  size_t nrows = m_->getNrows();
-  size_t ncols = m_->getNcols();
-
-  if (alpha.getSize() != ncols || result.getSize() != nrows) {
-    throw sgpp::base::data_exception("Dimensions do not match!");
-  }
-
-  double* data = m_->getPointer();
-
-  // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
-  for (size_t i = 0; i < nrows; i++) {
-    for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
-    }
-
-    result[i] = temp;
-    temp = 0.;
-    acc += ncols;
-  }
+  matrix_.mult(alpha, result);
 }
 
 }  // namespace pde
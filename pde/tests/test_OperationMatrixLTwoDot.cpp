@@ -8,8 +8,13 @@
 
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -502,6 +507,52 @@ BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitBsplineClenshawCurtis) {
   delete opExplicit;
 }
 
+// test if operators with an own (packed) matrix give the same results as with an external matrix
+BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitOwnMatrix) {
+  const size_t d = 3;
+  const size_t l = 4;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+  grid->getGenerator().regular(l);
+  const size_t n = grid->getSize();
+
+  sgpp::base::DataMatrix m(n, n);
+  sgpp::base::DataMatrix mLaplace(n, n);
+  std::unique_ptr<sgpp::base::OperationMatrix> opExternal(
+      sgpp::op_factory::createOperationLTwoDotExplicit(&m, *grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opOwn(
+      sgpp::op_factory::createOperationLTwoDotExplicit(*grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opLaplaceExternal(
+      sgpp::op_factory::createOperationLaplaceExplicit(&mLaplace, *grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opLaplaceOwn(
+      sgpp::op_factory::createOperationLaplaceExplicit(*grid));
+
+  sgpp::base::DataVector alpha(n);
+
+  for (size_t i = 0; i < n; i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  sgpp::base::DataVector resultExternal(n);
+  sgpp::base::DataVector resultOwn(n);
+
+  opExternal->mult(alpha, resultExternal);
+  opOwn->mult(alpha, resultOwn);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_SMALL(resultExternal[i] - resultOwn[i], 1e-12);
+  }
+
+  opLaplaceExternal->mult(alpha, resultExternal);
+  opLaplaceOwn->mult(alpha, resultOwn);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_SMALL(resultExternal[i] - resultOwn[i], 1e-12);
+  }
+
+  sgpp::base::DataVector wrongSize(n + 1);
+  BOOST_CHECK_THROW(opOwn->mult(wrongSize, resultOwn), sgpp::base::data_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
@@ -7,6 +7,7 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/MonteCarloBlockEstimator.hpp>
 #include <sgpp/globaldef.hpp>
 #include <sgpp/quadrature/Random.hpp>
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
@@ -16,6 +17,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -24,7 +26,13 @@ namespace quadrature {
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& grid,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(&grid), numberOfSamples(numberOfSamples), seed(seed) {
+    : grid(&grid),
+      numberOfSamples(numberOfSamples),
+      seed(seed),
+      samplerType(SamplerTypes::Naive),
+      blockSize(1024),
+      varianceEstimate(0.0),
+      numberOfUsedSamples(0) {
   dimensions = grid.getDimension();
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
 }
@@ -32,7 +40,14 @@ OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& g
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(size_t dimensions,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(nullptr), numberOfSamples(numberOfSamples), dimensions(dimensions), seed(seed) {
+    : grid(nullptr),
+      numberOfSamples(numberOfSamples),
+      dimensions(dimensions),
+      seed(seed),
+      samplerType(SamplerTypes::Naive),
+      blockSize(1024),
+      varianceEstimate(0.0),
+      numberOfUsedSamples(0) {
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
 }
 
@@ -48,6 +63,7 @@ void OperationQuadratureMCAdvanced::useNaiveMonteCarlo() {
   }
 
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
+  samplerType = SamplerTypes::Naive;
 }
 
 void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
@@ -57,6 +73,8 @@ void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
   }
 
   myGenerator = new sgpp::quadrature::StratifiedSampleGenerator(strataPerDimension, seed);
+  samplerType = SamplerTypes::Stratified;
+  this->strataPerDimension = strataPerDimension;
 }
 
 void OperationQuadratureMCAdvanced::useLatinHypercubeMonteCarlo() {
@@ -66,6 +84,7 @@ void OperationQuadratureMCAdvanced::useLatinHypercubeMonteCarlo() {
 
   myGenerator =
       new sgpp::quadrature::LatinHypercubeSampleGenerator(dimensions, numberOfSamples, seed);
+  samplerType = SamplerTypes::LatinHypercube;
 }
 
 void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
@@ -74,6 +93,7 @@ void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
   }
 
   myGenerator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
+  samplerType = SamplerTypes::Halton;
 }
 
 double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
@@ -132,6 +152,128 @@ double OperationQuadratureMCAdvanced::doQuadratureL2Error(FUNC func, void* clien
   return sqrt(res / static_cast<double>(numberOfSamples));
 }
 
+double OperationQuadratureMCAdvanced::doQuadratureBatched(sgpp::base::DataVector& alpha,
+                                                          double tolerance) {
+  sgpp::base::MonteCarloBlockEstimator estimator(numberOfSamples, blockSize);
+
+  estimator.run(
+      [this, &alpha](size_t block, size_t firstSample, size_t curBlockSize) {
+        sgpp::base::DataMatrix dm(curBlockSize, dimensions);
+        createBlockGenerator(block, firstSample, curBlockSize)->getSamples(dm);
+
+        sgpp::base::DataVector res(curBlockSize);
+        std::unique_ptr<sgpp::base::OperationMultipleEval>(
+            sgpp::op_factory::createOperationMultipleEval(*grid, dm))
+            ->mult(alpha, res);
+        return res.sum();
+      },
+      tolerance);
+
+  varianceEstimate = estimator.getVariance();
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return estimator.getMean();
+}
+
+double OperationQuadratureMCAdvanced::doQuadratureFuncBatched(FUNC func, void* clientdata,
+                                                              double tolerance) {
+  sgpp::base::MonteCarloBlockEstimator estimator(numberOfSamples, blockSize);
+
+  estimator.run(
+      [this, func, clientdata](size_t block, size_t firstSample, size_t curBlockSize) {
+        sgpp::base::DataMatrix dm(curBlockSize, dimensions);
+        createBlockGenerator(block, firstSample, curBlockSize)->getSamples(dm);
+        double sum = 0.0;
+
+        for (size_t i = 0; i < curBlockSize; i++) {
+          sum += func(static_cast<int>(dimensions), dm.getPointer() + i * dimensions, clientdata);
+        }
+
+        return sum;
+      },
+      tolerance);
+
+  varianceEstimate = estimator.getVariance();
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return estimator.getMean();
+}
+
+double OperationQuadratureMCAdvanced::doQuadratureL2ErrorBatched(FUNC func, void* clientdata,
+                                                                 sgpp::base::DataVector& alpha,
+                                                                 double tolerance) {
+  sgpp::base::MonteCarloBlockEstimator estimator(numberOfSamples, blockSize);
+
+  estimator.run(
+      [this, func, clientdata, &alpha](size_t block, size_t firstSample, size_t curBlockSize) {
+        sgpp::base::DataMatrix dm(curBlockSize, dimensions);
+        createBlockGenerator(block, firstSample, curBlockSize)->getSamples(dm);
+
+        sgpp::base::DataVector res(curBlockSize);
+        std::unique_ptr<sgpp::base::OperationMultipleEval>(
+            sgpp::op_factory::createOperationMultipleEval(*grid, dm))
+            ->mult(alpha, res);
+        double sum = 0.0;
+
+        for (size_t i = 0; i < curBlockSize; i++) {
+          sum += pow(func(static_cast<int>(dimensions), dm.getPointer() + i * dimensions,
+                          clientdata) - res[i], 2);
+        }
+
+        return sum;
+      },
+      tolerance);
+
+  // the variance of the square root is estimated with the delta method
+  const double squaredError = estimator.getMean();
+  varianceEstimate =
+      (squaredError > 0.0) ? estimator.getVariance() / (4 * squaredError) : 0.0;
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return sqrt(squaredError);
+}
+
+double OperationQuadratureMCAdvanced::getVarianceEstimate() const { return varianceEstimate; }
+
+size_t OperationQuadratureMCAdvanced::getNumberOfUsedSamples() const {
+  return numberOfUsedSamples;
+}
+
+void OperationQuadratureMCAdvanced::setBlockSize(size_t blockSize) {
+  this->blockSize = blockSize;
+}
+
+size_t OperationQuadratureMCAdvanced::getBlockSize() const { return blockSize; }
+
+std::unique_ptr<SampleGenerator> OperationQuadratureMCAdvanced::createBlockGenerator(
+    size_t block, size_t firstSample, size_t curBlockSize) {
+  const std::uint64_t blockSeed = sgpp::base::MonteCarloBlockEstimator::getBlockSeed(seed, block);
+
+  switch (samplerType) {
+    case SamplerTypes::Stratified: {
+      // continue with the stratum after the last one of the previous blocks
+      // (otherwise, all blocks would start in the first stratum)
+      std::unique_ptr<SampleGenerator> generator(
+          new StratifiedSampleGenerator(strataPerDimension, blockSeed));
+      generator->discardSamples(firstSample);
+      return generator;
+    }
+
+    case SamplerTypes::LatinHypercube:
+      // every block is a Latin hypercube design on its own
+      return std::unique_ptr<SampleGenerator>(
+          new LatinHypercubeSampleGenerator(dimensions, curBlockSize, blockSeed));
+
+    case SamplerTypes::Halton: {
+      // consecutive segments of the same sequence as in doQuadrature
+      std::unique_ptr<SampleGenerator> generator(new HaltonSampleGenerator(dimensions));
+      generator->discardSamples(firstSample);
+      return generator;
+    }
+
+    case SamplerTypes::Naive:
+    default:
+      return std::unique_ptr<SampleGenerator>(new NaiveSampleGenerator(dimensions, blockSeed));
+  }
+}
+
 size_t OperationQuadratureMCAdvanced::getDimensions() { return dimensions; }
 
 }  // namespace quadrature
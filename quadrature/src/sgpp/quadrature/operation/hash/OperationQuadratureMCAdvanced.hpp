@@ -10,7 +10,9 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/globaldef.hpp>
 #include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SamplerTypes.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -85,6 +87,69 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
    */
   double doQuadratureL2Error(FUNC func, void* clientdata, sgpp::base::DataVector& alpha);
 
+  /**
+   * @brief Batched quadrature using advanced MC in @f$\Omega=[0,1]^d@f$.
+   * The samples are generated and evaluated (with OperationMultipleEval) in blocks of
+   * getBlockSize() samples, which are processed in parallel. Every block uses its own sample
+   * generator of the selected type: pseudo-random generators (naive, stratified, Latin hypercube)
+   * get a seed derived from the seed and the index of the block, Halton blocks are consecutive
+   * segments of the sequence. The result does not depend on the number of threads.
+   * For stratified sampling, every block continues with the stratum after the last one of
+   * the previous blocks, so the strata are covered evenly even if there are more strata than
+   * samples per block. As the blocks are then not identically distributed, the variance
+   * estimate is only reliable if the block size is a multiple of the number of strata.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param tolerance Stop as soon as the estimated standard error is at most this value
+   * (0: use all samples)
+   */
+  double doQuadratureBatched(sgpp::base::DataVector& alpha, double tolerance = 0.0);
+
+  /**
+   * @brief Batched quadrature of an arbitrary function using advanced MC
+   * (see doQuadratureBatched()). The function is called concurrently by multiple threads.
+   *
+   * @param func The function to integrate
+   * @param clientdata Optional data to pass to FUNC
+   * @param tolerance Stop as soon as the estimated standard error is at most this value
+   * (0: use all samples)
+   */
+  double doQuadratureFuncBatched(FUNC func, void* clientdata, double tolerance = 0.0);
+
+  /**
+   * @brief Batched quadrature of the @f$L^2@f$-norm of the error between a given function and
+   * the current sparse grid function using advanced MC (see doQuadratureBatched()).
+   * The function is called concurrently by multiple threads.
+   *
+   * @param func The function @f$f(x)@f$
+   * @param clientdata Optional data to pass to FUNC
+   * @param alpha Coefficient vector for current grid
+   * @param tolerance Stop as soon as the estimated standard error of the squared
+   * @f$L^2@f$-norm is at most this value (0: use all samples)
+   */
+  double doQuadratureL2ErrorBatched(FUNC func, void* clientdata, sgpp::base::DataVector& alpha,
+                                    double tolerance = 0.0);
+
+  /**
+   * @return estimated variance of the result of the last batched quadrature
+   */
+  double getVarianceEstimate() const;
+
+  /**
+   * @return number of samples used by the last batched quadrature
+   */
+  size_t getNumberOfUsedSamples() const;
+
+  /**
+   * @param blockSize Number of samples per block of the batched quadrature
+   */
+  void setBlockSize(size_t blockSize);
+
+  /**
+   * @return number of samples per block of the batched quadrature
+   */
+  size_t getBlockSize() const;
+
   /**
    * @brief Initialize SampleGenerator for NaiveMC
    */
@@ -138,6 +203,28 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
 
   // SampleGenerator Instance
   sgpp::quadrature::SampleGenerator* myGenerator;
+
+  // type of the current SampleGenerator
+  SamplerTypes samplerType;
+  // strata per dimension of the StratifiedSampleGenerator
+  std::vector<size_t> strataPerDimension;
+  // number of samples per block of the batched quadrature
+  size_t blockSize;
+  // estimated variance of the last batched quadrature
+  double varianceEstimate;
+  // number of samples used by the last batched quadrature
+  size_t numberOfUsedSamples;
+
+  /**
+   * @brief Creates the sample generator of a block of the batched quadrature.
+   *
+   * @param block Index of the block
+   * @param firstSample Index of the first sample of the block
+   * @param curBlockSize Number of samples in the block
+   * @return sample generator of the current type
+   */
+  std::unique_ptr<SampleGenerator> createBlockGenerator(size_t block, size_t firstSample,
+                                                        size_t curBlockSize);
 };
 
 }  // namespace quadrature
@@ -50,5 +50,7 @@ void HaltonSampleGenerator::getSample(sgpp::base::DataVector& dv) {
   index++;
 }
 
+void HaltonSampleGenerator::discardSamples(size_t numberOfSamples) { index += numberOfSamples; }
+
 }  // namespace quadrature
 }  // namespace sgpp
@@ -43,6 +43,13 @@ class HaltonSampleGenerator : public SampleGenerator {
    */
   virtual void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Skips samples of the sequence in constant time.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void discardSamples(size_t numberOfSamples) override;
+
  private:
   size_t index;
   std::vector<size_t> baseVector;
@@ -51,7 +51,7 @@ void LatinHypercubeSampleGenerator::getSample(sgpp::base::DataVector& sample) {
   if (numberOfCurrentSample < numberOfStrata) {
     numberOfCurrentSample++;
   } else {
-    numberOfCurrentSample = 0;
+    numberOfCurrentSample = 1;
     shuffleStrataSequence();
   }
 }
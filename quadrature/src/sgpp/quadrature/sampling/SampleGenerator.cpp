@@ -31,6 +31,14 @@ void SampleGenerator::getSamples(base::DataMatrix& samples) {
   }
 }
 
+void SampleGenerator::discardSamples(size_t numberOfSamples) {
+  base::DataVector dv(dimensions);
+
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    getSample(dv);
+  }
+}
+
 size_t SampleGenerator::getDimensions() { return dimensions; }
 
 void SampleGenerator::setDimensions(size_t dimensions) { this->dimensions = dimensions; }
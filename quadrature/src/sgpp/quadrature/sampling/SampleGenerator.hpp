@@ -56,6 +56,15 @@ class SampleGenerator {
 
   void getSamples(sgpp::base::DataMatrix& samples);
 
+  /**
+   * Skips the given number of samples, i.e., the next generated sample is the same as
+   * after numberOfSamples calls of getSample.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+
+  virtual void discardSamples(size_t numberOfSamples);
+
   /**
    *
    * @return current number of dimensions used for sample generation
@@ -45,6 +45,15 @@ void StratifiedSampleGenerator::getSample(sgpp::base::DataVector& dv) {
   getNextStrata();
 }
 
+void StratifiedSampleGenerator::discardSamples(size_t numberOfSamples) {
+  // add numberOfSamples to the counter of strata (mixed radix, first dimension fastest)
+  for (size_t i = 0; (i < dimensions) && (numberOfSamples > 0); i++) {
+    const size_t sum = currentStrata[i] + numberOfSamples % numberOfStrata[i];
+    currentStrata[i] = sum % numberOfStrata[i];
+    numberOfSamples = numberOfSamples / numberOfStrata[i] + sum / numberOfStrata[i];
+  }
+}
+
 void StratifiedSampleGenerator::getNextStrata() {
   for (size_t i = 0; i < dimensions; i++) {
     // next stratum in this dimension available
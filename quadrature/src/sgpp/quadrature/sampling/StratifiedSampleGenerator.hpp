@@ -49,6 +49,15 @@ class StratifiedSampleGenerator : public SampleGenerator {
 
   void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Skips the strata of the given number of samples, i.e., the next generated sample lies in
+   * the same stratum as after numberOfSamples calls of getSample. In contrast to getSample,
+   * no random numbers are drawn.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void discardSamples(size_t numberOfSamples) override;
+
  private:
   // Array containing the number of strata per dimension
   std::vector<size_t> numberOfStrata;
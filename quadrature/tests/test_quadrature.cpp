@@ -89,6 +89,34 @@ BOOST_AUTO_TEST_CASE(testSamplers) {
   testSampler(pSSampler, dim, numSamples, analyticResult, 1e-3);
 }
 
+BOOST_AUTO_TEST_CASE(testStratifiedSamplerDiscard) {
+  // discarding samples has to skip the same strata as drawing them
+  std::vector<size_t> strataPerDimension = {7, 5, 3};
+  const size_t dim = strataPerDimension.size();
+  StratifiedSampleGenerator sampler(strataPerDimension, 1234567);
+  StratifiedSampleGenerator discardingSampler(strataPerDimension, 7654321);
+  DataVector sample(dim);
+  DataVector otherSample(dim);
+
+  for (size_t skip : {0, 1, 6, 7, 40, 104, 105, 250}) {
+    for (size_t i = 0; i < skip; i++) {
+      sampler.getSample(sample);
+    }
+
+    discardingSampler.discardSamples(skip);
+
+    for (size_t i = 0; i < 3; i++) {
+      sampler.getSample(sample);
+      discardingSampler.getSample(otherSample);
+
+      for (size_t t = 0; t < dim; t++) {
+        const double n = static_cast<double>(strataPerDimension[t]);
+        BOOST_CHECK_EQUAL(std::floor(sample[t] * n), std::floor(otherSample[t] * n));
+      }
+    }
+  }
+}
+
 void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
                                        sgpp::quadrature::SamplerTypes samplerType, size_t dim,
                                        size_t numSamples, std::vector<size_t>& blockSize,
@@ -116,6 +144,19 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
 
   double resMC = opQuad->doQuadrature(alpha);
   BOOST_CHECK_CLOSE(resMC, analyticResult, tol * 1e2);
+
+  // batched quadrature with blocks evaluated in parallel
+  opQuad->setBlockSize(1000);
+  double resBatched = opQuad->doQuadratureBatched(alpha);
+  BOOST_CHECK_CLOSE(resBatched, analyticResult, tol * 1e2);
+  BOOST_CHECK_EQUAL(opQuad->getNumberOfUsedSamples(), numSamples);
+  BOOST_CHECK_LE(opQuad->getVarianceEstimate(), tol * tol);
+  BOOST_CHECK_EQUAL(opQuad->doQuadratureBatched(alpha), resBatched);
+
+  if (samplerType == sgpp::quadrature::SamplerTypes::Halton) {
+    // the blocks are segments of the same sequence
+    BOOST_CHECK_CLOSE(resBatched, resMC, 1e-10);
+  }
 }
 
 BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
@@ -151,4 +192,13 @@ BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
                                     dim, numSamples, blockSize, analyticResult, 1e-3, seed);
   testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Halton, dim,
                                     numSamples, blockSize, analyticResult, 1e-3, seed);
+
+  // more strata than samples per block, the blocks have to continue the stratification
+  std::vector<size_t> fineStrata(dim, 100);
+  std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuadFine(
+      sgpp::op_factory::createOperationQuadratureMCAdvanced(*grid, numSamples, seed));
+  opQuadFine->useStratifiedMonteCarlo(fineStrata);
+  opQuadFine->setBlockSize(1000);
+  BOOST_CHECK_CLOSE(opQuadFine->doQuadratureBatched(alpha), analyticResult, 1e-1);
+  BOOST_CHECK_EQUAL(opQuadFine->getNumberOfUsedSamples(), numSamples);
 }